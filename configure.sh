@@ -43,6 +43,7 @@ The following flags enable optional features (disable with --no-<option name>).
   --debug-symbols          include debug symbols
   --valgrind               Valgrind instrumentation
   --debug-context-mm       use the debug context memory manager
+  --thread-safe-nodes      support constructing nodes from multiple threads
   --statistics             include statistics
   --assertions             turn on assertions
   --tracing                include tracing code
@@ -147,6 +148,7 @@ build_shared=ON
 safe_mode=default
 static_binary=default
 statistics=default
+thread_safe_nodes=default
 tracing=default
 tsan=default
 ubsan=default
@@ -243,6 +245,9 @@ do
     --debug-context-mm) debug_context_mm=ON;;
     --no-debug-context-mm) debug_context_mm=OFF;;
 
+    --thread-safe-nodes) thread_safe_nodes=ON;;
+    --no-thread-safe-nodes) thread_safe_nodes=OFF;;
+
     --gpl) gpl=ON;;
     --no-gpl) gpl=OFF;;
 
@@ -389,6 +394,8 @@ fi
   && cmake_opts="$cmake_opts -DENABLE_DEBUG_SYMBOLS=$debug_symbols"
 [ $debug_context_mm != default ] \
   && cmake_opts="$cmake_opts -DENABLE_DEBUG_CONTEXT_MM=$debug_context_mm"
+[ $thread_safe_nodes != default ] \
+  && cmake_opts="$cmake_opts -DENABLE_THREAD_SAFE_NODES=$thread_safe_nodes"
 [ $gpl != default ] \
   && cmake_opts="$cmake_opts -DENABLE_GPL=$gpl"
 [ $win64 != default ] \
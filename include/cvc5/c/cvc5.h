@@ -4205,6 +4205,116 @@ CVC5_EXPORT Cvc5Result cvc5_check_sat(Cvc5* cvc5);
 CVC5_EXPORT Cvc5Result cvc5_check_sat_assuming(Cvc5* cvc5,
                                                size_t size,
                                                const Cvc5Term assumptions[]);
+
+/**
+ * Add an objective to be optimized by subsequent calls to `cvc5_optimize()`.
+ *
+ * Objectives are removed when the assertion level at which they were added
+ * is popped. Multiple objectives are combined according to the mode given to
+ * `cvc5_optimize()`.
+ *
+ * @warning This function is experimental and may change in future versions.
+ *
+ * @param cvc5      The solver instance.
+ * @param term      The term to optimize, which must be of sort Int, Real or
+ *                  of a bit-vector sort.
+ * @param type      Whether to minimize or maximize the term.
+ * @param bv_signed Whether the term is compared as a signed value, if it is a
+ *                  bit-vector term.
+ */
+CVC5_EXPORT void cvc5_add_objective(Cvc5* cvc5,
+                                    Cvc5Term term,
+                                    Cvc5ObjectiveType type,
+                                    bool bv_signed);
+
+/**
+ * Assert a soft constraint, which should hold in the models returned by
+ * subsequent calls to `cvc5_optimize()`, if possible.
+ *
+ * SMT-LIB:
+ *
+ * \verbatim embed:rst:leading-asterisk
+ * .. code:: smtlib
+ *
+ *     (assert-soft <formula> :weight <numeral> :id <symbol>)
+ * \endverbatim
+ *
+ * The soft constraints with the same id form a single objective, which
+ * minimizes the sum of the weights of the violated soft constraints.
+ *
+ * @warning This function is experimental and may change in future versions.
+ *
+ * @param cvc5    The solver instance.
+ * @param formula The soft constraint.
+ * @param weight  The penalty incurred if the formula does not hold, which must
+ *                be positive.
+ * @param id      The id of the soft constraint.
+ */
+CVC5_EXPORT void cvc5_assert_soft(Cvc5* cvc5,
+                                  Cvc5Term formula,
+                                  uint64_t weight,
+                                  const char* id);
+
+/**
+ * Check satisfiability and optimize the current objectives.
+ *
+ * If the result is sat, the optimal values of the objectives can be queried
+ * via `cvc5_get_objective_values()`. Requires option `incremental` to be
+ * enabled. In Pareto mode, each call returns a new Pareto-optimal point, and
+ * the result is unsat if no such point exists.
+ *
+ * @warning This function is experimental and may change in future versions.
+ *
+ * @param cvc5 The solver instance.
+ * @param mode The mode for combining multiple objectives.
+ * @return The result of the optimization query.
+ */
+CVC5_EXPORT Cvc5Result cvc5_optimize(Cvc5* cvc5, Cvc5OptimizationMode mode);
+
+/**
+ * Check satisfiability and optimize the current objectives, reporting each
+ * improvement of the best values found so far.
+ *
+ * This is equivalent to `cvc5_optimize()`, except that the callback is called
+ * with the values of the objectives whenever a model improves on the best
+ * values found so far. The callback must not modify the assertions. If it
+ * returns false, the search is stopped and the result is unknown. If the
+ * search is stopped before an optimum is proven, e.g., because the time
+ * limit per call was reached, `cvc5_get_objective_values()` returns the best
+ * values found so far.
+ *
+ * @warning This function is experimental and may change in future versions.
+ *
+ * @param cvc5     The solver instance.
+ * @param mode     The mode for combining multiple objectives.
+ * @param state    The state data for the callback, may be NULL.
+ * @param callback The function to call on each improvement, taking the
+ *                 number of objectives, the array of their values and a void
+ *                 pointer to optionally capture any state data the function
+ *                 may need. It returns false to stop the search.
+ * @return The result of the optimization query.
+ */
+CVC5_EXPORT Cvc5Result cvc5_optimize_with_callback(
+    Cvc5* cvc5,
+    Cvc5OptimizationMode mode,
+    void* state,
+    bool (*callback)(size_t, const Cvc5Term*, void*));
+
+/**
+ * Get the values of the objectives computed by the last call to
+ * `cvc5_optimize()`, in the order in which the objectives were added. If the
+ * last call returned unknown, these are the best values found so far, which
+ * are not known to be optimal.
+ *
+ * @warning This function is experimental and may change in future versions.
+ *
+ * @param cvc5 The solver instance.
+ * @param size The size of the resulting array.
+ * @return The optimal values of the objectives.
+ */
+CVC5_EXPORT const Cvc5Term* cvc5_get_objective_values(Cvc5* cvc5,
+                                                      size_t* size);
+
 /**
  * Get the list of asserted formulas.
  *
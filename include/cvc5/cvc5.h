@@ -5688,6 +5688,166 @@ class CVC5_EXPORT Solver
    */
   Result checkSatAssuming(const std::vector<Term>& assumptions) const;
 
+  /**
+   * Add an objective to be optimized by subsequent calls to optimize().
+   *
+   * Objectives are scoped: an objective is removed when the assertion level
+   * at which it was added is popped. If more than one objective is added,
+   * they are combined according to the mode given to optimize().
+   *
+   * @warning This function is experimental and may change in future versions.
+   *
+   * @param term     The term to optimize, which must be of sort Int, Real or
+   *                 of a bit-vector sort.
+   * @param type     Whether to minimize or maximize the term.
+   * @param bvSigned Whether the term is compared as a signed value, if it is
+   *                 a bit-vector term.
+   */
+  void addObjective(const Term& term,
+                    modes::ObjectiveType type,
+                    bool bvSigned = false) const;
+
+  /**
+   * Assert a soft constraint, which should hold in the models returned by
+   * subsequent calls to optimize(), if possible.
+   *
+   * SMT-LIB:
+   *
+   * \verbatim embed:rst:leading-asterisk
+   * .. code:: smtlib
+   *
+   *     (assert-soft <formula> :weight <numeral> :id <symbol>)
+   * \endverbatim
+   *
+   * The soft constraints with the same id form a single objective, which
+   * minimizes the sum of the weights of the violated soft constraints. This
+   * objective is added when the first soft constraint with its id is
+   * asserted, and combined with the other objectives according to the mode
+   * given to optimize(). Soft constraints are scoped like objectives.
+   *
+   * \verbatim embed:rst:leading-asterisk
+   * If option :ref:`produce-unsat-assumptions
+   * <lbl-option-produce-unsat-assumptions>` is enabled, the soft constraints
+   * are optimized by a core-guided search, which is typically much faster
+   * than a linear search on the sum of the weights if there are many soft
+   * constraints.
+   * \endverbatim
+   *
+   * @warning This function is experimental and may change in future versions.
+   *
+   * @param formula The soft constraint.
+   * @param weight  The penalty incurred if the formula does not hold, which
+   *                must be positive.
+   * @param id      The id of the soft constraint.
+   */
+  void assertSoft(const Term& formula,
+                  uint64_t weight = 1,
+                  const std::string& id = "") const;
+
+  /**
+   * Check satisfiability and optimize the current objectives.
+   *
+   * \verbatim embed:rst:leading-asterisk
+   * The objectives are optimized incrementally: the current assertions are
+   * preprocessed and asserted to the underlying SAT solver once, after which
+   * each improvement step only adds a bound on the objective. Requires option
+   * :ref:`incremental <lbl-option-incremental>` to be enabled.
+   * \endverbatim
+   *
+   * Multiple objectives are combined according to the given mode, see
+   * modes::OptimizationMode. If the result is sat, the optimal values of the
+   * objectives can be queried via getObjectiveValues(). In lexicographic and
+   * Pareto mode, the current model assigns all objectives these values. In
+   * box mode, the current model assigns the last objective its optimal value.
+   * If no objectives have been added, this is equivalent to checkSat().
+   *
+   * In Pareto mode, each call returns a Pareto-optimal point that was not
+   * returned by a previous call, as long as the assertions and the objectives
+   * do not change. The result is unsat if no such point exists.
+   *
+   * @warning This function is experimental and may change in future versions.
+   *
+   * @param mode The mode for combining multiple objectives.
+   * @return The result of the optimization query. This is unknown if an
+   *         optimal model could not be determined, e.g., when a resource
+   *         limit was reached or when the optimum of a Real objective is not
+   *         attained. In this case, getObjectiveValues() returns the best
+   *         values found so far.
+   */
+  Result optimize(
+      modes::OptimizationMode mode = modes::OptimizationMode::LEX) const;
+
+  /**
+   * Check satisfiability and optimize the current objectives, reporting each
+   * improvement of the best values found so far.
+   *
+   * This is equivalent to optimize(), except that the callback is called
+   * with the values of the objectives whenever a model improves on the best
+   * values found so far, in the order in which the objectives were added.
+   * While the callback runs, the current model assigns the objectives these
+   * values, which may be queried via getValue(). The callback must not modify
+   * the assertions. If it returns false, the search is stopped and the
+   * result is unknown.
+   *
+   * If the search is stopped before an optimum is proven, e.g., because the
+   * time limit per call was reached, the result is unknown and
+   * getObjectiveValues() returns the best values found so far.
+   *
+   * If given, the bounds function is polled before each improvement step of
+   * a linear search. It may return values of the objectives (in the order in
+   * which they were added) that are attained by some model of the current
+   * assertions found elsewhere, e.g., by another solver instance working on
+   * the same query. If such a value is better than the best value found so
+   * far, the next step searches for a model that is at least as good as it.
+   * Values that are not attained are detected and ignored. Bounds are only
+   * used for objectives that are optimized independently, i.e., the first
+   * objective in lexicographic mode and all objectives in box mode.
+   *
+   * If given, the bound callback is called with bounds on the optimal values
+   * of the objectives (in the order in which they were added) whenever one
+   * of them tightens. A bound is a value that no model improves on, i.e., a
+   * lower bound when minimizing and an upper bound when maximizing, and is
+   * the null term if no bound is known yet. Together with the best values
+   * found so far, the bounds enclose the optimum. In lexicographic mode, the
+   * bound of an objective only holds in models in which the objectives
+   * before it have their optimal values. No bounds are reported in Pareto
+   * mode. If the bound callback returns false, the search is stopped and
+   * the result is unknown.
+   *
+   * @warning This function is experimental and may change in future versions.
+   *
+   * @param mode          The mode for combining multiple objectives.
+   * @param callback      The function to call on each improvement, which
+   *                      returns false to stop the search.
+   * @param bounds        The function that provides values of the objectives
+   *                      found elsewhere, or nullptr.
+   * @param boundCallback The function to call when the bounds on the optima
+   *                      tighten, which returns false to stop the search, or
+   *                      nullptr.
+   * @return The result of the optimization query.
+   */
+  Result optimize(
+      modes::OptimizationMode mode,
+      std::function<bool(const std::vector<Term>&)> callback,
+      std::function<std::vector<Term>()> bounds = nullptr,
+      std::function<bool(const std::vector<Term>&)> boundCallback =
+          nullptr) const;
+
+  /**
+   * Get the values of the objectives computed by the last call to
+   * optimize(), in the order in which the objectives were added.
+   *
+   * If the last call to optimize() returned sat, these are the optimal values.
+   * If it returned unknown, these are the best values found before the search
+   * stopped, which are not known to be optimal. This is empty if no model was
+   * found, e.g., if the last call to optimize() returned unsat.
+   *
+   * @warning This function is experimental and may change in future versions.
+   *
+   * @return The values of the objectives.
+   */
+  std::vector<Term> getObjectiveValues() const;
+
   /**
    * Create datatype sort.
    *
@@ -618,6 +618,132 @@ CVC5_EXPORT std::string to_string(cvc5::modes::FindSynthTarget target);
 namespace cvc5::modes {
 #endif
 
+/* -------------------------------------------------------------------------- */
+/* ObjectiveType                                                              */
+/* -------------------------------------------------------------------------- */
+
+#ifdef CVC5_API_USE_C_ENUMS
+#undef EVALUE
+#define EVALUE(name) CVC5_OBJECTIVE_TYPE_##name
+#endif
+
+/**
+ * The direction in which an objective is optimized, used as an argument to
+ * Solver::addObjective.
+ */
+enum ENUM(ObjectiveType)
+{
+  /** Find a model in which the value of the objective is minimal. */
+  EVALUE(MINIMIZE) = 0,
+  /** Find a model in which the value of the objective is maximal. */
+  EVALUE(MAXIMIZE),
+#ifdef CVC5_API_USE_C_ENUMS
+  // must be last entry
+  EVALUE(LAST),
+#endif
+};
+
+#ifdef CVC5_API_USE_C_ENUMS
+#ifndef DOXYGEN_SKIP
+typedef enum ENUM(ObjectiveType) ENUM(ObjectiveType);
+#endif
+#endif
+
+#ifdef CVC5_API_USE_C_ENUMS
+/**
+ * Get a string representation of a Cvc5ObjectiveType.
+ * @param type The objective type.
+ * @return The string representation.
+ */
+CVC5_EXPORT const char* cvc5_modes_objective_type_to_string(
+    Cvc5ObjectiveType type);
+#else
+/**
+ * Serialize an ObjectiveType to given stream.
+ * @param out  The output stream
+ * @param type The objective type.
+ * @return The output stream
+ */
+CVC5_EXPORT std::ostream& operator<<(std::ostream& out, ObjectiveType type);
+}
+
+namespace std {
+CVC5_EXPORT std::string to_string(cvc5::modes::ObjectiveType type);
+}
+
+namespace cvc5::modes {
+#endif
+
+/* -------------------------------------------------------------------------- */
+/* OptimizationMode                                                           */
+/* -------------------------------------------------------------------------- */
+
+#ifdef CVC5_API_USE_C_ENUMS
+#undef EVALUE
+#define EVALUE(name) CVC5_OPTIMIZATION_MODE_##name
+#endif
+
+/**
+ * The mode for combining multiple objectives, used as an argument to
+ * Solver::optimize.
+ */
+enum ENUM(OptimizationMode)
+{
+  /**
+   * Optimize the objectives lexicographically, in the order in which they
+   * were added. Each objective is optimal among the models in which all
+   * previous objectives are optimal.
+   */
+  EVALUE(LEX) = 0,
+  /**
+   * Compute a Pareto-optimal point, i.e., a model such that no other model
+   * is at least as good for all objectives and strictly better for one.
+   * Each subsequent call computes a new Pareto-optimal point, until no
+   * further point exists.
+   */
+  EVALUE(PARETO),
+  /**
+   * Optimize each objective independently. The optimal values are in general
+   * not attained in the same model.
+   */
+  EVALUE(BOX),
+#ifdef CVC5_API_USE_C_ENUMS
+  // must be last entry
+  EVALUE(LAST),
+#endif
+};
+
+#ifdef CVC5_API_USE_C_ENUMS
+#ifndef DOXYGEN_SKIP
+typedef enum ENUM(OptimizationMode) ENUM(OptimizationMode);
+#endif
+#endif
+
+#ifdef CVC5_API_USE_C_ENUMS
+/**
+ * Get a string representation of a Cvc5OptimizationMode.
+ * @param mode The optimization mode.
+ * @return The string representation.
+ */
+CVC5_EXPORT const char* cvc5_modes_optimization_mode_to_string(
+    Cvc5OptimizationMode mode);
+#else
+/**
+ * Serialize an OptimizationMode to given stream.
+ * @param out  The output stream
+ * @param mode The optimization mode.
+ * @return The output stream
+ */
+CVC5_EXPORT std::ostream& operator<<(std::ostream& out, OptimizationMode mode);
+}
+
+namespace std {
+CVC5_EXPORT std::string to_string(cvc5::modes::OptimizationMode mode);
+}
+
+namespace cvc5::modes {
+#endif
+
 /* -------------------------------------------------------------------------- */
 /* InputLanguage                                                              */
 /* -------------------------------------------------------------------------- */
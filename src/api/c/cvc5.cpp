@@ -202,6 +202,34 @@ const char* cvc5_modes_find_synth_target_to_string(Cvc5FindSynthTarget target)
   return str.c_str();
 }
 
+/* -------------------------------------------------------------------------- */
+/* Cvc5ObjectiveType                                                          */
+/* -------------------------------------------------------------------------- */
+
+const char* cvc5_modes_objective_type_to_string(Cvc5ObjectiveType type)
+{
+  static thread_local std::string str;
+  CVC5_CAPI_TRY_CATCH_BEGIN;
+  CVC5_CAPI_CHECK_OBJECTIVE_TYPE(type);
+  str = std::to_string(static_cast<cvc5::modes::ObjectiveType>(type));
+  CVC5_CAPI_TRY_CATCH_END;
+  return str.c_str();
+}
+
+/* -------------------------------------------------------------------------- */
+/* Cvc5OptimizationMode                                                       */
+/* -------------------------------------------------------------------------- */
+
+const char* cvc5_modes_optimization_mode_to_string(Cvc5OptimizationMode mode)
+{
+  static thread_local std::string str;
+  CVC5_CAPI_TRY_CATCH_BEGIN;
+  CVC5_CAPI_CHECK_OPTIMIZATION_MODE(mode);
+  str = std::to_string(static_cast<cvc5::modes::OptimizationMode>(mode));
+  CVC5_CAPI_TRY_CATCH_END;
+  return str.c_str();
+}
+
 /* -------------------------------------------------------------------------- */
 /* Cvc5InputLanguage                                                          */
 /* -------------------------------------------------------------------------- */
@@ -4777,6 +4805,89 @@ Cvc5Result cvc5_check_sat_assuming(Cvc5* cvc5,
   return res;
 }
 
+void cvc5_add_objective(Cvc5* cvc5,
+                        Cvc5Term term,
+                        Cvc5ObjectiveType type,
+                        bool bv_signed)
+{
+  CVC5_CAPI_TRY_CATCH_BEGIN;
+  CVC5_CAPI_CHECK_NOT_NULL(cvc5);
+  CVC5_CAPI_CHECK_TERM(term);
+  CVC5_CAPI_CHECK_OBJECTIVE_TYPE(type);
+  cvc5->d_solver.addObjective(
+      term->d_term, static_cast<cvc5::modes::ObjectiveType>(type), bv_signed);
+  CVC5_CAPI_TRY_CATCH_END;
+}
+
+void cvc5_assert_soft(Cvc5* cvc5,
+                      Cvc5Term formula,
+                      uint64_t weight,
+                      const char* id)
+{
+  CVC5_CAPI_TRY_CATCH_BEGIN;
+  CVC5_CAPI_CHECK_NOT_NULL(cvc5);
+  CVC5_CAPI_CHECK_TERM(formula);
+  CVC5_CAPI_CHECK_NOT_NULL(id);
+  cvc5->d_solver.assertSoft(formula->d_term, weight, id);
+  CVC5_CAPI_TRY_CATCH_END;
+}
+
+Cvc5Result cvc5_optimize(Cvc5* cvc5, Cvc5OptimizationMode mode)
+{
+  Cvc5Result res = nullptr;
+  CVC5_CAPI_TRY_CATCH_BEGIN;
+  CVC5_CAPI_CHECK_NOT_NULL(cvc5);
+  CVC5_CAPI_CHECK_OPTIMIZATION_MODE(mode);
+  res = cvc5->export_result(cvc5->d_solver.optimize(
+      static_cast<cvc5::modes::OptimizationMode>(mode)));
+  CVC5_CAPI_TRY_CATCH_END;
+  return res;
+}
+
+Cvc5Result cvc5_optimize_with_callback(Cvc5* cvc5,
+                                       Cvc5OptimizationMode mode,
+                                       void* state,
+                                       bool (*callback)(size_t,
+                                                        const Cvc5Term*,
+                                                        void*))
+{
+  Cvc5Result res = nullptr;
+  CVC5_CAPI_TRY_CATCH_BEGIN;
+  CVC5_CAPI_CHECK_NOT_NULL(cvc5);
+  CVC5_CAPI_CHECK_OPTIMIZATION_MODE(mode);
+  CVC5_CAPI_CHECK_NOT_NULL(callback);
+  std::function<bool(const std::vector<cvc5::Term>&)> ccallback =
+      [cvc5, state, callback](const std::vector<cvc5::Term>& values) {
+        std::vector<Cvc5Term> cvalues;
+        for (auto& t : values)
+        {
+          cvalues.push_back(cvc5->d_tm->export_term(t));
+        }
+        return callback(cvalues.size(), cvalues.data(), state);
+      };
+  res = cvc5->export_result(cvc5->d_solver.optimize(
+      static_cast<cvc5::modes::OptimizationMode>(mode), ccallback));
+  CVC5_CAPI_TRY_CATCH_END;
+  return res;
+}
+
+const Cvc5Term* cvc5_get_objective_values(Cvc5* cvc5, size_t* size)
+{
+  static thread_local std::vector<Cvc5Term> res;
+  CVC5_CAPI_TRY_CATCH_BEGIN;
+  CVC5_CAPI_CHECK_NOT_NULL(cvc5);
+  CVC5_CAPI_CHECK_NOT_NULL(size);
+  res.clear();
+  auto values = cvc5->d_solver.getObjectiveValues();
+  for (auto& t : values)
+  {
+    res.push_back(cvc5->d_tm->export_term(t));
+  }
+  *size = res.size();
+  CVC5_CAPI_TRY_CATCH_END;
+  return res.data();
+}
+
 const Cvc5Term* cvc5_get_assertions(Cvc5* cvc5, size_t* size)
 {
   static thread_local std::vector<Cvc5Term> res;
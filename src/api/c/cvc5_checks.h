@@ -113,6 +113,14 @@ class Cvc5CApiAbortStream
   CVC5_API_CHECK((type) >= 0 && (type) < CVC5_LEARNED_LIT_TYPE_LAST) \
       << "invalid learned literal type"
 
+#define CVC5_CAPI_CHECK_OBJECTIVE_TYPE(type)                       \
+  CVC5_API_CHECK((type) >= 0 && (type) < CVC5_OBJECTIVE_TYPE_LAST) \
+      << "invalid objective type"
+
+#define CVC5_CAPI_CHECK_OPTIMIZATION_MODE(mode)                         \
+  CVC5_API_CHECK((mode) >= 0 && (mode) < CVC5_OPTIMIZATION_MODE_LAST) \
+      << "invalid optimization mode"
+
 #define CVC5_CAPI_CHECK_PROOF_COMPONENT(pc)                     \
   CVC5_API_CHECK((pc) >= 0 && (pc) < CVC5_PROOF_COMPONENT_LAST) \
       << "invalid proof component kind"
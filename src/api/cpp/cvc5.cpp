@@ -79,6 +79,7 @@
 #include "util/finite_field_value.h"
 #include "util/floatingpoint.h"
 #include "util/iand.h"
+#include "util/integer.h"
 #include "util/random.h"
 #include "util/regexp.h"
 #include "util/result.h"
@@ -8184,6 +8185,107 @@ std::string Solver::getModel(const std::vector<Sort>& sorts,
   CVC5_API_TRY_CATCH_END;
 }
 
+void Solver::addObjective(const Term& term,
+                          modes::ObjectiveType type,
+                          bool bvSigned) const
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  CVC5_API_SOLVER_CHECK_TERM(term);
+  CVC5_API_ARG_CHECK_EXPECTED(term.getSort().isInteger()
+                                  || term.getSort().isReal()
+                                  || term.getSort().isBitVector(),
+                              term)
+      << "a term of sort Int, Real or of a bit-vector sort";
+  ensureWellFormedTerm(term);
+  //////// all checks before this line
+  d_slv->addObjective(*term.d_node, type, bvSigned);
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
+void Solver::assertSoft(const Term& formula,
+                        uint64_t weight,
+                        const std::string& id) const
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  CVC5_API_SOLVER_CHECK_TERM(formula);
+  CVC5_API_SOLVER_CHECK_TERM_WITH_SORT(formula, getBooleanSort());
+  CVC5_API_ARG_CHECK_EXPECTED(weight > 0, weight) << "a weight > 0";
+  ensureWellFormedTerm(formula);
+  //////// all checks before this line
+  d_slv->assertSoft(*formula.d_node, internal::Integer(weight), id);
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
+Result Solver::optimize(modes::OptimizationMode mode) const
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  CVC5_API_CHECK(d_slv->getOptions().base.incrementalSolving)
+      << "cannot optimize unless incremental solving is enabled "
+         "(try --"
+      << internal::options::base::longName::incrementalSolving << ")";
+  CVC5_API_CHECK(d_slv->getOptions().smt.produceModels)
+      << "cannot optimize unless model generation is enabled "
+         "(try --"
+      << internal::options::smt::longName::produceModels << ")";
+  //////// all checks before this line
+  return d_slv->optimize(mode);
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
+Result Solver::optimize(
+    modes::OptimizationMode mode,
+    std::function<bool(const std::vector<Term>&)> callback,
+    std::function<std::vector<Term>()> bounds,
+    std::function<bool(const std::vector<Term>&)> boundCallback) const
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  CVC5_API_CHECK(d_slv->getOptions().base.incrementalSolving)
+      << "cannot optimize unless incremental solving is enabled "
+         "(try --"
+      << internal::options::base::longName::incrementalSolving << ")";
+  CVC5_API_CHECK(d_slv->getOptions().smt.produceModels)
+      << "cannot optimize unless model generation is enabled "
+         "(try --"
+      << internal::options::smt::longName::produceModels << ")";
+  CVC5_API_ARG_CHECK_NOT_NULLPTR(callback);
+  //////// all checks before this line
+  std::function<std::vector<internal::Node>()> ibounds = nullptr;
+  if (bounds)
+  {
+    ibounds = [bounds]() { return Term::termVectorToNodes(bounds()); };
+  }
+  std::function<bool(const std::vector<internal::Node>&)> iboundCallback =
+      nullptr;
+  if (boundCallback)
+  {
+    iboundCallback = [&, boundCallback](
+                         const std::vector<internal::Node>& values) {
+      return boundCallback(Term::nodeVectorToTerms(&d_tm, values));
+    };
+  }
+  return d_slv->optimize(
+      mode,
+      [&, callback](const std::vector<internal::Node>& values) {
+        return callback(Term::nodeVectorToTerms(&d_tm, values));
+      },
+      ibounds,
+      iboundCallback);
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
+std::vector<Term> Solver::getObjectiveValues() const
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  //////// all checks before this line
+  return Term::nodeVectorToTerms(&d_tm, d_slv->getObjectiveValues());
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
 Term Solver::getQuantifierElimination(const Term& q) const
 {
   CVC5_API_TRY_CATCH_BEGIN;
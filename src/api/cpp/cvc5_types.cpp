@@ -213,6 +213,51 @@ std::string to_string(cvc5::modes::FindSynthTarget target)
 }
 }  // namespace std
 
+namespace cvc5::modes {
+std::ostream& operator<<(std::ostream& out, ObjectiveType type)
+{
+  switch (type)
+  {
+    case ObjectiveType::MINIMIZE: out << "minimize"; break;
+    case ObjectiveType::MAXIMIZE: out << "maximize"; break;
+    default: out << "?";
+  }
+  return out;
+}
+}  // namespace cvc5::modes
+
+namespace std {
+std::string to_string(cvc5::modes::ObjectiveType type)
+{
+  std::stringstream ss;
+  ss << type;
+  return ss.str();
+}
+}  // namespace std
+
+namespace cvc5::modes {
+std::ostream& operator<<(std::ostream& out, OptimizationMode mode)
+{
+  switch (mode)
+  {
+    case OptimizationMode::LEX: out << "lex"; break;
+    case OptimizationMode::PARETO: out << "pareto"; break;
+    case OptimizationMode::BOX: out << "box"; break;
+    default: out << "?";
+  }
+  return out;
+}
+}  // namespace cvc5::modes
+
+namespace std {
+std::string to_string(cvc5::modes::OptimizationMode mode)
+{
+  std::stringstream ss;
+  ss << mode;
+  return ss.str();
+}
+}  // namespace std
+
 namespace cvc5::modes {
 std::ostream& operator<<(std::ostream& out, InputLanguage lang)
 {
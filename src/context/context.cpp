@@ -22,9 +22,11 @@
 
 namespace cvc5::context {
 
-Context::Context() : d_pCNOpre(NULL), d_pCNOpost(NULL) {
+Context::Context(const ContextMemoryConfig& config)
+    : d_pCNOpre(NULL), d_pCNOpost(NULL)
+{
   // Create new memory manager
-  d_pCMM = new ContextMemoryManager();
+  d_pCMM = new ContextMemoryManager(config);
 
   // Create initial Scope
   d_scopeList.push_back(new(d_pCMM) Scope(this, d_pCMM, 0));
@@ -138,9 +138,10 @@ public:
   };/* Context::ScopedPush */
 
   /**
-   * Constructor: create ContextMemoryManager and initial Scope
+   * Constructor: create ContextMemoryManager with the given configuration and
+   * initial Scope
    */
-  Context();
+  Context(const ContextMemoryConfig& config = {});
 
   /**
    * Destructor: pop all scopes, delete ContextMemoryManager
@@ -205,7 +206,7 @@ private:
   UserContext(const UserContext&) = delete;
   UserContext& operator=(const UserContext&) = delete;
 public:
-  UserContext() {}
+  UserContext(const ContextMemoryConfig& config = {}) : Context(config) {}
 };/* class UserContext */
 
 
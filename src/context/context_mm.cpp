@@ -13,6 +13,7 @@
  * Implementation of Context Memory Manager
  */
 
+#include <algorithm>
 #include <cstdlib>
 #include <deque>
 #include <limits>
@@ -24,6 +25,13 @@
 #include <valgrind/memcheck.h>
 #endif /* CVC5_VALGRIND */
 
+#if defined(__linux__) && !defined(CVC5_DEBUG_CONTEXT_MEMORY_MANAGER)
+#include <sys/mman.h>
+#ifdef MADV_HUGEPAGE
+#define CVC5_HAVE_HUGE_PAGES
+#endif
+#endif
+
 #include "base/check.h"
 #include "base/output.h"
 #include "context/context_mm.h"
@@ -32,6 +40,49 @@ namespace cvc5::context {
 
 #ifndef CVC5_DEBUG_CONTEXT_MEMORY_MANAGER
 
+char* ContextMemoryManager::allocateChunk()
+{
+#ifdef CVC5_HAVE_HUGE_PAGES
+  if (d_hugePages)
+  {
+    // A slab holds at least one chunk, and its size is a multiple of the size
+    // of a huge page
+    size_t slabSize =
+        (d_chunkSize + slabSizeBytes - 1) / slabSizeBytes * slabSizeBytes;
+    void* slab = NULL;
+    if (posix_memalign(&slab, slabSizeBytes, slabSize) != 0)
+    {
+      throw std::bad_alloc();
+    }
+    // only a hint, which fails if transparent huge pages are disabled
+    madvise(slab, slabSize, MADV_HUGEPAGE);
+    d_slabs.push_back(slab);
+#ifdef CVC5_VALGRIND
+    VALGRIND_MAKE_MEM_NOACCESS(slab, slabSize);
+#endif /* CVC5_VALGRIND */
+    char* chunk = static_cast<char*>(slab);
+    size_t n = slabSize / d_chunkSize;
+    d_stats.d_chunksAllocated += n;
+    // the remaining chunks are used in ascending order
+    for (size_t i = n - 1; i > 0; --i)
+    {
+      d_freeChunks.push_back(chunk + i * d_chunkSize);
+    }
+    return chunk;
+  }
+#endif /* CVC5_HAVE_HUGE_PAGES */
+  char* chunk = (char*)malloc(d_chunkSize);
+  if (chunk == NULL)
+  {
+    throw std::bad_alloc();
+  }
+  ++d_stats.d_chunksAllocated;
+#ifdef CVC5_VALGRIND
+  VALGRIND_MAKE_MEM_NOACCESS(chunk, d_chunkSize);
+#endif /* CVC5_VALGRIND */
+  return chunk;
+}
+
 void ContextMemoryManager::newChunk() {
 
   // Increment index to chunk list
@@ -41,38 +92,47 @@ void ContextMemoryManager::newChunk() {
 
   // Create new chunk if no free chunk available
   if(d_freeChunks.empty()) {
-    d_chunkList.push_back((char*)malloc(chunkSizeBytes));
-    if(d_chunkList.back() == NULL) {
-      throw std::bad_alloc();
-    }
-
-#ifdef CVC5_VALGRIND
-    VALGRIND_MAKE_MEM_NOACCESS(d_chunkList.back(), chunkSizeBytes);
-#endif /* CVC5_VALGRIND */
+    d_chunkList.push_back(allocateChunk());
   }
   // If there is a free chunk, use that
   else {
     d_chunkList.push_back(d_freeChunks.back());
     d_freeChunks.pop_back();
+    ++d_stats.d_chunksReused;
+  }
+  if (d_chunkList.size() > d_recentPeak)
+  {
+    d_recentPeak = d_chunkList.size();
+    if (d_recentPeak > d_stats.d_maxChunksInUse)
+    {
+      d_stats.d_maxChunksInUse = d_recentPeak;
+    }
   }
   // Set up the current chunk pointers
   d_nextFree = d_chunkList.back();
-  d_endChunk = d_nextFree + chunkSizeBytes;
+  d_endChunk = d_nextFree + d_chunkSize;
 }
 
 
-ContextMemoryManager::ContextMemoryManager() : d_indexChunkList(0) {
+ContextMemoryManager::ContextMemoryManager(const ContextMemoryConfig& config)
+    : d_chunkSize(std::max<size_t>(config.d_chunkSize, chunkSizeBytes)),
+#ifdef CVC5_HAVE_HUGE_PAGES
+      d_hugePages(config.d_hugePages),
+#else
+      d_hugePages(false),
+#endif /* CVC5_HAVE_HUGE_PAGES */
+      d_recentPeak(1),
+      d_popsSinceDecay(0),
+      d_indexChunkList(0)
+{
   // Create initial chunk
-  d_chunkList.push_back((char*)malloc(chunkSizeBytes));
+  d_chunkList.push_back(allocateChunk());
   d_nextFree = d_chunkList.back();
-  if(d_nextFree == NULL) {
-    throw std::bad_alloc();
-  }
-  d_endChunk = d_nextFree + chunkSizeBytes;
+  d_endChunk = d_nextFree + d_chunkSize;
+  d_stats.d_maxChunksInUse = 1;
 
 #ifdef CVC5_VALGRIND
   VALGRIND_CREATE_MEMPOOL(this, 0, false);
-  VALGRIND_MAKE_MEM_NOACCESS(d_nextFree, chunkSizeBytes);
   d_allocations.push_back(std::vector<char*>());
 #endif /* CVC5_VALGRIND */
 }
@@ -83,6 +143,15 @@ ContextMemoryManager::~ContextMemoryManager() {
   VALGRIND_DESTROY_MEMPOOL(this);
 #endif /* CVC5_VALGRIND */
 
+  if (d_hugePages)
+  {
+    // all chunks are part of the slabs
+    for (void* slab : d_slabs)
+    {
+      free(slab);
+    }
+    return;
+  }
   // Delete all chunks
   while(!d_chunkList.empty()) {
     free(d_chunkList.back());
@@ -150,17 +219,32 @@ void ContextMemoryManager::pop() {
   while(d_indexChunkList > d_indexChunkListStack.back()) {
     d_freeChunks.push_back(d_chunkList.back());
 #ifdef CVC5_VALGRIND
-    VALGRIND_MAKE_MEM_NOACCESS(d_chunkList.back(), chunkSizeBytes);
+    VALGRIND_MAKE_MEM_NOACCESS(d_chunkList.back(), d_chunkSize);
 #endif /* CVC5_VALGRIND */
     d_chunkList.pop_back();
     --d_indexChunkList;
   }
   d_indexChunkListStack.pop_back();
 
-  // Delete excess free chunks
-  while(d_freeChunks.size() > maxFreeChunks) {
+  if (++d_popsSinceDecay == retentionWindow)
+  {
+    d_popsSinceDecay = 0;
+    d_recentPeak = std::max(d_chunkList.size(), d_recentPeak / 2);
+  }
+  if (d_hugePages)
+  {
+    // chunks of slabs cannot be returned individually
+    return;
+  }
+  // Delete excess free chunks, we retain enough chunks to reach the recent
+  // peak again
+  size_t maxFree = std::max<size_t>(maxFreeChunks,
+                                    d_recentPeak - d_chunkList.size());
+  while (d_freeChunks.size() > maxFree)
+  {
     free(d_freeChunks.front());
     d_freeChunks.pop_front();
+    ++d_stats.d_chunksFreed;
   }
 }
 #else
@@ -25,10 +25,45 @@
 #endif
 #include <cvc5/cvc5_export.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace cvc5::context {
 
+/**
+ * The configuration of a ContextMemoryManager.
+ */
+struct CVC5_EXPORT ContextMemoryConfig
+{
+  /**
+   * The size of a chunk in bytes. Sizes below the default chunk size are
+   * raised to it.
+   */
+  size_t d_chunkSize = 16384;
+  /**
+   * Whether chunks are carved from slabs of 2 MiB that are backed by
+   * transparent huge pages where supported. The memory of slabs is only
+   * returned to the system when the memory manager is destroyed.
+   */
+  bool d_hugePages = false;
+};
+
+/**
+ * Statistics on the chunks of a ContextMemoryManager.
+ */
+struct CVC5_EXPORT ContextMemoryStatistics
+{
+  /** The number of chunks that were allocated from the system */
+  uint64_t d_chunksAllocated = 0;
+  /** The number of chunks that were returned to the system */
+  uint64_t d_chunksFreed = 0;
+  /** The number of chunks that were reused from the free list */
+  uint64_t d_chunksReused = 0;
+  /** The maximal number of chunks in use at the same time */
+  uint64_t d_maxChunksInUse = 0;
+};
+
 #ifndef CVC5_DEBUG_CONTEXT_MEMORY_MANAGER
 
 /**
@@ -44,21 +79,54 @@ namespace cvc5::context {
 class CVC5_EXPORT ContextMemoryManager
 {
   /**
-   * Memory in regions is allocated in chunks.  This is the chunk size
+   * Memory in regions is allocated in chunks.  This is the default and
+   * minimal chunk size.
    */
   static const unsigned chunkSizeBytes = 16384;
 
   /**
-   * A list of free chunks is maintained.  This is the maximum number of
-   * free chunks.
+   * A list of free chunks is maintained.  This is the minimal number of free
+   * chunks that are retained, see d_recentPeak.
    */
   static const unsigned maxFreeChunks = 100;
 
+  /**
+   * The number of pops after which d_recentPeak decays.
+   */
+  static const unsigned retentionWindow = 1024;
+
+  /** The size of a slab if huge pages are used */
+  static const size_t slabSizeBytes = 2 * 1024 * 1024;
+
+  /** The size of a chunk */
+  size_t d_chunkSize;
+
+  /** Whether chunks are carved from slabs backed by huge pages */
+  bool d_hugePages;
+
   /**
    * List of all chunks that are currently active
    */
   std::vector<char*> d_chunkList;
 
+  /** The slabs that chunks were carved from if huge pages are used */
+  std::vector<void*> d_slabs;
+
+  /**
+   * The peak number of chunks in use during the recent pops. Up to this many
+   * chunks are kept in use or on the free list, such that repeated push/pop
+   * cycles to the same depth do not go back to the system allocator. It is
+   * halved every retentionWindow pops, such that the memory of a single deep
+   * excursion is eventually released.
+   */
+  size_t d_recentPeak;
+
+  /** The number of pops since d_recentPeak last decayed */
+  unsigned d_popsSinceDecay;
+
+  /** The statistics */
+  ContextMemoryStatistics d_stats;
+
   /**
    * Queue of free chunks (for best cache performance, LIFO order is used)
    */
@@ -106,6 +174,12 @@ class CVC5_EXPORT ContextMemoryManager
    */
   void newChunk();
 
+  /**
+   * Allocate a new chunk from the system.  If huge pages are used, a slab is
+   * allocated whose remaining chunks are put on the free list.
+   */
+  char* allocateChunk();
+
 #ifdef CVC5_VALGRIND
   /**
    * Vector of allocations for each level. Used for accurately marking
@@ -125,7 +199,7 @@ class CVC5_EXPORT ContextMemoryManager
   /**
    * Constructor - creates an initial region and an empty stack
    */
-  ContextMemoryManager();
+  ContextMemoryManager(const ContextMemoryConfig& config = {});
 
   /**
    * Destructor - deletes all memory in all regions
@@ -148,6 +222,11 @@ class CVC5_EXPORT ContextMemoryManager
    */
   void pop();
 
+  /**
+   * Get the statistics on the chunks of this memory manager.
+   */
+  const ContextMemoryStatistics& getStatistics() const { return d_stats; }
+
 }; /* class ContextMemoryManager */
 
 #else /* CVC5_DEBUG_CONTEXT_MEMORY_MANAGER */
@@ -165,7 +244,10 @@ class ContextMemoryManager
  public:
   static unsigned getMaxAllocationSize();
 
-  ContextMemoryManager() { d_allocations.push_back(std::vector<char*>()); }
+  ContextMemoryManager(const ContextMemoryConfig& config = {})
+  {
+    d_allocations.push_back(std::vector<char*>());
+  }
   ~ContextMemoryManager()
   {
     for (const auto& levelAllocs : d_allocations)
@@ -195,8 +277,11 @@ class ContextMemoryManager
     d_allocations.pop_back();
   }
 
+  const ContextMemoryStatistics& getStatistics() const { return d_stats; }
+
  private:
   std::vector<std::vector<char*>> d_allocations;
+  ContextMemoryStatistics d_stats;
 }; /* ContextMemoryManager */
 
 #endif /* CVC5_DEBUG_CONTEXT_MEMORY_MANAGER */
@@ -529,12 +529,14 @@ void AttributeManager::reconstructTable(AttrHash<T>& table){
 template <class AttrKind>
 inline typename AttrKind::value_type
 NodeManager::getAttribute(expr::NodeValue* nv, const AttrKind&) const {
+  Guard guard(this);
   return d_attrManager->getAttribute(nv, AttrKind());
 }
 
 template <class AttrKind>
 inline bool NodeManager::hasAttribute(expr::NodeValue* nv,
                                       const AttrKind&) const {
+  Guard guard(this);
   return d_attrManager->hasAttribute(nv, AttrKind());
 }
 
@@ -542,6 +544,7 @@ template <class AttrKind>
 inline bool
 NodeManager::getAttribute(expr::NodeValue* nv, const AttrKind&,
                           typename AttrKind::value_type& ret) const {
+  Guard guard(this);
   return d_attrManager->getAttribute(nv, AttrKind(), ret);
 }
 
@@ -549,18 +552,21 @@ template <class AttrKind>
 inline void
 NodeManager::setAttribute(expr::NodeValue* nv, const AttrKind&,
                           const typename AttrKind::value_type& value) {
+  Guard guard(this);
   d_attrManager->setAttribute(nv, AttrKind(), value);
 }
 
 template <class AttrKind>
 inline typename AttrKind::value_type
 NodeManager::getAttribute(TNode n, const AttrKind&) const {
+  Guard guard(this);
   return d_attrManager->getAttribute(n.d_nv, AttrKind());
 }
 
 template <class AttrKind>
 inline bool
 NodeManager::hasAttribute(TNode n, const AttrKind&) const {
+  Guard guard(this);
   return d_attrManager->hasAttribute(n.d_nv, AttrKind());
 }
 
@@ -568,6 +574,7 @@ template <class AttrKind>
 inline bool
 NodeManager::getAttribute(TNode n, const AttrKind&,
                           typename AttrKind::value_type& ret) const {
+  Guard guard(this);
   return d_attrManager->getAttribute(n.d_nv, AttrKind(), ret);
 }
 
@@ -575,18 +582,21 @@ template <class AttrKind>
 inline void
 NodeManager::setAttribute(TNode n, const AttrKind&,
                           const typename AttrKind::value_type& value) {
+  Guard guard(this);
   d_attrManager->setAttribute(n.d_nv, AttrKind(), value);
 }
 
 template <class AttrKind>
 inline typename AttrKind::value_type
 NodeManager::getAttribute(TypeNode n, const AttrKind&) const {
+  Guard guard(this);
   return d_attrManager->getAttribute(n.d_nv, AttrKind());
 }
 
 template <class AttrKind>
 inline bool
 NodeManager::hasAttribute(TypeNode n, const AttrKind&) const {
+  Guard guard(this);
   return d_attrManager->hasAttribute(n.d_nv, AttrKind());
 }
 
@@ -594,6 +604,7 @@ template <class AttrKind>
 inline bool
 NodeManager::getAttribute(TypeNode n, const AttrKind&,
                           typename AttrKind::value_type& ret) const {
+  Guard guard(this);
   return d_attrManager->getAttribute(n.d_nv, AttrKind(), ret);
 }
 
@@ -601,6 +612,7 @@ template <class AttrKind>
 inline void
 NodeManager::setAttribute(TypeNode n, const AttrKind&,
                           const typename AttrKind::value_type& value) {
+  Guard guard(this);
   d_attrManager->setAttribute(n.d_nv, AttrKind(), value);
 }
 
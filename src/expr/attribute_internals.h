@@ -26,7 +26,12 @@
 #ifndef CVC5__EXPR__ATTRIBUTE_INTERNALS_H
 #define CVC5__EXPR__ATTRIBUTE_INTERNALS_H
 
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace cvc5::internal {
 namespace expr {
@@ -148,13 +153,321 @@ inline uint64_t GetBitSet(uint64_t bit)
   return kOne << bit;
 }
 
+/**
+ * A map from node values to values of type T, which is the top level of the
+ * attribute tables.
+ *
+ * Node values are indexed by their id, which is dense since ids are assigned
+ * consecutively by the node manager. The ids are split into pages of
+ * PAGE_SIZE consecutive ids. A page stores its entries in a vector sorted by
+ * node value as long as it is sparse, and in an array indexed by the id once
+ * it holds DENSE_THRESHOLD entries. Hence, looking up the attributes of a
+ * node value does not hash, and attributes that are set on many node values
+ * (e.g., types and rewrites) are found with two indirections, whereas
+ * attributes that are set on few node values take little space. Pages
+ * without entries are freed.
+ *
+ * Erasing an entry invalidates the iterators to the entries of its page,
+ * other than the one returned by erase. Inserting an entry invalidates all
+ * iterators.
+ */
+template <class T>
+class NodeValueMap
+{
+ public:
+  using value_type = std::pair<NodeValue*, T>;
+
+ private:
+  /** The number of bits of the id of a node value within its page */
+  static constexpr uint64_t PAGE_BITS = 10;
+  /** The number of ids of a page */
+  static constexpr size_t PAGE_SIZE = static_cast<size_t>(1) << PAGE_BITS;
+  /** The number of entries at which a page becomes dense */
+  static constexpr size_t DENSE_THRESHOLD = PAGE_SIZE / 8;
+
+  struct Page
+  {
+    /** The entries sorted by node value, while the page is sparse */
+    std::vector<value_type> d_sparse;
+    /** The entries indexed by id, or null while the page is sparse */
+    std::unique_ptr<value_type[]> d_dense;
+    /** The number of entries */
+    size_t d_size = 0;
+  };
+
+  /** Compares entries of a sparse page */
+  struct Less
+  {
+    bool operator()(const value_type& a, const NodeValue* nv) const
+    {
+      return std::less<const NodeValue*>()(a.first, nv);
+    }
+  };
+
+  template <bool isConst>
+  class Iter
+  {
+    friend class NodeValueMap;
+    template <bool>
+    friend class Iter;
+    using Map = std::conditional_t<isConst, const NodeValueMap, NodeValueMap>;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename NodeValueMap::value_type;
+    using reference =
+        std::conditional_t<isConst, const value_type&, value_type&>;
+    using pointer = std::conditional_t<isConst, const value_type*, value_type*>;
+    using difference_type = std::ptrdiff_t;
+
+    Iter() : d_map(nullptr), d_page(0), d_slot(0) {}
+    /** Conversion of an iterator to a const iterator */
+    template <bool c = isConst, typename = std::enable_if_t<c>>
+    Iter(const Iter<false>& it)
+        : d_map(it.d_map), d_page(it.d_page), d_slot(it.d_slot)
+    {
+    }
+
+    reference operator*() const { return d_map->entry(d_page, d_slot); }
+    pointer operator->() const { return &d_map->entry(d_page, d_slot); }
+
+    Iter& operator++()
+    {
+      ++d_slot;
+      d_map->legalize(d_page, d_slot);
+      return *this;
+    }
+    Iter operator++(int)
+    {
+      Iter tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    bool operator==(const Iter& other) const
+    {
+      return d_page == other.d_page && d_slot == other.d_slot;
+    }
+    bool operator!=(const Iter& other) const { return !(*this == other); }
+
+   private:
+    Iter(Map* map, size_t page, size_t slot)
+        : d_map(map), d_page(page), d_slot(slot)
+    {
+    }
+    /** The map */
+    Map* d_map;
+    /** The index of the page */
+    size_t d_page;
+    /** The index of the entry within the dense array or sparse vector */
+    size_t d_slot;
+  };
+
+ public:
+  using iterator = Iter<false>;
+  using const_iterator = Iter<true>;
+
+  NodeValueMap() : d_size(0) {}
+
+  iterator begin()
+  {
+    size_t page = 0, slot = 0;
+    legalize(page, slot);
+    return iterator(this, page, slot);
+  }
+  iterator end() { return iterator(this, d_pages.size(), 0); }
+  const_iterator begin() const
+  {
+    size_t page = 0, slot = 0;
+    legalize(page, slot);
+    return const_iterator(this, page, slot);
+  }
+  const_iterator end() const { return const_iterator(this, d_pages.size(), 0); }
+
+  size_t size() const { return d_size; }
+  bool empty() const { return d_size == 0; }
+
+  iterator find(NodeValue* nv)
+  {
+    size_t page, slot;
+    return locate(nv, page, slot) ? iterator(this, page, slot) : end();
+  }
+  const_iterator find(NodeValue* nv) const
+  {
+    size_t page, slot;
+    return locate(nv, page, slot) ? const_iterator(this, page, slot) : end();
+  }
+
+  /** Get the value of nv, inserting a default value if there is none */
+  T& operator[](NodeValue* nv)
+  {
+    uint64_t id = nv->getId();
+    size_t page = static_cast<size_t>(id >> PAGE_BITS);
+    if (page >= d_pages.size())
+    {
+      d_pages.resize(page + 1);
+    }
+    if (d_pages[page] == nullptr)
+    {
+      d_pages[page].reset(new Page());
+    }
+    Page& p = *d_pages[page];
+    if (p.d_dense == nullptr)
+    {
+      auto it = std::lower_bound(
+          p.d_sparse.begin(), p.d_sparse.end(), nv, Less());
+      if (it != p.d_sparse.end() && it->first == nv)
+      {
+        return it->second;
+      }
+      if (p.d_sparse.size() + 1 < DENSE_THRESHOLD)
+      {
+        ++p.d_size;
+        ++d_size;
+        return p.d_sparse.insert(it, value_type(nv, T()))->second;
+      }
+      makeDense(p);
+    }
+    value_type& e = p.d_dense[id & (PAGE_SIZE - 1)];
+    if (e.first == nullptr)
+    {
+      e.first = nv;
+      ++p.d_size;
+      ++d_size;
+    }
+    return e.second;
+  }
+
+  /** Erase the entry at it, returns the iterator to the next entry */
+  iterator erase(iterator it)
+  {
+    size_t page = it.d_page, slot = it.d_slot;
+    Page& p = *d_pages[page];
+    if (p.d_dense != nullptr)
+    {
+      p.d_dense[slot] = value_type(nullptr, T());
+      ++slot;
+    }
+    else
+    {
+      // the following entries are shifted to slot
+      p.d_sparse.erase(p.d_sparse.begin() + slot);
+    }
+    --p.d_size;
+    --d_size;
+    if (p.d_size == 0)
+    {
+      d_pages[page].reset();
+      ++page;
+      slot = 0;
+    }
+    legalize(page, slot);
+    return iterator(this, page, slot);
+  }
+  /** Erase the entry of nv, if any */
+  void erase(NodeValue* nv)
+  {
+    iterator it = find(nv);
+    if (it != end())
+    {
+      erase(it);
+    }
+  }
+
+  void clear()
+  {
+    d_pages.clear();
+    d_size = 0;
+  }
+
+ private:
+  /**
+   * Sets page and slot to the position of nv. Returns false if nv has no
+   * entry.
+   */
+  bool locate(NodeValue* nv, size_t& page, size_t& slot) const
+  {
+    uint64_t id = nv->getId();
+    page = static_cast<size_t>(id >> PAGE_BITS);
+    if (page >= d_pages.size() || d_pages[page] == nullptr)
+    {
+      return false;
+    }
+    const Page& p = *d_pages[page];
+    if (p.d_dense != nullptr)
+    {
+      slot = static_cast<size_t>(id & (PAGE_SIZE - 1));
+      return p.d_dense[slot].first == nv;
+    }
+    auto it =
+        std::lower_bound(p.d_sparse.begin(), p.d_sparse.end(), nv, Less());
+    slot = static_cast<size_t>(it - p.d_sparse.begin());
+    return it != p.d_sparse.end() && it->first == nv;
+  }
+
+  /** Get the entry at the given position */
+  value_type& entry(size_t page, size_t slot) const
+  {
+    Page& p = *d_pages[page];
+    return p.d_dense != nullptr ? p.d_dense[slot] : p.d_sparse[slot];
+  }
+
+  /**
+   * Move the position given by page and slot forward to the next entry, or
+   * to the end if there is none.
+   */
+  void legalize(size_t& page, size_t& slot) const
+  {
+    for (size_t npages = d_pages.size(); page < npages; ++page, slot = 0)
+    {
+      const Page* p = d_pages[page].get();
+      if (p == nullptr)
+      {
+        continue;
+      }
+      if (p->d_dense == nullptr)
+      {
+        if (slot < p->d_sparse.size())
+        {
+          return;
+        }
+        continue;
+      }
+      for (; slot < PAGE_SIZE; ++slot)
+      {
+        if (p->d_dense[slot].first != nullptr)
+        {
+          return;
+        }
+      }
+    }
+    slot = 0;
+  }
+
+  /** Move the entries of the sparse page p to its dense array */
+  static void makeDense(Page& p)
+  {
+    p.d_dense.reset(new value_type[PAGE_SIZE]());
+    for (value_type& e : p.d_sparse)
+    {
+      p.d_dense[e.first->getId() & (PAGE_SIZE - 1)] = std::move(e);
+    }
+    std::vector<value_type>().swap(p.d_sparse);
+  }
+
+  /** The pages, indexed by the ids of their node values shifted by PAGE_BITS */
+  std::vector<std::unique_ptr<Page>> d_pages;
+  /** The number of entries */
+  size_t d_size;
+}; /* class NodeValueMap<> */
+
 /**
  * An "AttrHash<V>"---the hash table underlying
  * attributes---is a mapping of pair<unique-attribute-id, Node>
- * to V using a two-level hash+flat_map structure. The top level
- * uses NodeValue* as its key, allowing rapid deletion of matching
- * collections of entries, while the second level, keyed on Ids
- * and implemented with a sorted vector, optimizes for size and
+ * to V using a two-level NodeValueMap+flat_map structure. The top
+ * level uses NodeValue* as its key, allowing rapid deletion of
+ * matching collections of entries, while the second level, keyed on
+ * Ids and implemented with a sorted vector, optimizes for size and
  * speed for small collections.
  */
 template <class V>
@@ -283,7 +596,7 @@ class AttrHash
     Container d_contents;
   };
 
-  // a composite iterator combining a top-level (std::unordered_map)
+  // a composite iterator combining a top-level (NodeValueMap)
   // iterator with a lower-level (IdMap) iterator to preserve the
   // illusion of a single map. Together they identify a virtual
   // element pair<pair<uint64_t, NodeValue*>, V> expected by
@@ -392,14 +705,14 @@ class AttrHash
     /** The AttrHash this iterator belongs to */
     Parent* d_parent;
 
-    /** Iterator within the top-level std::unordered_map */
+    /** Iterator within the top-level NodeValueMap */
     L1It d_l1It;
 
     /** Iterator within the second level IdMap (sorted vector) */
     L2It d_l2It;
   };
 
-  using Storage = std::unordered_map<NodeValue*, IdMap, AttrBoolHashFunction>;
+  using Storage = NodeValueMap<IdMap>;
 
  public:
   using iterator = Iterator<AttrHash<V>,
@@ -434,15 +747,19 @@ class AttrHash
     // reach inside the iterator to get L1/L2 positions
     auto nextL2It = it.d_l1It->second.erase(it.d_l2It);
 
-    iterator nextIt(this, it.d_l1It, nextL2It);
-    nextIt.legalize();
-
     if (it.d_l1It->second.empty())
     {
       // this erase has made the L2 map empty. delete it:
-      d_storage.erase(it.d_l1It);
+      typename Storage::iterator nextL1It = d_storage.erase(it.d_l1It);
+      if (nextL1It == d_storage.end())
+      {
+        return iterator();
+      }
+      return iterator(this, nextL1It, nextL1It->second.begin());
     }
 
+    iterator nextIt(this, it.d_l1It, nextL2It);
+    nextIt.legalize();
     return nextIt;
   }
 
@@ -462,21 +779,7 @@ class AttrHash
                      && (a.first.first < b.first.first));
         });
 
-    auto find_different_nv = [](NodeValue* nv, EntryIt first, EntryIt last) {
-      return std::find_if(
-          first, last, [nv](const Entry& a) { return a.first.second != nv; });
-    };
-
-    // determine number of new L1 entries required (count unique NodeValue*s)
-    std::size_t l1_unique_count = 0;
     auto last = entries.end();
-    for (EntryIt it = entries.begin(); it != last;
-         it = find_different_nv(it->first.second, it, entries.end()))
-    {
-      ++l1_unique_count;
-    }
-    // pre-allocate enough space for the new L1 entries (for speed)
-    d_storage.reserve(d_storage.size() + l1_unique_count);
 
     // add new entries one (same NodeValue*) chunk at a time
     for (EntryIt it = entries.begin(); it != last;)
@@ -534,16 +837,14 @@ class AttrHash
 
 /**
  * In the case of Boolean-valued attributes we have a special
- * "AttrHash<bool>" to pack bits together in words.
+ * "AttrHash<bool>" to pack bits together in words, which are stored
+ * in a NodeValueMap.
  */
 template <>
-class AttrHash<bool> :
-    protected std::unordered_map<NodeValue*,
-                                  uint64_t,
-                                  AttrBoolHashFunction> {
+class AttrHash<bool> {
 
-  /** A "super" type, like in Java, for easy reference below. */
-  typedef std::unordered_map<NodeValue*, uint64_t, AttrBoolHashFunction> super;
+  /** The map from node values to their words of flags */
+  typedef NodeValueMap<uint64_t> super;
 
   /**
    * BitAccessor allows us to return a bit "by reference."  Of course,
@@ -582,7 +883,7 @@ class AttrHash<bool> :
    */
   class BitIterator {
 
-    std::pair<NodeValue* const, uint64_t>* d_entry;
+    std::pair<NodeValue*, uint64_t>* d_entry;
 
     uint64_t d_bit;
 
@@ -593,12 +894,12 @@ class AttrHash<bool> :
       d_bit(0) {
     }
 
-    BitIterator(std::pair<NodeValue* const, uint64_t>& entry, uint64_t bit)
+    BitIterator(std::pair<NodeValue*, uint64_t>& entry, uint64_t bit)
         : d_entry(&entry), d_bit(bit)
     {
     }
 
-    std::pair<NodeValue* const, BitAccessor> operator*() {
+    std::pair<NodeValue*, BitAccessor> operator*() {
       return std::make_pair(d_entry->first,
                             BitAccessor(d_entry->second, d_bit));
     }
@@ -616,7 +917,7 @@ class AttrHash<bool> :
    */
   class ConstBitIterator {
 
-    const std::pair<NodeValue* const, uint64_t>* d_entry;
+    const std::pair<NodeValue*, uint64_t>* d_entry;
 
     uint64_t d_bit;
 
@@ -627,13 +928,13 @@ class AttrHash<bool> :
       d_bit(0) {
     }
 
-    ConstBitIterator(const std::pair<NodeValue* const, uint64_t>& entry,
+    ConstBitIterator(const std::pair<NodeValue*, uint64_t>& entry,
                      uint64_t bit)
         : d_entry(&entry), d_bit(bit)
     {
     }
 
-    std::pair<NodeValue* const, bool> operator*()
+    std::pair<NodeValue*, bool> operator*()
     {
       return std::make_pair(
           d_entry->first, (d_entry->second & GetBitSet(d_bit)) ? true : false);
@@ -660,8 +961,8 @@ public:
    * end() if not found.
    */
   BitIterator find(const std::pair<uint64_t, NodeValue*>& k) {
-    super::iterator i = super::find(k.second);
-    if(i == super::end()) {
+    super::iterator i = d_words.find(k.second);
+    if(i == d_words.end()) {
       return BitIterator();
     }
     /*
@@ -684,8 +985,8 @@ public:
    * end() if not found.
    */
   ConstBitIterator find(const std::pair<uint64_t, NodeValue*>& k) const {
-    super::const_iterator i = super::find(k.second);
-    if(i == super::end()) {
+    super::const_iterator i = d_words.find(k.second);
+    if(i == d_words.end()) {
       return ConstBitIterator();
     }
     /*
@@ -709,7 +1010,7 @@ public:
    * already there.
    */
   BitAccessor operator[](const std::pair<uint64_t, NodeValue*>& k) {
-    uint64_t& word = super::operator[](k.second);
+    uint64_t& word = d_words[k.second];
     return BitAccessor(word, k.first);
   }
 
@@ -717,25 +1018,29 @@ public:
    * Delete all flags from the given node.
    */
   void erase(NodeValue* nv) {
-    super::erase(nv);
+    d_words.erase(nv);
   }
 
   /**
    * Clear the hash table.
    */
   void clear() {
-    super::clear();
+    d_words.clear();
   }
 
   /** Is the hash table empty? */
   bool empty() const {
-    return super::empty();
+    return d_words.empty();
   }
 
   /** This is currently very misleading! */
   size_t size() const {
-    return super::size();
+    return d_words.size();
   }
+
+ private:
+  /** The words of flags of the node values */
+  super d_words;
 };/* class AttrHash<bool> */
 
 }  // namespace attr
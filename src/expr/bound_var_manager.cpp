@@ -59,6 +59,7 @@ Node BoundVarManager::getCacheValue(TNode cv, size_t i)
 
 Node BoundVarManager::mkBoundVar(BoundVarId id, Node n, TypeNode tn)
 {
+  NodeManager::Guard guard(tn.getNodeManager());
   std::tuple<BoundVarId, TypeNode, Node> key(id, tn, n);
   std::map<std::tuple<BoundVarId, TypeNode, Node>, Node>::iterator it =
       d_cache.find(key);
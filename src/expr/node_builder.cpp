@@ -340,10 +340,19 @@ void NodeBuilder::decrRefCounts()
   d_inlineNv.d_nchildren = 0;
 }
 
-TypeNode NodeBuilder::constructTypeNode() { return TypeNode(constructNV()); }
+// The node value returned by constructNV() may be taken from the pool of the
+// node manager with a reference count of zero, hence the node manager is
+// locked until the reference to it is taken.
+
+TypeNode NodeBuilder::constructTypeNode()
+{
+  NodeManager::Guard guard(d_nm);
+  return TypeNode(constructNV());
+}
 
 Node NodeBuilder::constructNode()
 {
+  NodeManager::Guard guard(d_nm);
   Node n(constructNV());
   maybeCheckType(n);
   return n;
@@ -351,6 +360,7 @@ Node NodeBuilder::constructNode()
 
 Node* NodeBuilder::constructNodePtr()
 {
+  NodeManager::Guard guard(d_nm);
   std::unique_ptr<Node> np(new Node(constructNV()));
   maybeCheckType(*np.get());
   return np.release();
@@ -387,12 +397,7 @@ expr::NodeValue* NodeBuilder::constructNV()
            "no children permitted";
 
     // we have to copy the inline NodeValue out
-    expr::NodeValue* nv =
-        (expr::NodeValue*)std::malloc(sizeof(expr::NodeValue));
-    if (nv == nullptr)
-    {
-      throw std::bad_alloc();
-    }
+    expr::NodeValue* nv = d_nm->d_nvAllocator.allocate(0);
     // there are no children, so we don't have to worry about
     // reference counts in this case.
     nv->d_nchildren = 0;
@@ -437,7 +442,8 @@ expr::NodeValue* NodeBuilder::constructNV()
      ** allocated "inline" in this NodeBuilder. **/
 
     // Lookup the expression value in the pool we already have
-    expr::NodeValue* poolNv = d_nm->poolLookup(&d_inlineNv);
+    size_t hash;
+    expr::NodeValue* poolNv = d_nm->poolLookup(&d_inlineNv, hash);
     // If something else is there, we reuse it
     if (poolNv != nullptr)
     {
@@ -471,13 +477,8 @@ expr::NodeValue* NodeBuilder::constructNV()
        * reference count. */
 
       // create the canonical expression value for this node
-      expr::NodeValue* nv = (expr::NodeValue*)std::malloc(
-          sizeof(expr::NodeValue)
-          + (sizeof(expr::NodeValue*) * d_inlineNv.d_nchildren));
-      if (nv == nullptr)
-      {
-        throw std::bad_alloc();
-      }
+      expr::NodeValue* nv =
+          d_nm->d_nvAllocator.allocate(d_inlineNv.d_nchildren);
       nv->d_nchildren = d_inlineNv.d_nchildren;
       nv->d_kind = d_inlineNv.d_kind;
       nv->d_id = d_nm->d_nextId++;
@@ -492,7 +493,7 @@ expr::NodeValue* NodeBuilder::constructNV()
       setUsed();
 
       // poolNv = nv;
-      d_nm->poolInsert(nv);
+      d_nm->poolInsert(nv, hash);
       if (TraceIsOn("gc"))
       {
         Trace("gc") << "creating node value " << nv << " [" << nv->d_id
@@ -509,7 +510,8 @@ expr::NodeValue* NodeBuilder::constructNV()
      ** buffer that was heap-allocated by this NodeBuilder. **/
 
     // Lookup the expression value in the pool we already have (with insert)
-    expr::NodeValue* poolNv = d_nm->poolLookup(d_nv);
+    size_t hash;
+    expr::NodeValue* poolNv = d_nm->poolLookup(d_nv, hash);
     // If something else is there, we reuse it
     if (poolNv != nullptr)
     {
@@ -537,10 +539,29 @@ expr::NodeValue* NodeBuilder::constructNV()
        * d_nv is repointed to d_inlineNv so that destruction of the
        * NodeBuilder doesn't cause any problems, and the (old) value
        * it had is placed into the NodeManager's pool and returned in
-       * a Node wrapper. */
+       * a Node wrapper.  If the node value is small enough to be
+       * allocated by the slab allocator of the NodeManager, it is
+       * copied into a slot of the allocator instead. */
 
-      crop();
-      expr::NodeValue* nv = d_nv;
+      expr::NodeValue* nv;
+      size_t nchildren = d_nv->d_nchildren;
+      if (nchildren <= expr::NodeValueAllocator::MAX_SLAB_CHILDREN)
+      {
+        nv = d_nm->d_nvAllocator.allocate(nchildren);
+        nv->d_nchildren = nchildren;
+        nv->d_kind = d_nv->d_kind;
+        nv->d_rc = 0;
+        std::copy(d_nv->d_children, d_nv->d_children + nchildren,
+                  nv->d_children);
+        // the child reference counts are taken over by nv
+        free(d_nv);
+      }
+      else
+      {
+        crop();
+        nv = d_nv;
+        d_nm->d_nvAllocator.adopt(nv, nchildren);
+      }
       nv->d_id = d_nm->d_nextId++;
       nv->d_nm = d_nm;
       d_nv = &d_inlineNv;
@@ -548,7 +569,7 @@ expr::NodeValue* NodeBuilder::constructNV()
       setUsed();
 
       // poolNv = nv;
-      d_nm->poolInsert(nv);
+      d_nm->poolInsert(nv, hash);
       Trace("gc") << "creating node value " << nv << " [" << nv->d_id
                   << "]: " << *nv << "\n";
       return nv;
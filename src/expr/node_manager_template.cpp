@@ -287,13 +287,10 @@ NodeManager::~NodeManager()
   if (TraceIsOn("gc:leaks"))
   {
     Trace("gc:leaks") << "still in pool:" << endl;
-    for (NodeValuePool::const_iterator i = d_nodeValuePool.begin(),
-                                       iend = d_nodeValuePool.end();
-         i != iend;
-         ++i)
+    for (NodeValue* nv : d_nodeValuePool.getNodeValues())
     {
-      Trace("gc:leaks") << "  " << *i << " id=" << (*i)->d_id
-                        << " rc=" << (*i)->d_rc << " " << **i << endl;
+      Trace("gc:leaks") << "  " << nv << " id=" << nv->d_id
+                        << " rc=" << nv->d_rc << " " << *nv << endl;
     }
     Trace("gc:leaks") << ":end:" << endl;
   }
@@ -336,14 +333,24 @@ const DType& NodeManager::getDTypeFor(Node n) const
 
 const DType& NodeManager::getDTypeForIndex(size_t index) const
 {
+  Guard guard(this);
   // if this assertion fails, it is likely due to not managing datatypes
   // properly w.r.t. multiple NodeManagers.
   Assert(index < d_dtypes.size());
   return *d_dtypes[index];
 }
 
+double NodeManager::getBytesPerNodeValue() const
+{
+  Guard guard(this);
+  size_t n = d_nvAllocator.getNumNodeValues();
+  return n == 0 ? 0.0
+                : static_cast<double>(d_nvAllocator.getNumBytes()) / n;
+}
+
 void NodeManager::reclaimZombies()
 {
+  Guard guard(this);
   Assert(!d_attrManager->inGarbageCollection());
 
   Trace("gc") << "reclaiming " << d_zombies.size() << " zombie(s)!\n";
@@ -443,12 +450,35 @@ void NodeManager::reclaimZombies()
         // constant, but then, you should probably use a smart-pointer
         // type for a constant payload.)
         kind::metakind::deleteNodeValueConstant(nv);
+        free(nv);
+      }
+      else
+      {
+        d_nvAllocator.deallocate(nv, nv->d_nchildren);
       }
-      free(nv);
     }
   }
 } /* NodeManager::reclaimZombies() */
 
+#ifdef CVC5_THREAD_SAFE_NODES
+void NodeManager::releaseLastReference(NodeValue* nv)
+{
+  Guard guard(this);
+  // another thread may have taken a reference to nv in the meantime
+  uint32_t rc = nv->d_rc.load(std::memory_order_relaxed);
+  while (rc < NodeValue::MAX_RC
+         && !nv->d_rc.compare_exchange_weak(
+             rc, rc - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+  {
+  }
+  Assert(rc > 0) << "Node reference count would be negative";
+  if (rc == 1)
+  {
+    markForDeletion(nv);
+  }
+}
+#endif
+
 std::vector<NodeValue*> NodeManager::TopologicalSort(
     const std::vector<NodeValue*>& roots)
 {
@@ -654,6 +684,7 @@ std::vector<TypeNode> NodeManager::mkMutualDatatypeTypesInternal(
     const std::vector<DType>& datatypes,
     const std::set<TypeNode>& unresolvedTypes)
 {
+  Guard guard(this);
   std::map<std::string, TypeNode> nameResolutions;
   std::vector<TypeNode> dtts;
 
@@ -971,11 +1002,13 @@ TypeNode NodeManager::mkFunctionType(const std::vector<TypeNode>& argTypes,
 
 TypeNode NodeManager::mkTupleType(const std::vector<TypeNode>& types)
 {
+  Guard guard(this);
   return d_tt_cache.getTupleType(this, types);
 }
 
 TypeNode NodeManager::mkNullableType(const TypeNode& type)
 {
+  Guard guard(this);
   Assert(!type.isNull());
   auto it = d_nt_cache.find(type);
   if (it != d_nt_cache.end())
@@ -1005,6 +1038,7 @@ TypeNode NodeManager::mkNullableType(const TypeNode& type)
 
 TypeNode NodeManager::mkRecordType(const Record& rec)
 {
+  Guard guard(this);
   return d_rt_cache.getRecordType(this, rec);
 }
 
@@ -1042,6 +1076,7 @@ TypeNode NodeManager::mkSortConstructor(const std::string& name,
                                         size_t arity,
                                         bool fresh)
 {
+  Guard guard(this);
   if (!fresh)
   {
     std::pair<std::string, size_t> key(name, arity);
@@ -1082,6 +1117,7 @@ TypeNode NodeManager::mkUnresolvedDatatypeSort(const std::string& name,
 
 Node NodeManager::mkOracle(Oracle& o)
 {
+  Guard guard(this);
   Node n = NodeBuilder(this, Kind::ORACLE);
   n.setAttribute(TypeAttr(), builtinOperatorType());
   n.setAttribute(TypeCheckedAttr(), true);
@@ -1093,6 +1129,7 @@ Node NodeManager::mkOracle(Oracle& o)
 
 const Oracle& NodeManager::getOracleFor(const Node& n) const
 {
+  Guard guard(this);
   Assert(n.getKind() == Kind::ORACLE);
   size_t index = n.getAttribute(OracleIndexAttr());
   Assert(index < d_oracles.size());
@@ -1103,6 +1140,7 @@ Node NodeManager::mkVar(const std::string& name,
                         const TypeNode& type,
                         bool fresh)
 {
+  Guard guard(this);
   if (fresh)
   {
     Node n = NodeBuilder(this, Kind::VARIABLE);
@@ -1281,6 +1319,7 @@ Node NodeManager::mkRawSymbol(const std::string& name, const TypeNode& type)
 
 Node NodeManager::mkNullaryOperator(const TypeNode& type, Kind k)
 {
+  Guard guard(this);
   std::map<TypeNode, Node>::iterator it = d_unique_vars[k].find(type);
   if (it == d_unique_vars[k].end())
   {
@@ -1327,6 +1366,7 @@ TNode NodeManager::operatorOf(Kind k)
 template <class NodeClass, class T>
 NodeClass NodeManager::mkConstInternal(Kind k, const T& val)
 {
+  Guard guard(this);
   NVStorage<1> nvStorage;
   expr::NodeValue& nvStack = reinterpret_cast<expr::NodeValue&>(nvStorage);
 
@@ -1347,7 +1387,8 @@ NodeClass NodeManager::mkConstInternal(Kind k, const T& val)
 
   nvStack.d_children[0] = const_cast<expr::NodeValue*>(
       reinterpret_cast<const expr::NodeValue*>(&val));
-  expr::NodeValue* nv = poolLookup(&nvStack);
+  size_t hash;
+  expr::NodeValue* nv = poolLookup(&nvStack, hash);
 
 #if defined(__GNUC__) \
     && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 6))
@@ -1373,7 +1414,7 @@ NodeClass NodeManager::mkConstInternal(Kind k, const T& val)
 
   new (&nv->d_children) T(val);
 
-  poolInsert(nv);
+  poolInsert(nv, hash);
   if (TraceIsOn("gc"))
   {
     Trace("gc") << "creating node value " << nv << " [" << nv->d_id << "]: ";
@@ -1412,6 +1453,7 @@ bool NodeManager::safeToReclaimZombies() const
 void NodeManager::deleteAttributes(
     const std::vector<const expr::attr::AttributeUniqueId*>& ids)
 {
+  Guard guard(this);
   d_attrManager->deleteAttributes(ids);
 }
 
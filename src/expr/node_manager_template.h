@@ -25,12 +25,17 @@
 #include <string>
 #include <unordered_set>
 #include <vector>
+#ifdef CVC5_THREAD_SAFE_NODES
+#include <mutex>
+#endif
 
 #include "base/check.h"
 #include "expr/internal_skolem_id.h"
 #include "expr/kind.h"
 #include "expr/node_builder.h"
 #include "expr/node_value.h"
+#include "expr/node_value_allocator.h"
+#include "expr/node_value_pool.h"
 #include "util/floatingpoint_size.h"
 
 namespace cvc5 {
@@ -82,6 +87,31 @@ class NodeManager
   /** Destruct the node manager */
   ~NodeManager();
 
+  /**
+   * Acquires the lock of a node manager in builds with thread-safe nodes
+   * (CVC5_THREAD_SAFE_NODES), and does nothing otherwise.
+   *
+   * The lock guards the node value pool, the attribute tables and the caches
+   * of the node manager, such that nodes of the same node manager can be
+   * constructed and used from several threads. It is recursive, since
+   * constructing a node may construct other nodes, e.g., its type.
+   */
+  class Guard
+  {
+   public:
+    explicit Guard(const NodeManager* nm CVC5_UNUSED)
+#ifdef CVC5_THREAD_SAFE_NODES
+        : d_lock(nm->d_mutex)
+#endif
+    {
+    }
+
+   private:
+#ifdef CVC5_THREAD_SAFE_NODES
+    std::lock_guard<std::recursive_mutex> d_lock;
+#endif
+  };
+
   /**
    * Return true if given kind is n-ary. The test is based on n-ary kinds
    * having their maximal arity as the maximal possible number of children
@@ -117,6 +147,13 @@ class NodeManager
   /** Get this node manager's bound variable manager */
   BoundVarManager* getBoundVarManager() { return d_bvManager.get(); }
 
+  /**
+   * Get the average number of bytes reserved per node value of this node
+   * manager, including the unused slots of the slab allocator. Constants,
+   * which are allocated separately, are not counted.
+   */
+  double getBytesPerNodeValue() const;
+
   /**
    * Return the datatype at the given index owned by this class. Type nodes are
    * associated with datatypes through the DatatypeIndexAttr attribute. The
@@ -811,10 +848,6 @@ class NodeManager
       const std::vector<DType>& datatypes,
       const std::set<TypeNode>& unresolvedTypes);
 
-  typedef std::unordered_set<expr::NodeValue*,
-                             expr::NodeValuePoolHashFunction,
-                             expr::NodeValuePoolEq>
-      NodeValuePool;
   typedef std::unordered_set<expr::NodeValue*,
                              expr::NodeValueIDHashFunction,
                              expr::NodeValueIDEquality>
@@ -904,15 +937,21 @@ class NodeManager
    * NULL, the caller should fully construct an equivalent one before
    * calling poolInsert().  NON-FULLY-CONSTRUCTED NODEVALUES are not
    * permitted in the pool!
+   *
+   * The hash of nv is stored in hash, such that an equivalent node value
+   * can be inserted by poolInsert() without hashing it again.
    */
-  expr::NodeValue* poolLookup(expr::NodeValue* nv) const;
+  expr::NodeValue* poolLookup(expr::NodeValue* nv, size_t& hash) const;
 
   /**
-   * Insert a NodeValue into the NodeManager's pool.
+   * Insert a NodeValue into the NodeManager's pool, where hash is the hash
+   * computed by the call to poolLookup() that failed to find it.
    *
    * It is an error to insert a NodeValue already in the pool.
    * Enquire first with poolLookup().
    */
+  void poolInsert(expr::NodeValue* nv, size_t hash);
+  /** Same as above, computing the hash of nv */
   void poolInsert(expr::NodeValue* nv);
 
   /**
@@ -958,12 +997,25 @@ class NodeManager
     }
   }
 
+#ifdef CVC5_THREAD_SAFE_NODES
+  /**
+   * Release a reference to nv, which had a reference count of one when it was
+   * last read. The reference count is decremented while holding the lock of
+   * this node manager, and nv is marked for deletion if it drops to zero.
+   * Since node values with a reference count of zero are only resurrected
+   * from the pool and reclaimed while holding the lock, nv cannot be
+   * reclaimed before it is marked for deletion.
+   */
+  void releaseLastReference(expr::NodeValue* nv);
+#endif
+
   /**
    * Register a NodeValue as having a maxed out reference count. This NodeValue
    * will live as long as its containing NodeManager.
    */
   inline void markRefCountMaxedOut(expr::NodeValue* nv)
   {
+    Guard guard(this);
     Assert(nv->HasMaximizedReferenceCount());
     if (TraceIsOn("gc"))
     {
@@ -1008,16 +1060,27 @@ class NodeManager
   /** Make a new sort with the given name and arity. */
   TypeNode mkSortConstructorInternal(const std::string& name, size_t arity);
 
+  /**
+   * The allocator of the non-constant node values. This is the first member
+   * such that it is destroyed last.
+   */
+  expr::NodeValueAllocator d_nvAllocator;
   /** The skolem manager */
   std::unique_ptr<SkolemManager> d_skManager;
   /** The bound variable manager */
   std::unique_ptr<BoundVarManager> d_bvManager;
 
-  NodeValuePool d_nodeValuePool;
+  /** The hash-consing table of node values */
+  expr::NodeValuePool d_nodeValuePool;
 
   /** The next node identifier */
   size_t d_nextId;
 
+#ifdef CVC5_THREAD_SAFE_NODES
+  /** The lock acquired by Guard */
+  mutable std::recursive_mutex d_mutex;
+#endif
+
   expr::attr::AttributeManager* d_attrManager;
 
   /**
@@ -1100,25 +1163,27 @@ inline TypeNode NodeManager::mkSetType(TypeNode elementType)
   return mkTypeNode(Kind::SET_TYPE, elementType);
 }
 
-inline expr::NodeValue* NodeManager::poolLookup(expr::NodeValue* nv) const {
-  NodeValuePool::const_iterator find = d_nodeValuePool.find(nv);
-  if(find == d_nodeValuePool.end()) {
-    return NULL;
-  } else {
-    return *find;
-  }
+inline expr::NodeValue* NodeManager::poolLookup(expr::NodeValue* nv,
+                                                size_t& hash) const
+{
+  // The returned node value may have a reference count of zero, hence the
+  // caller must hold the lock until it has taken a reference to it.
+  hash = expr::NodeValuePool::hash(nv);
+  return d_nodeValuePool.find(nv, hash);
 }
 
-inline void NodeManager::poolInsert(expr::NodeValue* nv) {
-  Assert(d_nodeValuePool.find(nv) == d_nodeValuePool.end())
-      << "NodeValue already in the pool!";
-  d_nodeValuePool.insert(nv);
+inline void NodeManager::poolInsert(expr::NodeValue* nv, size_t hash)
+{
+  d_nodeValuePool.insert(nv, hash);
 }
 
-inline void NodeManager::poolRemove(expr::NodeValue* nv) {
-  Assert(d_nodeValuePool.find(nv) != d_nodeValuePool.end())
-      << "NodeValue is not in the pool!";
+inline void NodeManager::poolInsert(expr::NodeValue* nv)
+{
+  d_nodeValuePool.insert(nv, expr::NodeValuePool::hash(nv));
+}
 
+inline void NodeManager::poolRemove(expr::NodeValue* nv)
+{
   d_nodeValuePool.erase(nv);
 }
 
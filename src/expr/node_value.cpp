@@ -113,5 +113,16 @@ void NodeValue::markForDeletion()
   d_nm->markForDeletion(this);
 }
 
+#ifdef CVC5_THREAD_SAFE_NODES
+void NodeValue::releaseLastReference()
+{
+  Assert(d_nm != nullptr)
+      << "No current NodeManager on destruction of NodeValue: "
+         "maybe a public cvc5 interface function is missing a "
+         "NodeManagerScope ?";
+  d_nm->releaseLastReference(this);
+}
+#endif
+
 }  // namespace expr
 }  // namespace cvc5::internal
@@ -25,6 +25,9 @@
 
 #include <iterator>
 #include <string>
+#ifdef CVC5_THREAD_SAFE_NODES
+#include <atomic>
+#endif
 
 #include "expr/kind.h"
 #include "expr/metakind.h"
@@ -75,6 +78,7 @@ class CVC5_EXPORT NodeValue
   friend void kind::metakind::deleteNodeValueConstant(NodeValue* nv);
 
   friend class RefCountGuard;
+  friend class NodeValuePool;
 
   /* ------------------------------------------------------------------------ */
  public:
@@ -294,6 +298,53 @@ class CVC5_EXPORT NodeValue
   /** Private constructor for the null value. */
   NodeValue(int);
 
+#ifdef CVC5_THREAD_SAFE_NODES
+  /*
+   * In thread-safe builds, the reference count is updated atomically. The
+   * reference count only drops to zero while holding the lock of the node
+   * manager, see NodeManager::releaseLastReference, such that a node value
+   * is never resurrected from the pool while it is being reclaimed.
+   */
+  void inc()
+  {
+    uint32_t rc = d_rc.load(std::memory_order_relaxed);
+    do
+    {
+      if (__builtin_expect((rc >= MAX_RC), false))
+      {
+        return;
+      }
+    } while (!d_rc.compare_exchange_weak(
+        rc, rc + 1, std::memory_order_relaxed, std::memory_order_relaxed));
+    if (__builtin_expect((rc == MAX_RC - 1), false))
+    {
+      markRefCountMaxedOut();
+    }
+  }
+
+  void dec()
+  {
+    uint32_t rc = d_rc.load(std::memory_order_relaxed);
+    while (__builtin_expect((rc > 1), true))
+    {
+      if (__builtin_expect((rc == MAX_RC), false))
+      {
+        return;
+      }
+      if (d_rc.compare_exchange_weak(rc,
+                                     rc - 1,
+                                     std::memory_order_acq_rel,
+                                     std::memory_order_relaxed))
+      {
+        return;
+      }
+    }
+    releaseLastReference();
+  }
+
+  /** Release a reference that is possibly the last one to this node value */
+  void releaseLastReference();
+#else
   void inc()
   {
     if (__builtin_expect((d_rc < MAX_RC - 1), true))
@@ -319,6 +370,7 @@ class CVC5_EXPORT NodeValue
     }
   }
 
+#endif
   void markRefCountMaxedOut();
   void markForDeletion();
 
@@ -350,6 +402,19 @@ class CVC5_EXPORT NodeValue
   /** The ID (0 is reserved for the null value) */
   uint64_t d_id : NBITS_ID;
 
+#ifdef CVC5_THREAD_SAFE_NODES
+  /** Kind of the expression */
+  uint32_t d_kind : NBITS_KIND;
+
+  /** Number of children */
+  uint32_t d_nchildren : NBITS_NCHILDREN;
+
+  /**
+   * The expression's reference count, which is atomic and hence cannot be a
+   * bit field. It is still sticky at MAX_RC.
+   */
+  std::atomic<uint32_t> d_rc;
+#else
   /** The expression's reference count. */
   uint32_t d_rc : NBITS_REFCOUNT;
 
@@ -358,6 +423,7 @@ class CVC5_EXPORT NodeValue
 
   /** Number of children */
   uint32_t d_nchildren : NBITS_NCHILDREN;
+#endif
 
   /** Associated node manager. */
   NodeManager* d_nm = nullptr;
@@ -416,6 +482,15 @@ struct NodeValueIDEquality {
 
 std::ostream& operator<<(std::ostream& out, const NodeValue& nv);
 
+#ifdef CVC5_THREAD_SAFE_NODES
+inline NodeValue::NodeValue(int)
+    : d_id(0),
+      d_kind(static_cast<uint32_t>(Kind::NULL_EXPR)),
+      d_nchildren(0),
+      d_rc(MAX_RC)
+{
+}
+#else
 inline NodeValue::NodeValue(int)
     : d_id(0),
       d_rc(MAX_RC),
@@ -423,6 +498,7 @@ inline NodeValue::NodeValue(int)
       d_nchildren(0)
 {
 }
+#endif
 
 inline void NodeValue::decrRefCounts() {
   for(nv_iterator i = nv_begin(); i != nv_end(); ++i) {
@@ -0,0 +1,119 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A slab allocator for node values.
+ */
+
+#include "expr/node_value_allocator.h"
+
+#include <cstdlib>
+#include <new>
+
+#include "base/check.h"
+#include "expr/node_value.h"
+
+namespace cvc5::internal {
+namespace expr {
+
+namespace {
+/** The size of a slab in bytes */
+constexpr size_t SLAB_SIZE = 64 * 1024;
+}  // namespace
+
+NodeValueAllocator::NodeValueAllocator() : d_numNodeValues(0), d_numBytes(0)
+{
+  d_free.fill(nullptr);
+  d_next.fill(nullptr);
+  d_end.fill(nullptr);
+}
+
+NodeValueAllocator::~NodeValueAllocator()
+{
+  for (char* slab : d_slabs)
+  {
+    std::free(slab);
+  }
+}
+
+size_t NodeValueAllocator::getSize(size_t nchildren)
+{
+  return sizeof(NodeValue) + sizeof(NodeValue*) * nchildren;
+}
+
+NodeValue* NodeValueAllocator::allocate(size_t nchildren)
+{
+  NodeValue* nv;
+  if (nchildren > MAX_SLAB_CHILDREN)
+  {
+    size_t size = getSize(nchildren);
+    nv = static_cast<NodeValue*>(std::malloc(size));
+    if (nv == nullptr)
+    {
+      throw std::bad_alloc();
+    }
+    d_numBytes += size;
+  }
+  else if (d_free[nchildren] != nullptr)
+  {
+    FreeSlot* slot = d_free[nchildren];
+    d_free[nchildren] = slot->d_next;
+    nv = reinterpret_cast<NodeValue*>(slot);
+  }
+  else
+  {
+    if (d_next[nchildren] == d_end[nchildren])
+    {
+      newSlab(nchildren);
+    }
+    nv = reinterpret_cast<NodeValue*>(d_next[nchildren]);
+    d_next[nchildren] += getSize(nchildren);
+  }
+  ++d_numNodeValues;
+  return nv;
+}
+
+void NodeValueAllocator::adopt(NodeValue* nv, size_t nchildren)
+{
+  Assert(nchildren > MAX_SLAB_CHILDREN);
+  ++d_numNodeValues;
+  d_numBytes += getSize(nchildren);
+}
+
+void NodeValueAllocator::deallocate(NodeValue* nv, size_t nchildren)
+{
+  Assert(d_numNodeValues > 0);
+  --d_numNodeValues;
+  if (nchildren > MAX_SLAB_CHILDREN)
+  {
+    d_numBytes -= getSize(nchildren);
+    std::free(nv);
+    return;
+  }
+  FreeSlot* slot = reinterpret_cast<FreeSlot*>(nv);
+  slot->d_next = d_free[nchildren];
+  d_free[nchildren] = slot;
+}
+
+void NodeValueAllocator::newSlab(size_t nchildren)
+{
+  size_t size = getSize(nchildren);
+  size_t nslots = SLAB_SIZE / size;
+  char* slab = static_cast<char*>(std::malloc(nslots * size));
+  if (slab == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  d_slabs.push_back(slab);
+  d_numBytes += nslots * size;
+  d_next[nchildren] = slab;
+  d_end[nchildren] = slab + nslots * size;
+}
+
+}  // namespace expr
+}  // namespace cvc5::internal
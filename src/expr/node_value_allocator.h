@@ -0,0 +1,110 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A slab allocator for node values.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__EXPR__NODE_VALUE_ALLOCATOR_H
+#define CVC5__EXPR__NODE_VALUE_ALLOCATOR_H
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace cvc5::internal {
+namespace expr {
+
+class NodeValue;
+
+/**
+ * A slab allocator for the node values of a node manager.
+ *
+ * Node values with at most MAX_SLAB_CHILDREN children are allocated from
+ * slabs that are bucketed by their number of children. Each slab is a large
+ * chunk of memory holding node values of the same size, such that node values
+ * are not fragmented over the heap and node values created together are close
+ * to each other in memory. Slots of reclaimed node values are put on a free
+ * list per size and reused by the next allocation of the same size. Node
+ * values with more children are allocated by malloc.
+ *
+ * The memory of the slabs is only returned to the system when the allocator
+ * is destroyed.
+ */
+class NodeValueAllocator
+{
+ public:
+  /** The maximal number of children of a node value allocated from slabs */
+  static constexpr size_t MAX_SLAB_CHILDREN = 16;
+
+  NodeValueAllocator();
+  ~NodeValueAllocator();
+  NodeValueAllocator(const NodeValueAllocator&) = delete;
+  NodeValueAllocator& operator=(const NodeValueAllocator&) = delete;
+
+  /**
+   * Allocate the memory for a node value with the given number of children.
+   * The returned node value is not initialized.
+   *
+   * @throws bad_alloc if the allocation fails
+   */
+  NodeValue* allocate(size_t nchildren);
+  /**
+   * Take ownership of nv, which has more than MAX_SLAB_CHILDREN children and
+   * was allocated by malloc with getSize(nchildren) bytes. This avoids
+   * copying node values that were constructed in a buffer of their own.
+   */
+  void adopt(NodeValue* nv, size_t nchildren);
+  /**
+   * Deallocate the memory of nv, which was allocated by allocate or adopted
+   * with the given number of children.
+   */
+  void deallocate(NodeValue* nv, size_t nchildren);
+
+  /** Get the number of node values that are currently allocated */
+  size_t getNumNodeValues() const { return d_numNodeValues; }
+  /**
+   * Get the number of bytes reserved for node values, which includes the
+   * unused slots of the slabs.
+   */
+  size_t getNumBytes() const { return d_numBytes; }
+
+  /** Get the size in bytes of a node value with the given number of children */
+  static size_t getSize(size_t nchildren);
+
+ private:
+  /** A slot on a free list */
+  struct FreeSlot
+  {
+    FreeSlot* d_next;
+  };
+  /** Allocate a new slab for node values with the given number of children */
+  void newSlab(size_t nchildren);
+
+  /** The free lists, indexed by the number of children */
+  std::array<FreeSlot*, MAX_SLAB_CHILDREN + 1> d_free;
+  /**
+   * The next unused slot in the last slab, indexed by the number of children
+   */
+  std::array<char*, MAX_SLAB_CHILDREN + 1> d_next;
+  /** The end of the last slab, indexed by the number of children */
+  std::array<char*, MAX_SLAB_CHILDREN + 1> d_end;
+  /** All slabs */
+  std::vector<char*> d_slabs;
+  /** The number of allocated node values */
+  size_t d_numNodeValues;
+  /** The number of bytes reserved for node values */
+  size_t d_numBytes;
+}; /* class NodeValueAllocator */
+
+}  // namespace expr
+}  // namespace cvc5::internal
+
+#endif /* CVC5__EXPR__NODE_VALUE_ALLOCATOR_H */
@@ -0,0 +1,187 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The hash-consing table of node values.
+ */
+
+#include "expr/node_value_pool.h"
+
+#include "base/check.h"
+
+namespace cvc5::internal {
+namespace expr {
+
+namespace {
+/** The number of slots of an empty table, as a power of two */
+constexpr uint32_t INITIAL_LOG_CAPACITY = 10;
+/**
+ * The number of slots of the old table that are migrated per insertion or
+ * removal. This must be large enough to finish the migration before the new
+ * table becomes full, which requires at least 2 slots per insertion at a
+ * maximal load factor of 3/4.
+ */
+constexpr size_t MIGRATE_STEP = 8;
+}  // namespace
+
+NodeValuePool::NodeValuePool() : d_migrateIndex(0)
+{
+  allocate(d_table, static_cast<size_t>(1) << INITIAL_LOG_CAPACITY);
+}
+
+NodeValuePool::~NodeValuePool() {}
+
+void NodeValuePool::allocate(Table& t, size_t capacity)
+{
+  Assert((capacity & (capacity - 1)) == 0);
+  t.d_slots.reset(new Slot[capacity]());
+  t.d_capacity = capacity;
+  t.d_size = 0;
+  uint32_t log = 0;
+  while ((static_cast<size_t>(1) << log) < capacity)
+  {
+    ++log;
+  }
+  t.d_shift = 64 - log;
+}
+
+void NodeValuePool::place(Table& t, NodeValue* nv, size_t h)
+{
+  size_t i = t.home(h);
+  while (t.d_slots[i].d_nv != nullptr)
+  {
+    i = t.next(i);
+  }
+  t.d_slots[i].d_hash = h;
+  t.d_slots[i].d_nv = nv;
+  ++t.d_size;
+}
+
+void NodeValuePool::insert(NodeValue* nv, size_t h)
+{
+  Assert(h == hash(nv));
+  Assert(find(nv, h) == nullptr) << "NodeValue already in the pool!";
+  if (d_old.d_slots != nullptr)
+  {
+    migrate(MIGRATE_STEP);
+  }
+  // the maximal load factor is 3/4
+  if (4 * (d_table.d_size + 1) > 3 * d_table.d_capacity)
+  {
+    grow();
+  }
+  place(d_table, nv, h);
+}
+
+void NodeValuePool::erase(NodeValue* nv)
+{
+  size_t h = hash(nv);
+  // look in the current table
+  size_t i = d_table.home(h);
+  for (; d_table.d_slots[i].d_nv != nullptr; i = d_table.next(i))
+  {
+    if (d_table.d_slots[i].d_nv == nv)
+    {
+      break;
+    }
+  }
+  if (d_table.d_slots[i].d_nv == nv)
+  {
+    // Shift the following entries of the probe sequence backwards. An entry
+    // at slot j can be moved to the free slot i unless its home slot lies
+    // cyclically in (i, j].
+    Slot* slots = d_table.d_slots.get();
+    for (size_t j = d_table.next(i); slots[j].d_nv != nullptr;
+         j = d_table.next(j))
+    {
+      size_t k = d_table.home(slots[j].d_hash);
+      bool stays = i <= j ? (i < k && k <= j) : (i < k || k <= j);
+      if (!stays)
+      {
+        slots[i] = slots[j];
+        i = j;
+      }
+    }
+    slots[i].d_nv = nullptr;
+    slots[i].d_hash = 0;
+    --d_table.d_size;
+  }
+  else
+  {
+    // it must be in the old table, where it is replaced by a tombstone
+    Assert(d_old.d_slots != nullptr) << "NodeValue is not in the pool!";
+    size_t j = d_old.home(h);
+    while (d_old.d_slots[j].d_nv != nv)
+    {
+      Assert(d_old.d_slots[j].d_nv != nullptr)
+          << "NodeValue is not in the pool!";
+      j = d_old.next(j);
+    }
+    d_old.d_slots[j].d_nv = tombstone();
+    --d_old.d_size;
+  }
+  if (d_old.d_slots != nullptr)
+  {
+    migrate(MIGRATE_STEP);
+  }
+}
+
+void NodeValuePool::migrate(size_t n)
+{
+  Assert(d_old.d_slots != nullptr);
+  for (; n > 0 && d_old.d_size > 0; --n, ++d_migrateIndex)
+  {
+    Assert(d_migrateIndex < d_old.d_capacity);
+    Slot& s = d_old.d_slots[d_migrateIndex];
+    if (s.d_nv != nullptr && s.d_nv != tombstone())
+    {
+      place(d_table, s.d_nv, s.d_hash);
+      s.d_nv = tombstone();
+      --d_old.d_size;
+    }
+  }
+  if (d_old.d_size == 0)
+  {
+    d_old.d_slots.reset();
+    d_old.d_capacity = 0;
+  }
+}
+
+void NodeValuePool::grow()
+{
+  if (d_old.d_slots != nullptr)
+  {
+    migrate(d_old.d_capacity);
+  }
+  Assert(d_old.d_slots == nullptr);
+  size_t capacity = 2 * d_table.d_capacity;
+  d_old = std::move(d_table);
+  d_table = Table();
+  allocate(d_table, capacity);
+  d_migrateIndex = 0;
+}
+
+std::vector<NodeValue*> NodeValuePool::getNodeValues() const
+{
+  std::vector<NodeValue*> res;
+  for (const Table* t : {&d_table, &d_old})
+  {
+    for (size_t i = 0; i < t->d_capacity; ++i)
+    {
+      NodeValue* nv = t->d_slots[i].d_nv;
+      if (nv != nullptr && nv != tombstone())
+      {
+        res.push_back(nv);
+      }
+    }
+  }
+  return res;
+}
+
+}  // namespace expr
+}  // namespace cvc5::internal
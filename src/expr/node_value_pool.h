@@ -0,0 +1,190 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The hash-consing table of node values.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__EXPR__NODE_VALUE_POOL_H
+#define CVC5__EXPR__NODE_VALUE_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "expr/metakind.h"
+#include "expr/node_value.h"
+
+namespace cvc5::internal {
+namespace expr {
+
+/**
+ * The table of node values of a node manager, which maps the structure of a
+ * node value (its kind and children, or its constant payload) to the unique
+ * node value with this structure.
+ *
+ * The table uses open addressing with linear probing. Each slot stores the
+ * hash of its node value next to the pointer, such that probing only
+ * compares node values whose hashes are equal and never dereferences other
+ * node values. Entries are removed by shifting the following entries of the
+ * probe sequence backwards, hence no tombstones accumulate.
+ *
+ * The table grows incrementally: when it becomes too full, a table of twice
+ * the size is allocated and the entries of the old table are moved to it a
+ * few at a time by subsequent insertions and removals. Until then, lookups
+ * consult both tables. This avoids rehashing millions of node values at
+ * once, which would stall the construction of the node triggering it.
+ *
+ * Lookups take the hash of the node value as an argument, so that a node
+ * value that is not found can be inserted without hashing it again.
+ */
+class NodeValuePool
+{
+ public:
+  NodeValuePool();
+  ~NodeValuePool();
+  NodeValuePool(const NodeValuePool&) = delete;
+  NodeValuePool& operator=(const NodeValuePool&) = delete;
+
+  /** Get the hash of nv, which is used for lookup and insertion. */
+  static size_t hash(const NodeValue* nv) { return nv->poolHash(); }
+
+  /**
+   * Find the node value that is equal to nv, which has the given hash.
+   * Returns nullptr if there is none. The node value nv need not be fully
+   * constructed, see NodeManager::poolLookup.
+   */
+  NodeValue* find(const NodeValue* nv, size_t h) const
+  {
+    NodeValue* res = find(d_table, nv, h);
+    if (res == nullptr && d_old.d_slots != nullptr)
+    {
+      res = find(d_old, nv, h);
+    }
+    return res;
+  }
+  /**
+   * Insert nv with the given hash, where no node value equal to nv is in the
+   * table.
+   */
+  void insert(NodeValue* nv, size_t h);
+  /** Remove nv, which is in the table. */
+  void erase(NodeValue* nv);
+
+  /** Get the number of node values in the table */
+  size_t size() const { return d_table.d_size + d_old.d_size; }
+  /** Get all node values in the table */
+  std::vector<NodeValue*> getNodeValues() const;
+
+ private:
+  /** A slot of the table, which is empty if d_nv is null */
+  struct Slot
+  {
+    size_t d_hash;
+    NodeValue* d_nv;
+  };
+  /** A table of slots, whose size is a power of two */
+  struct Table
+  {
+    /** The slots */
+    std::unique_ptr<Slot[]> d_slots;
+    /** The number of slots */
+    size_t d_capacity = 0;
+    /** The number of slots holding a node value */
+    size_t d_size = 0;
+    /** The shift that maps a hash to its home slot */
+    uint32_t d_shift = 0;
+
+    /** Get the home slot of the given hash */
+    size_t home(size_t h) const
+    {
+      // Fibonacci hashing, which spreads the bits of the hash of a node value
+      // that is built from the ids of its children
+      return static_cast<size_t>(
+          (static_cast<uint64_t>(h) * UINT64_C(0x9e3779b97f4a7c15))
+          >> d_shift);
+    }
+    /** Get the slot following slot i */
+    size_t next(size_t i) const { return (i + 1) & (d_capacity - 1); }
+  };
+
+  /**
+   * Marks a slot of the old table whose node value was moved or removed,
+   * such that the probe sequences of the old table stay intact.
+   */
+  static NodeValue* tombstone()
+  {
+    return reinterpret_cast<NodeValue*>(static_cast<uintptr_t>(1));
+  }
+
+  /** Returns true if nv and the pool entry e are equal */
+  static bool equal(const NodeValue* e, const NodeValue* nv)
+  {
+    if (e->d_kind != nv->d_kind)
+    {
+      return false;
+    }
+    if (e->getMetaKind() == kind::metakind::CONSTANT)
+    {
+      return NodeValuePoolEq()(e, nv);
+    }
+    if (e->d_nchildren != nv->d_nchildren)
+    {
+      return false;
+    }
+    for (uint32_t i = 0, n = e->d_nchildren; i < n; ++i)
+    {
+      if (e->d_children[i] != nv->d_children[i])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /** Find the entry equal to nv with hash h in table t */
+  static NodeValue* find(const Table& t, const NodeValue* nv, size_t h)
+  {
+    for (size_t i = t.home(h);; i = t.next(i))
+    {
+      const Slot& s = t.d_slots[i];
+      if (s.d_nv == nullptr)
+      {
+        return nullptr;
+      }
+      if (s.d_hash == h && s.d_nv != tombstone() && equal(s.d_nv, nv))
+      {
+        return s.d_nv;
+      }
+    }
+  }
+
+  /** Allocate the slots of table t with the given capacity */
+  static void allocate(Table& t, size_t capacity);
+  /** Place nv with hash h in the first empty slot of its probe sequence */
+  static void place(Table& t, NodeValue* nv, size_t h);
+  /** Move up to n slots of the old table to the current one */
+  void migrate(size_t n);
+  /** Start growing the current table */
+  void grow();
+
+  /** The current table */
+  Table d_table;
+  /** The table that is being migrated, whose slots are null if none */
+  Table d_old;
+  /** The next slot of the old table to migrate */
+  size_t d_migrateIndex;
+}; /* class NodeValuePool */
+
+}  // namespace expr
+}  // namespace cvc5::internal
+
+#endif /* CVC5__EXPR__NODE_VALUE_POOL_H */
@@ -102,6 +102,7 @@ Node SkolemManager::mkSkolemFunctionTyped(SkolemId id,
                                           TypeNode tn,
                                           Node cacheVal)
 {
+  NodeManager::Guard guard(d_nm);
   std::tuple<SkolemId, TypeNode, Node> key(id, tn, cacheVal);
   std::map<std::tuple<SkolemId, TypeNode, Node>, Node>::iterator it =
       d_skolemFuns.find(key);
@@ -174,6 +175,7 @@ bool SkolemManager::isSkolemFunction(TNode k,
   {
     return false;
   }
+  NodeManager::Guard guard(k.getNodeManager());
   std::map<Node, std::tuple<SkolemId, TypeNode, Node>>::const_iterator it =
       skm->d_skolemFunMap.find(k);
   Assert(it != skm->d_skolemFunMap.end());
@@ -350,6 +352,7 @@ Node SkolemManager::mkSkolemNode(Kind k,
                                  const TypeNode& type,
                                  SkolemFlags flags)
 {
+  NodeManager::Guard guard(d_nm);
   Node n = NodeBuilder(d_nm, k);
   if ((flags & SkolemFlags::SKOLEM_EXACT_NAME)
       == SkolemFlags::SKOLEM_EXACT_NAME)
@@ -148,6 +148,12 @@ bool CommandExecutor::doCommandSingleton(Cmd* cmd)
     d_result = res = csa->getResult();
     hasResult = true;
   }
+  const CheckOptCommand* co = dynamic_cast<const CheckOptCommand*>(cmd);
+  if (co != nullptr)
+  {
+    d_result = res = co->getResult();
+    hasResult = true;
+  }
 
   // if we didnt set a result, return the status
   if (!hasResult)
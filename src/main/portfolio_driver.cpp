@@ -14,16 +14,21 @@
 #include "main/portfolio_driver.h"
 
 #if HAVE_SYS_WAIT_H
+#include <pthread.h>
 #include <signal.h>
+#include <sys/mman.h>
 #include <sys/wait.h>
 #include <unistd.h>
 #endif
 
 #include <cvc5/cvc5.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <optional>
+#include <sstream>
 #include <thread>
 
 #include "base/check.h"
@@ -32,6 +37,7 @@
 #include "main/command_executor.h"
 #include "parser/commands.h"
 #include "parser/command_status.h"
+#include "util/rational.h"
 
 using namespace cvc5::parser;
 
@@ -62,6 +68,10 @@ bool ExecutionContext::solveContinuous(parser::InputParser* parser,
     {
       break;
     }
+    if (d_prepareCommand)
+    {
+      d_prepareCommand(cmd.d_cmd.get());
+    }
     status = d_executor->doCommand(&cmd);
     Cmd* cc = cmd.d_cmd.get();
     if (cc->interrupted() && status == 0)
@@ -119,6 +129,10 @@ bool ExecutionContext::solveCommands(std::vector<Command>& cmds)
       break;
     }
 
+    if (d_prepareCommand)
+    {
+      d_prepareCommand(cmd.d_cmd.get());
+    }
     status = d_executor->doCommand(&cmd);
     Cmd* cc = cmd.d_cmd.get();
     if (cc->interrupted() && status == 0)
@@ -211,6 +225,388 @@ class Pipe
   int d_pipe[2];
 };
 
+/**
+ * The best values of the objectives of an optimization query found by any
+ * portfolio worker. The values are kept in a shared memory region that is
+ * mapped before the workers are forked, so that each worker can publish the
+ * values of its incumbent and catch up with the values found by the others.
+ *
+ * The values are stored as text, one line per objective, together with the
+ * index of the optimization query they belong to, which is the same in all
+ * workers since they execute the same commands. A worker only replaces the
+ * stored values if its own are better in the order of the query, i.e.,
+ * lexicographically better, or better for some objective in box mode, in
+ * which case the best value of each objective is kept. For this, each worker
+ * keeps track of the directions of the objectives from the commands it
+ * executes.
+ *
+ * The region is protected by a robust process-shared mutex, which is held
+ * only while comparing and copying the text. Since workers are killed when
+ * they time out, a worker may die while holding it. The next worker that
+ * locks the mutex then discards the values, which may be partially written.
+ */
+class SharedIncumbent
+{
+  struct Data
+  {
+    /** The lock */
+    pthread_mutex_t d_mutex;
+    /** The number of publications so far */
+    uint64_t d_version = 0;
+    /** The index of the query the values belong to */
+    uint64_t d_query = 0;
+    /** The length of the text in d_text */
+    size_t d_size = 0;
+    /** The values as text */
+    char d_text[8192];
+  };
+  /** An objective, for comparing its values */
+  struct Objective
+  {
+    /** Whether the objective is minimized or maximized */
+    modes::ObjectiveType d_type;
+    /** Whether bit-vector values are compared as signed values */
+    bool d_bvSigned;
+    /** Whether this is a MaxSMT objective */
+    bool d_isSoft;
+    /** The id of the soft constraints, if this is a MaxSMT objective */
+    std::string d_softId;
+    /** The number of user contexts in which the objective was added */
+    uint32_t d_level;
+  };
+
+ public:
+  ~SharedIncumbent()
+  {
+    if (d_data != nullptr)
+    {
+      pthread_mutex_destroy(&d_data->d_mutex);
+      munmap(d_data, sizeof(Data));
+    }
+  }
+  /** Map the shared memory region, which must happen before forking */
+  void open()
+  {
+    void* mem = mmap(nullptr,
+                     sizeof(Data),
+                     PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_ANONYMOUS,
+                     -1,
+                     0);
+    if (mem == MAP_FAILED)
+    {
+      throw internal::Exception("Unable to map shared memory for portfolio");
+    }
+    d_data = new (mem) Data();
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+    int rc = pthread_mutex_init(&d_data->d_mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+    if (rc != 0)
+    {
+      munmap(d_data, sizeof(Data));
+      d_data = nullptr;
+      throw internal::Exception("Unable to create lock for portfolio");
+    }
+  }
+  /**
+   * Notify that the given command is about to be executed by a worker, which
+   * keeps track of the objectives.
+   */
+  void notify(Cmd* cmd)
+  {
+    if (auto* c = dynamic_cast<AddObjectiveCommand*>(cmd))
+    {
+      d_objectives.push_back(
+          {c->getType(), c->isBvSigned(), false, "", d_level});
+    }
+    else if (auto* c = dynamic_cast<AssertSoftCommand*>(cmd))
+    {
+      // the soft constraints with the same id form a single objective
+      for (const Objective& o : d_objectives)
+      {
+        if (o.d_isSoft && o.d_softId == c->getId())
+        {
+          return;
+        }
+      }
+      d_objectives.push_back(
+          {modes::ObjectiveType::MINIMIZE, false, true, c->getId(), d_level});
+    }
+    else if (auto* c = dynamic_cast<PushCommand*>(cmd))
+    {
+      d_level += c->getNumScopes();
+    }
+    else if (auto* c = dynamic_cast<PopCommand*>(cmd))
+    {
+      d_level -= std::min(d_level, c->getNumScopes());
+      while (!d_objectives.empty() && d_objectives.back().d_level > d_level)
+      {
+        d_objectives.pop_back();
+      }
+    }
+    else if (dynamic_cast<ResetCommand*>(cmd) != nullptr
+             || dynamic_cast<ResetAssertionsCommand*>(cmd) != nullptr)
+    {
+      d_level = 0;
+      d_objectives.clear();
+    }
+  }
+  /**
+   * Connect the given check-opt command of a worker to the shared values.
+   * Each such command starts a new query.
+   */
+  void connect(CheckOptCommand* cmd, TermManager& tm)
+  {
+    uint64_t query = ++d_query;
+    d_version = 0;
+    d_cache.clear();
+    d_mode = cmd->getMode();
+    d_queryObjectives = d_objectives;
+    cmd->setExchange(
+        [this, query](const std::vector<Term>& values) {
+          publish(query, values);
+          return true;
+        },
+        [this, query, &tm]() { return read(query, tm); });
+  }
+
+ private:
+  /** Publish the given values for the given query */
+  void publish(uint64_t query, const std::vector<Term>& values)
+  {
+    if (values.size() != d_queryObjectives.size())
+    {
+      // we lost track of the objectives, hence we cannot compare values
+      return;
+    }
+    std::vector<std::string> lines;
+    for (const Term& v : values)
+    {
+      std::stringstream ss;
+      if (v.isIntegerValue())
+      {
+        ss << "i " << v.getIntegerValue();
+      }
+      else if (v.isRealValue())
+      {
+        ss << "r " << v.getRealValue();
+      }
+      else if (v.isBitVectorValue())
+      {
+        ss << "b " << v.getBitVectorValue(2);
+      }
+      else
+      {
+        // other values are not shared
+        ss << "-";
+      }
+      lines.push_back(ss.str());
+    }
+    if (!lock())
+    {
+      return;
+    }
+    // whether we keep values of other workers, which we must read back
+    bool adopted = false;
+    if (d_data->d_query == query && d_data->d_size > 0)
+    {
+      std::stringstream ss(std::string(d_data->d_text, d_data->d_size));
+      std::vector<std::string> shared;
+      for (std::string line; std::getline(ss, line);)
+      {
+        shared.push_back(line);
+      }
+      if (!merge(lines, shared, adopted))
+      {
+        // the values of another worker are at least as good
+        unlock();
+        return;
+      }
+    }
+    std::string text;
+    for (const std::string& line : lines)
+    {
+      text += line + "\n";
+    }
+    if (text.size() <= sizeof(d_data->d_text))
+    {
+      std::memcpy(d_data->d_text, text.data(), text.size());
+      d_data->d_size = text.size();
+      d_data->d_query = query;
+      ++d_data->d_version;
+      if (!adopted)
+      {
+        // our own values need not be read back
+        d_version = d_data->d_version;
+      }
+    }
+    unlock();
+    d_cache.clear();
+  }
+  /**
+   * Merge the shared values into the values of this worker, one line per
+   * objective each. Returns true if the result is better than the shared
+   * values, which it then replaces. Sets adopted to true if the result
+   * contains shared values that are better than ours.
+   */
+  bool merge(std::vector<std::string>& lines,
+             const std::vector<std::string>& shared,
+             bool& adopted) const
+  {
+    if (shared.size() != lines.size())
+    {
+      return true;
+    }
+    if (d_mode == modes::OptimizationMode::BOX)
+    {
+      // each objective keeps its best value
+      bool better = false;
+      for (size_t i = 0, size = lines.size(); i < size; ++i)
+      {
+        int c = compare(lines[i], shared[i], d_queryObjectives[i]);
+        if (c > 0)
+        {
+          better = true;
+        }
+        else if (c < 0)
+        {
+          lines[i] = shared[i];
+          adopted = true;
+        }
+      }
+      return better;
+    }
+    for (size_t i = 0, size = lines.size(); i < size; ++i)
+    {
+      int c = compare(lines[i], shared[i], d_queryObjectives[i]);
+      if (c != 0)
+      {
+        return c > 0;
+      }
+    }
+    return false;
+  }
+  /**
+   * Compare the values a and b of the objective o, as written by publish.
+   * Returns a positive number if a is better than b, a negative number if b
+   * is better than a, and zero if they are equal or incomparable.
+   */
+  static int compare(const std::string& a,
+                     const std::string& b,
+                     const Objective& o)
+  {
+    if (a.size() < 2 || b.size() < 2 || a[0] != b[0])
+    {
+      return 0;
+    }
+    int c;
+    if (a[0] == 'b')
+    {
+      std::string x = a.substr(2), y = b.substr(2);
+      if (x.size() != y.size())
+      {
+        return 0;
+      }
+      if (o.d_bvSigned && !x.empty())
+      {
+        // the sign bit has the opposite order
+        std::swap(x[0], y[0]);
+      }
+      c = x.compare(y);
+    }
+    else
+    {
+      internal::Rational x(a.substr(2)), y(b.substr(2));
+      c = x.cmp(y);
+    }
+    c = c < 0 ? -1 : (c > 0 ? 1 : 0);
+    return o.d_type == modes::ObjectiveType::MINIMIZE ? -c : c;
+  }
+  /** Read the values of the given query published by any worker */
+  std::vector<Term> read(uint64_t query, TermManager& tm)
+  {
+    std::string text;
+    if (!lock())
+    {
+      return d_cache;
+    }
+    bool changed = d_data->d_query == query && d_data->d_version != d_version;
+    if (changed)
+    {
+      d_version = d_data->d_version;
+      text.assign(d_data->d_text, d_data->d_size);
+    }
+    unlock();
+    if (!changed)
+    {
+      return d_cache;
+    }
+    d_cache.clear();
+    std::stringstream ss(text);
+    std::string kind, value;
+    while (ss >> kind)
+    {
+      if (kind == "-")
+      {
+        d_cache.push_back(Term());
+        continue;
+      }
+      ss >> value;
+      if (kind == "i")
+      {
+        d_cache.push_back(tm.mkInteger(value));
+      }
+      else if (kind == "r")
+      {
+        d_cache.push_back(tm.mkReal(value));
+      }
+      else
+      {
+        d_cache.push_back(tm.mkBitVector(value.size(), value, 2));
+      }
+    }
+    return d_cache;
+  }
+  /**
+   * Lock the shared memory region. If the previous holder of the lock died,
+   * the values it may have been writing are discarded. Returns false if the
+   * lock could not be acquired.
+   */
+  bool lock()
+  {
+    int rc = pthread_mutex_lock(&d_data->d_mutex);
+    if (rc == EOWNERDEAD)
+    {
+      d_data->d_query = 0;
+      d_data->d_size = 0;
+      ++d_data->d_version;
+      rc = pthread_mutex_consistent(&d_data->d_mutex);
+    }
+    return rc == 0;
+  }
+  void unlock() { pthread_mutex_unlock(&d_data->d_mutex); }
+
+  /** The shared memory region */
+  Data* d_data = nullptr;
+  /** The objectives added by the commands executed so far */
+  std::vector<Objective> d_objectives;
+  /** The number of user contexts pushed by the commands executed so far */
+  uint32_t d_level = 0;
+  /** The index of the current query of this worker */
+  uint64_t d_query = 0;
+  /** The mode of the current query */
+  modes::OptimizationMode d_mode = modes::OptimizationMode::LEX;
+  /** The objectives of the current query */
+  std::vector<Objective> d_queryObjectives;
+  /** The version of the values last read or written by this worker */
+  uint64_t d_version = 0;
+  /** The values last read by this worker */
+  std::vector<Term> d_cache;
+};
+
 /**
  * Manages running portfolio configurations until one has solved the input
  * problem. Depending on --portfolio-jobs runs multiple jobs in parallel.
@@ -250,6 +646,7 @@ class PortfolioProcessPool
         d_maxJobs(ctx.solver().getOptionInfo("portfolio-jobs").uintValue()),
         d_timeout(ctx.solver().getOptionInfo("tlimit").uintValue())
   {
+    d_incumbent.open();
   }
 
   bool run(PortfolioStrategy& strategy)
@@ -317,6 +714,15 @@ class PortfolioProcessPool
       job.d_errPipe.dup(STDERR_FILENO);
       job.d_outPipe.dup(STDOUT_FILENO);
       job.d_config.applyOptions(d_ctx.solver());
+      // share the incumbents of optimization queries with the other workers
+      d_ctx.d_prepareCommand = [this](Cmd* cmd) {
+        d_incumbent.notify(cmd);
+        auto* coc = dynamic_cast<CheckOptCommand*>(cmd);
+        if (coc != nullptr)
+        {
+          d_incumbent.connect(coc, d_ctx.solver().getTermManager());
+        }
+      };
       // 0 = solved, 1 = not solved
       SolveStatus rc = SolveStatus::STATUS_UNSOLVED;
       if (d_ctx.solveContinuous(d_parser, false))
@@ -416,6 +822,8 @@ class PortfolioProcessPool
 
   ExecutionContext& d_ctx;
   parser::InputParser* d_parser;
+  /** The incumbents of optimization queries, shared by all workers */
+  SharedIncumbent d_incumbent;
   /** All jobs. */
   std::vector<Job> d_jobs;
   /** The id of the next job to be started within d_jobs */
@@ -461,6 +869,7 @@ bool PortfolioDriver::solve(std::unique_ptr<CommandExecutor>& executor)
     total_timeout = 1200;
   }
 
+  addOptimizationStrategies(strategy, solver);
   PortfolioProcessPool pool(ctx, d_parser);  // ctx.parseCommands(d_parser));
 
   return pool.run(strategy);
@@ -761,4 +1170,27 @@ PortfolioStrategy PortfolioDriver::getStrategy(const std::string& logic)
   return s;
 }
 
+void PortfolioDriver::addOptimizationStrategies(PortfolioStrategy& strategy,
+                                                Solver& solver)
+{
+  // The variations, which are assigned to the configurations in turn. The
+  // first configuration keeps the default search.
+  std::vector<std::vector<std::pair<std::string, std::string>>> variations = {
+      {},
+      {{"opt-search", "linear"}},
+      {{"opt-stratify", "false"}, {"opt-phase", "false"}},
+      {{"opt-search", "linear"}, {"arith-objective-prop", "false"}}};
+  for (size_t i = 0, n = strategy.d_strategies.size(); i < n; i++)
+  {
+    for (const std::pair<std::string, std::string>& o :
+         variations[i % variations.size()])
+    {
+      if (!solver.getOptionInfo(o.first).setByUser)
+      {
+        strategy.d_strategies[i].set(o.first, o.second);
+      }
+    }
+  }
+}
+
 }  // namespace cvc5::main
@@ -20,6 +20,7 @@
 #include <cvc5/cvc5.h>
 #include <cvc5/cvc5_parser.h>
 
+#include <functional>
 #include <optional>
 
 #include "base/check.h"
@@ -39,6 +40,11 @@ class ExecutionContext
   CommandExecutor* d_executor;
   /** The logic, if it has been set by a command */
   std::optional<std::string> d_logic;
+  /**
+   * If set, this is called on each command before it is executed, e.g., to
+   * connect optimization queries of a portfolio worker to the other workers.
+   */
+  std::function<void(cvc5::parser::Cmd*)> d_prepareCommand;
 
   /** Retrieve the solver object from the command executor */
   Solver& solver() { return *d_executor->getSolver(); }
@@ -146,6 +152,13 @@ class PortfolioDriver
 
  private:
   PortfolioStrategy getStrategy(const std::string& logic);
+  /**
+   * Vary the search of optimization queries between the configurations of
+   * the given strategy, so that the workers, which share their incumbents,
+   * approach the optima in different ways. Options that were set by the user
+   * of the given solver are not changed.
+   */
+  void addOptimizationStrategies(PortfolioStrategy& strategy, Solver& solver);
 
   /** The parser we use to get the commands */
   parser::InputParser* d_parser;
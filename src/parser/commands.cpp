@@ -309,6 +309,8 @@ void AssertCommand::toStream(std::ostream& out) const
 
 PushCommand::PushCommand(uint32_t nscopes) : d_nscopes(nscopes) {}
 
+uint32_t PushCommand::getNumScopes() const { return d_nscopes; }
+
 void PushCommand::invoke(cvc5::Solver* solver, SymManager* sm)
 {
   try
@@ -335,6 +337,8 @@ void PushCommand::toStream(std::ostream& out) const
 
 PopCommand::PopCommand(uint32_t nscopes) : d_nscopes(nscopes) {}
 
+uint32_t PopCommand::getNumScopes() const { return d_nscopes; }
+
 void PopCommand::invoke(cvc5::Solver* solver, SymManager* sm)
 {
   try
@@ -448,6 +452,131 @@ void CheckSatAssumingCommand::toStream(std::ostream& out) const
       out, termVectorToNodes(d_terms));
 }
 
+/* -------------------------------------------------------------------------- */
+/* class AddObjectiveCommand                                                  */
+/* -------------------------------------------------------------------------- */
+
+AddObjectiveCommand::AddObjectiveCommand(const cvc5::Term& t,
+                                         modes::ObjectiveType type,
+                                         bool bvSigned)
+    : d_term(t), d_type(type), d_bvSigned(bvSigned)
+{
+}
+
+const cvc5::Term& AddObjectiveCommand::getTerm() const { return d_term; }
+
+modes::ObjectiveType AddObjectiveCommand::getType() const { return d_type; }
+
+bool AddObjectiveCommand::isBvSigned() const { return d_bvSigned; }
+
+void AddObjectiveCommand::invoke(cvc5::Solver* solver, SymManager* sm)
+{
+  try
+  {
+    solver->addObjective(d_term, d_type, d_bvSigned);
+    d_commandStatus = CommandSuccess::instance();
+  }
+  catch (exception& e)
+  {
+    d_commandStatus = new CommandFailure(e.what());
+  }
+}
+
+std::string AddObjectiveCommand::getCommandName() const
+{
+  return d_type == modes::ObjectiveType::MINIMIZE ? "minimize" : "maximize";
+}
+
+void AddObjectiveCommand::toStream(std::ostream& out) const
+{
+  internal::Printer::getPrinter(out)->toStreamCmdAddObjective(
+      out, termToNode(d_term), d_type, d_bvSigned);
+}
+
+/* -------------------------------------------------------------------------- */
+/* class AssertSoftCommand                                                    */
+/* -------------------------------------------------------------------------- */
+
+AssertSoftCommand::AssertSoftCommand(const cvc5::Term& t,
+                                     uint64_t weight,
+                                     const std::string& id)
+    : d_term(t), d_weight(weight), d_id(id)
+{
+}
+
+const cvc5::Term& AssertSoftCommand::getTerm() const { return d_term; }
+
+uint64_t AssertSoftCommand::getWeight() const { return d_weight; }
+
+const std::string& AssertSoftCommand::getId() const { return d_id; }
+
+void AssertSoftCommand::invoke(cvc5::Solver* solver, SymManager* sm)
+{
+  try
+  {
+    solver->assertSoft(d_term, d_weight, d_id);
+    d_commandStatus = CommandSuccess::instance();
+  }
+  catch (exception& e)
+  {
+    d_commandStatus = new CommandFailure(e.what());
+  }
+}
+
+std::string AssertSoftCommand::getCommandName() const { return "assert-soft"; }
+
+void AssertSoftCommand::toStream(std::ostream& out) const
+{
+  internal::Printer::getPrinter(out)->toStreamCmdAssertSoft(
+      out, termToNode(d_term), d_weight, d_id);
+}
+
+/* -------------------------------------------------------------------------- */
+/* class CheckOptCommand                                                      */
+/* -------------------------------------------------------------------------- */
+
+CheckOptCommand::CheckOptCommand(modes::OptimizationMode mode) : d_mode(mode)
+{
+}
+
+modes::OptimizationMode CheckOptCommand::getMode() const { return d_mode; }
+
+void CheckOptCommand::setExchange(
+    std::function<bool(const std::vector<cvc5::Term>&)> callback,
+    std::function<std::vector<cvc5::Term>()> bounds)
+{
+  d_callback = callback;
+  d_bounds = bounds;
+}
+
+void CheckOptCommand::invoke(cvc5::Solver* solver, SymManager* sm)
+{
+  try
+  {
+    d_result = d_callback ? solver->optimize(d_mode, d_callback, d_bounds)
+                          : solver->optimize(d_mode);
+    d_commandStatus = CommandSuccess::instance();
+  }
+  catch (exception& e)
+  {
+    d_commandStatus = new CommandFailure(e.what());
+  }
+}
+
+cvc5::Result CheckOptCommand::getResult() const { return d_result; }
+
+void CheckOptCommand::printResult(cvc5::Solver* solver, std::ostream& out) const
+{
+  out << d_result << endl;
+}
+
+std::string CheckOptCommand::getCommandName() const { return "check-opt"; }
+
+void CheckOptCommand::toStream(std::ostream& out) const
+{
+  internal::Printer::getPrinter(out)->toStreamCmdCheckOpt(out, d_mode);
+}
+
 /* -------------------------------------------------------------------------- */
 /* class DeclareSygusVarCommand */
 /* -------------------------------------------------------------------------- */
@@ -24,6 +24,7 @@
 
 #include <cvc5/cvc5.h>
 
+#include <functional>
 #include <iosfwd>
 #include <sstream>
 #include <string>
@@ -216,6 +217,8 @@ class CVC5_EXPORT PushCommand : public Cmd
 {
  public:
   PushCommand(uint32_t nscopes);
+  /** Get the number of scopes */
+  uint32_t getNumScopes() const;
 
   void invoke(cvc5::Solver* solver, parser::SymManager* sm) override;
   std::string getCommandName() const override;
@@ -229,6 +232,8 @@ class CVC5_EXPORT PopCommand : public Cmd
 {
  public:
   PopCommand(uint32_t nscopes);
+  /** Get the number of scopes */
+  uint32_t getNumScopes() const;
 
   void invoke(cvc5::Solver* solver, parser::SymManager* sm) override;
   std::string getCommandName() const override;
@@ -479,6 +484,105 @@ class CVC5_EXPORT CheckSatAssumingCommand : public Cmd
   cvc5::Result d_result;
 }; /* class CheckSatAssumingCommand */
 
+/* ------------------- optimization commands  ------------------ */
+
+/**
+ * The command when parsing minimize or maximize.
+ * This command adds an objective for subsequent optimization queries.
+ */
+class CVC5_EXPORT AddObjectiveCommand : public Cmd
+{
+ public:
+  AddObjectiveCommand(const cvc5::Term& t,
+                      modes::ObjectiveType type,
+                      bool bvSigned);
+  /** Get the term to optimize */
+  const cvc5::Term& getTerm() const;
+  /** Get whether the term is minimized or maximized */
+  modes::ObjectiveType getType() const;
+  /** Get whether the term is compared as a signed value */
+  bool isBvSigned() const;
+
+  void invoke(cvc5::Solver* solver, parser::SymManager* sm) override;
+  std::string getCommandName() const override;
+  void toStream(std::ostream& out) const override;
+
+ private:
+  /** The term to optimize */
+  cvc5::Term d_term;
+  /** Whether to minimize or maximize d_term */
+  modes::ObjectiveType d_type;
+  /** Whether d_term is compared as a signed value */
+  bool d_bvSigned;
+}; /* class AddObjectiveCommand */
+
+/**
+ * The command when parsing assert-soft.
+ * This command adds a soft constraint for subsequent optimization queries.
+ */
+class CVC5_EXPORT AssertSoftCommand : public Cmd
+{
+ public:
+  AssertSoftCommand(const cvc5::Term& t,
+                    uint64_t weight,
+                    const std::string& id);
+  /** Get the soft constraint */
+  const cvc5::Term& getTerm() const;
+  /** Get the weight of the soft constraint */
+  uint64_t getWeight() const;
+  /** Get the id of the soft constraint */
+  const std::string& getId() const;
+
+  void invoke(cvc5::Solver* solver, parser::SymManager* sm) override;
+  std::string getCommandName() const override;
+  void toStream(std::ostream& out) const override;
+
+ private:
+  /** The soft constraint */
+  cvc5::Term d_term;
+  /** The weight of the soft constraint */
+  uint64_t d_weight;
+  /** The id of the soft constraint */
+  std::string d_id;
+}; /* class AssertSoftCommand */
+
+/**
+ * The command when parsing check-opt.
+ * This command checks satisfiability of the input formula and optimizes the
+ * current objectives.
+ */
+class CVC5_EXPORT CheckOptCommand : public Cmd
+{
+ public:
+  CheckOptCommand(modes::OptimizationMode mode);
+  /** Get the mode for combining multiple objectives */
+  modes::OptimizationMode getMode() const;
+  cvc5::Result getResult() const;
+  /**
+   * Set the functions that exchange the best values of the objectives with
+   * other solvers working on the same query, see Solver::optimize.
+   *
+   * @param callback The function called on each improvement.
+   * @param bounds The function that provides values found elsewhere.
+   */
+  void setExchange(std::function<bool(const std::vector<cvc5::Term>&)> callback,
+                   std::function<std::vector<cvc5::Term>()> bounds);
+  void invoke(cvc5::Solver* solver, parser::SymManager* sm) override;
+  void printResult(cvc5::Solver* solver, std::ostream& out) const override;
+  std::string getCommandName() const override;
+  void toStream(std::ostream& out) const override;
+
+ private:
+  /** The mode for combining multiple objectives */
+  modes::OptimizationMode d_mode;
+  /** The function called on each improvement, if any */
+  std::function<bool(const std::vector<cvc5::Term>&)> d_callback;
+  /** The function that provides values found elsewhere, if any */
+  std::function<std::vector<cvc5::Term>()> d_bounds;
+  /** The result of the optimization query */
+  cvc5::Result d_result;
+}; /* class CheckOptCommand */
+
 /* ------------------- sygus commands  ------------------ */
 
 /** Declares a sygus universal variable */
@@ -66,8 +66,10 @@ Smt2CmdParser::Smt2CmdParser(Smt2Lexer& lex,
   d_table["set-option"] = Token::SET_OPTION_TOK;
   if (!d_lex.isStrict())
   {
+    d_table["assert-soft"] = Token::ASSERT_SOFT_TOK;
     d_table["block-model"] = Token::BLOCK_MODEL_TOK;
     d_table["block-model-values"] = Token::BLOCK_MODEL_VALUES_TOK;
+    d_table["check-opt"] = Token::CHECK_OPT_TOK;
     d_table["declare-heap"] = Token::DECLARE_HEAP_TOK;
     d_table["declare-oracle-fun"] = Token::DECLARE_ORACLE_FUN_TOK;
     d_table["declare-pool"] = Token::DECLARE_POOL_TOK;
@@ -82,6 +84,8 @@ Smt2CmdParser::Smt2CmdParser(Smt2Lexer& lex,
     d_table["get-qe-disjunct"] = Token::GET_QE_DISJUNCT_TOK;
     d_table["get-qe"] = Token::GET_QE_TOK;
     d_table["include"] = Token::INCLUDE_TOK;
+    d_table["maximize"] = Token::MAXIMIZE_TOK;
+    d_table["minimize"] = Token::MINIMIZE_TOK;
     d_table["simplify"] = Token::SIMPLIFY_TOK;
   }
   if (d_lex.isSygus())
@@ -143,6 +147,38 @@ std::unique_ptr<Cmd> Smt2CmdParser::parseNextCommand()
       }
     }
     break;
+    // (assert-soft <term> [:weight <numeral>] [:id <symbol>])
+    case Token::ASSERT_SOFT_TOK:
+    {
+      d_state.checkThatLogicIsSet();
+      Term t = d_tparser.parseTerm();
+      uint64_t weight = 1;
+      std::string id;
+      while (d_lex.peekToken() == Token::KEYWORD)
+      {
+        std::string key = d_tparser.parseKeyword();
+        if (key == "weight")
+        {
+          Term w = d_tparser.parseTerm();
+          if (!w.isUInt64Value() || w.getUInt64Value() == 0)
+          {
+            d_lex.parseError("Expected a positive numeral as weight");
+          }
+          weight = w.getUInt64Value();
+        }
+        else if (key == "id")
+        {
+          id = d_tparser.parseSymbol(CHECK_NONE, SYM_VARIABLE);
+        }
+        else
+        {
+          d_lex.parseError(std::string("Unknown attribute `") + key
+                           + "' for assert-soft");
+        }
+      }
+      cmd.reset(new AssertSoftCommand(t, weight, id));
+    }
+    break;
     // sygus assume/constraint
     // (assume <term>)
     // (constraint <term>)
@@ -183,6 +219,21 @@ std::unique_ptr<Cmd> Smt2CmdParser::parseNextCommand()
       cmd.reset(new CheckSatCommand());
     }
     break;
+    // (check-opt <keyword>?)
+    case Token::CHECK_OPT_TOK:
+    {
+      // optional keyword
+      tok = d_lex.peekToken();
+      modes::OptimizationMode mode = modes::OptimizationMode::LEX;
+      if (tok == Token::KEYWORD)
+      {
+        std::string key = d_tparser.parseKeyword();
+        mode = d_state.getOptimizationMode(key);
+      }
+      d_state.checkThatLogicIsSet();
+      cmd.reset(new CheckOptCommand(mode));
+    }
+    break;
     // (check-sat-assuming (<term>*))
     case Token::CHECK_SAT_ASSUMING_TOK:
     {
@@ -770,6 +821,30 @@ std::unique_ptr<Cmd> Smt2CmdParser::parseNextCommand()
       cmd = d_state.invConstraint(names);
     }
     break;
+    // (minimize <term> [:signed])
+    // (maximize <term> [:signed])
+    case Token::MAXIMIZE_TOK:
+    case Token::MINIMIZE_TOK:
+    {
+      d_state.checkThatLogicIsSet();
+      Term t = d_tparser.parseTerm();
+      bool bvSigned = false;
+      if (d_lex.peekToken() == Token::KEYWORD)
+      {
+        std::string key = d_tparser.parseKeyword();
+        if (key != "signed")
+        {
+          d_lex.parseError(std::string("Unknown attribute `") + key
+                           + "' for objective");
+        }
+        bvSigned = true;
+      }
+      modes::ObjectiveType type = tok == Token::MINIMIZE_TOK
+                                      ? modes::ObjectiveType::MINIMIZE
+                                      : modes::ObjectiveType::MAXIMIZE;
+      cmd.reset(new AddObjectiveCommand(t, type, bvSigned));
+    }
+    break;
     // (pop <numeral>?)
     case Token::POP_TOK:
     {
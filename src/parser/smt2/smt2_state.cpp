@@ -414,6 +414,25 @@ modes::LearnedLitType Smt2State::getLearnedLitType(const std::string& mode)
   return modes::LearnedLitType::UNKNOWN;
 }
 
+modes::OptimizationMode Smt2State::getOptimizationMode(
+    const std::string& mode)
+{
+  if (mode == "lex")
+  {
+    return modes::OptimizationMode::LEX;
+  }
+  else if (mode == "pareto")
+  {
+    return modes::OptimizationMode::PARETO;
+  }
+  else if (mode == "box")
+  {
+    return modes::OptimizationMode::BOX;
+  }
+  parseError(std::string("Unknown optimization mode `") + mode + "'");
+  return modes::OptimizationMode::LEX;
+}
+
 modes::ProofComponent Smt2State::getProofComponent(const std::string& pc)
 {
   if (pc == "raw_preprocess")
@@ -26,6 +26,7 @@ std::ostream& operator<<(std::ostream& o, Token t)
   {
     case Token::EOF_TOK: o << "EOF_TOK"; break;
     case Token::ALPHA: o << "ALPHA"; break;
+    case Token::ASSERT_SOFT_TOK: o << "ASSERT_SOFT_TOK"; break;
     case Token::ASSERT_TOK: o << "ASSERT_TOK"; break;
     case Token::ASSUME_TOK: o << "ASSUME_TOK"; break;
     case Token::AS_TOK: o << "AS_TOK"; break;
@@ -33,6 +34,7 @@ std::ostream& operator<<(std::ostream& o, Token t)
     case Token::BINARY_LITERAL: o << "BINARY_LITERAL"; break;
     case Token::BLOCK_MODEL_TOK: o << "BLOCK_MODEL_TOK"; break;
     case Token::BLOCK_MODEL_VALUES_TOK: o << "BLOCK_MODEL_VALUES_TOK"; break;
+    case Token::CHECK_OPT_TOK: o << "CHECK_OPT_TOK"; break;
     case Token::CHECK_SAT_ASSUMING_TOK: o << "CHECK_SAT_ASSUMING_TOK"; break;
     case Token::CHECK_SAT_TOK: o << "CHECK_SAT_TOK"; break;
     case Token::CHECK_SYNTH_NEXT_TOK: o << "CHECK_SYNTH_NEXT_TOK"; break;
@@ -97,6 +99,8 @@ std::ostream& operator<<(std::ostream& o, Token t)
     case Token::LET_TOK: o << "LET_TOK"; break;
     case Token::LPAREN_TOK: o << "LPAREN_TOK"; break;
     case Token::MATCH_TOK: o << "MATCH_TOK"; break;
+    case Token::MAXIMIZE_TOK: o << "MAXIMIZE_TOK"; break;
+    case Token::MINIMIZE_TOK: o << "MINIMIZE_TOK"; break;
     case Token::NUMERAL: o << "NUMERAL"; break;
     case Token::PAR_TOK: o << "PAR_TOK"; break;
     case Token::POP_TOK: o << "POP_TOK"; break;
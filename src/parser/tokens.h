@@ -31,6 +31,7 @@ enum Token : uint32_t
 {
   EOF_TOK = 0,
   ALPHA,
+  ASSERT_SOFT_TOK,
   ASSERT_TOK,
   ASSUME_TOK,
   AS_TOK,
@@ -38,6 +39,7 @@ enum Token : uint32_t
   BINARY_LITERAL,
   BLOCK_MODEL_TOK,
   BLOCK_MODEL_VALUES_TOK,
+  CHECK_OPT_TOK,
   CHECK_SAT_ASSUMING_TOK,
   CHECK_SAT_TOK,
   CHECK_SYNTH_NEXT_TOK,
@@ -94,6 +96,8 @@ enum Token : uint32_t
   LET_TOK,
   LPAREN_TOK,
   MATCH_TOK,
+  MAXIMIZE_TOK,
+  MINIMIZE_TOK,
   NUMERAL,
   PAR_TOK,
   POP_TOK,
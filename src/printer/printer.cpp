@@ -377,6 +377,29 @@ void Printer::toStreamCmdQuery(std::ostream& out, Node n) const
   printUnknownCommand(out, "query");
 }
 
+void Printer::toStreamCmdAddObjective(std::ostream& out,
+                                      Node n,
+                                      modes::ObjectiveType type,
+                                      bool bvSigned) const
+{
+  printUnknownCommand(
+      out, type == modes::ObjectiveType::MINIMIZE ? "minimize" : "maximize");
+}
+
+void Printer::toStreamCmdAssertSoft(std::ostream& out,
+                                    Node n,
+                                    uint64_t weight,
+                                    const std::string& id) const
+{
+  printUnknownCommand(out, "assert-soft");
+}
+
+void Printer::toStreamCmdCheckOpt(std::ostream& out,
+                                  modes::OptimizationMode mode) const
+{
+  printUnknownCommand(out, "check-opt");
+}
+
 void Printer::toStreamCmdDeclareVar(std::ostream& out,
                                     const std::string& id,
                                     TypeNode type) const
@@ -193,6 +193,22 @@ class CVC5_EXPORT Printer
   /** Print query command */
   virtual void toStreamCmdQuery(std::ostream& out, Node n) const;
 
+  /** Print minimize or maximize command */
+  virtual void toStreamCmdAddObjective(std::ostream& out,
+                                       Node n,
+                                       modes::ObjectiveType type,
+                                       bool bvSigned) const;
+
+  /** Print assert-soft command */
+  virtual void toStreamCmdAssertSoft(std::ostream& out,
+                                     Node n,
+                                     uint64_t weight,
+                                     const std::string& id) const;
+
+  /** Print check-opt command */
+  virtual void toStreamCmdCheckOpt(std::ostream& out,
+                                   modes::OptimizationMode mode) const;
+
   /** Print declare-var command */
   virtual void toStreamCmdDeclareVar(std::ostream& out,
                                      const std::string& id,
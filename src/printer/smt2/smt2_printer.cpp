@@ -1741,6 +1741,43 @@ void Smt2Printer::toStreamCmdQuery(std::ostream& out, Node n) const
   }
 }
 
+void Smt2Printer::toStreamCmdAddObjective(std::ostream& out,
+                                          Node n,
+                                          modes::ObjectiveType type,
+                                          bool bvSigned) const
+{
+  out << '(' << type << ' ' << n;
+  if (bvSigned)
+  {
+    out << " :signed";
+  }
+  out << ')';
+}
+
+void Smt2Printer::toStreamCmdAssertSoft(std::ostream& out,
+                                        Node n,
+                                        uint64_t weight,
+                                        const std::string& id) const
+{
+  out << "(assert-soft " << n << " :weight " << weight;
+  if (!id.empty())
+  {
+    out << " :id " << cvc5::internal::quoteSymbol(id);
+  }
+  out << ')';
+}
+
+void Smt2Printer::toStreamCmdCheckOpt(std::ostream& out,
+                                      modes::OptimizationMode mode) const
+{
+  out << "(check-opt";
+  if (mode != modes::OptimizationMode::LEX)
+  {
+    out << " :" << mode;
+  }
+  out << ")";
+}
+
 void Smt2Printer::toStreamCmdReset(std::ostream& out) const
 {
   out << "(reset)";
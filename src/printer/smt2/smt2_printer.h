@@ -136,6 +136,22 @@ class Smt2Printer : public cvc5::internal::Printer
   /** Print query command */
   void toStreamCmdQuery(std::ostream& out, Node n) const override;
 
+  /** Print minimize or maximize command */
+  void toStreamCmdAddObjective(std::ostream& out,
+                               Node n,
+                               modes::ObjectiveType type,
+                               bool bvSigned) const override;
+
+  /** Print assert-soft command */
+  void toStreamCmdAssertSoft(std::ostream& out,
+                             Node n,
+                             uint64_t weight,
+                             const std::string& id) const override;
+
+  /** Print check-opt command */
+  void toStreamCmdCheckOpt(std::ostream& out,
+                           modes::OptimizationMode mode) const override;
+
   /** Print declare-var command */
   void toStreamCmdDeclareVar(std::ostream& out,
                              const std::string& id,
@@ -824,6 +824,16 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
     d_var_info[lit.getSatVariable()].phase = lit.isNegated() ? -1 : 1;
   }
 
+  /**
+   * Forget the preferred phase of variable.
+   * @param var The variable.
+   */
+  void unphase(SatVariable var)
+  {
+    d_solver.unphase(toCadicalLit(SatLiteral(var)));
+    d_var_info[var].phase = 0;
+  }
+
   /**
    * Return the activation literal for the current user level.
    *
@@ -1243,6 +1253,32 @@ ClauseId CadicalSolver::addClause(SatClause& clause, bool removable)
   return ClauseIdError;
 }
 
+void CadicalSolver::addClauses(const std::vector<SatLiteral>& lits,
+                               bool removable)
+{
+  // If we are currently in search, add clauses through the propagator.
+  if (d_propagator)
+  {
+    SatSolver::addClauses(lits, removable);
+    return;
+  }
+  Trace("cadical::propagator")
+      << "addClauses (" << removable << "): " << lits.size() << " literals"
+      << std::endl;
+  for (const SatLiteral& lit : lits)
+  {
+    if (lit.isNull())
+    {
+      d_solver->add(0);
+      ++d_statistics.d_numClauses;
+    }
+    else
+    {
+      d_solver->add(toCadicalLit(lit));
+    }
+  }
+}
+
 ClauseId CadicalSolver::addXorClause(SatClause& clause,
                                      bool rhs,
                                      bool removable)
@@ -1372,6 +1408,12 @@ void CadicalSolver::preferPhase(SatLiteral lit)
   d_propagator->phase(lit);
 }
 
+void CadicalSolver::unsetPreferredPhase(SatVariable var)
+{
+  Trace("cadical::propagator") << "unphase: " << var << std::endl;
+  d_propagator->unphase(var);
+}
+
 bool CadicalSolver::isDecision(SatVariable var) const
 {
   return d_solver->is_decision(toCadicalVar(var));
@@ -42,6 +42,8 @@ class CadicalSolver : public CDCLTSatSolver, protected EnvObj
   /* SatSolver interface -------------------------------------------------- */
 
   ClauseId addClause(SatClause& clause, bool removable) override;
+  void addClauses(const std::vector<SatLiteral>& lits,
+                  bool removable) override;
 
   ClauseId addXorClause(SatClause& clause, bool rhs, bool removable) override;
 
@@ -78,6 +80,8 @@ class CadicalSolver : public CDCLTSatSolver, protected EnvObj
 
   void preferPhase(SatLiteral lit) override;
 
+  void unsetPreferredPhase(SatVariable var) override;
+
   bool isDecision(SatVariable var) const override;
 
   bool isFixed(SatVariable var) const override;
@@ -15,12 +15,18 @@
  */
 #include "prop/cnf_stream.h"
 
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include <queue>
+#include <unordered_set>
 
 #include "base/check.h"
 #include "base/output.h"
 #include "expr/node.h"
 #include "options/bv_options.h"
+#include "options/prop_options.h"
+#include "options/smt_options.h"
 #include "printer/printer.h"
 #include "proof/clause_id.h"
 #include "prop/minisat/minisat.h"
@@ -38,13 +44,18 @@ CnfStream::CnfStream(Env& env,
                      Registrar* registrar,
                      context::Context* c,
                      FormulaLitPolicy flpol,
-                     std::string name)
+                     std::string name,
+                     bool polarityAware)
     : EnvObj(env),
       d_satSolver(satSolver),
       d_booleanVariables(c),
       d_notifyFormulas(c),
       d_nodeToLiteralMap(c),
       d_literalToNodeMap(c),
+      d_definedPolarity(c),
+      d_polarityAware(polarityAware),
+      d_detectGates(options().prop.cnfGates
+                    && !options().smt.produceProofs),
       d_flitPolicy(flpol),
       d_registrar(registrar),
       d_name(name),
@@ -119,6 +130,12 @@ void CnfStream::ensureLiteral(TNode n)
   TimerStat::CodeTimer codeTimer(d_stats.d_cnfConversionTime, true);
   if (hasLiteral(n))
   {
+    if (getDefinedPolarity(n) != POL_BOTH)
+    {
+      // complete the definition of a literal converted polarity-aware
+      d_removable = false;
+      toCNF(n, false, POL_BOTH);
+    }
     ensureMappingForLiteral(n);
     return;
   }
@@ -132,7 +149,7 @@ void CnfStream::ensureLiteral(TNode n)
     // These are not removable and have no proof ID
     d_removable = false;
 
-    SatLiteral lit = toCNF(n, false);
+    SatLiteral lit = toCNF(n, false, POL_BOTH);
 
     // Store backward-mappings
     // These may already exist
@@ -303,28 +320,228 @@ SatLiteral CnfStream::getLiteral(TNode node) {
   return literal;
 }
 
-void CnfStream::handleXor(TNode xorNode)
+/**
+ * A Boolean gate, which is a Boolean connective along with its inputs. Nodes
+ * that are not Boolean connectives are atoms, which have no inputs. Negations
+ * are not gates, since they share the literal of their child.
+ */
+struct CnfStream::Gate
+{
+  enum class Type
+  {
+    ATOM,
+    AND,
+    OR,
+    XOR,
+    IFF,
+    IMPLIES,
+    ITE,
+    /**
+     * The conjunction of (or (not x_i) (not x_j)) for all pairs i < j of
+     * x_1, ..., x_n, whose inputs are x_1, ..., x_n followed by the conjuncts
+     */
+    AT_MOST_ONE
+  };
+  /** The type of the gate */
+  Type d_type = Type::ATOM;
+  /** The inputs of the gate */
+  std::vector<TNode> d_inputs;
+  /** The number of variables x_1, ..., x_n of an at-most-one gate */
+  size_t d_numVars = 0;
+  /** Whether the gate was detected in a formula of a different kind */
+  bool d_detected = false;
+};
+
+namespace {
+
+/** Swap the positive and the negative polarity in pol */
+uint32_t flipPolarity(uint32_t pol)
+{
+  return ((pol & CnfStream::POL_POS) ? CnfStream::POL_NEG : 0)
+         | ((pol & CnfStream::POL_NEG) ? CnfStream::POL_POS : 0);
+}
+
+/** Returns true if a is the negation of b */
+bool isNegation(TNode a, TNode b)
+{
+  return (a.getKind() == Kind::NOT && a[0] == b)
+         || (b.getKind() == Kind::NOT && b[0] == a);
+}
+
+}  // namespace
+
+bool CnfStream::isValueDefined(TNode node, bool value) const
+{
+  return (getDefinedPolarity(node) & (value ? POL_POS : POL_NEG)) != 0;
+}
+
+uint32_t CnfStream::getDefinedPolarity(TNode node) const
+{
+  if (node.getKind() == Kind::NOT)
+  {
+    return flipPolarity(getDefinedPolarity(node[0]));
+  }
+  if (!hasLiteral(node))
+  {
+    return 0;
+  }
+  context::CDHashMap<Node, uint32_t>::const_iterator it =
+      d_definedPolarity.find(node);
+  return it == d_definedPolarity.end() ? POL_BOTH : (*it).second;
+}
+
+SatLiteral CnfStream::getOrNewLiteral(TNode node)
+{
+  return hasLiteral(node) ? getLiteral(node) : newLiteral(node);
+}
+
+void CnfStream::getGate(TNode node, Gate& g) const
+{
+  Kind k = node.getKind();
+  switch (k)
+  {
+    case Kind::AND: g.d_type = Gate::Type::AND; break;
+    case Kind::OR: g.d_type = Gate::Type::OR; break;
+    case Kind::XOR: g.d_type = Gate::Type::XOR; break;
+    case Kind::IMPLIES: g.d_type = Gate::Type::IMPLIES; break;
+    case Kind::ITE: g.d_type = Gate::Type::ITE; break;
+    case Kind::EQUAL:
+      if (node[0].getType().isBoolean())
+      {
+        g.d_type = Gate::Type::IFF;
+        break;
+      }
+      CVC5_FALLTHROUGH;
+    default: g.d_type = Gate::Type::ATOM; return;
+  }
+  if (d_detectGates && (k == Kind::AND || k == Kind::OR))
+  {
+    g.d_detected = true;
+    // (or (and c t) (and (not c) e)) and (and (or c e) (or (not c) t)) are
+    // both (ite c t e)
+    Kind dual = k == Kind::AND ? Kind::OR : Kind::AND;
+    if (node.getNumChildren() == 2 && node[0].getKind() == dual
+        && node[1].getKind() == dual && node[0].getNumChildren() == 2
+        && node[1].getNumChildren() == 2)
+    {
+      TNode a = node[0];
+      TNode b = node[1];
+      for (size_t i = 0; i < 2; ++i)
+      {
+        for (size_t j = 0; j < 2; ++j)
+        {
+          if (!isNegation(a[i], b[j]))
+          {
+            continue;
+          }
+          TNode c = a[i];
+          TNode t = k == Kind::OR ? a[1 - i] : b[1 - j];
+          TNode e = k == Kind::OR ? b[1 - j] : a[1 - i];
+          if (t.getKind() == Kind::NOT && t[0] == e)
+          {
+            // (ite c (not e) e) is (xor c e)
+            g.d_type = Gate::Type::XOR;
+            g.d_inputs = {c, e};
+          }
+          else if (e.getKind() == Kind::NOT && e[0] == t)
+          {
+            // (ite c t (not t)) is (= c t)
+            g.d_type = Gate::Type::IFF;
+            g.d_inputs = {c, t};
+          }
+          else
+          {
+            g.d_type = Gate::Type::ITE;
+            g.d_inputs = {c, t, e};
+          }
+          return;
+        }
+      }
+    }
+    // a conjunction of (or (not x_i) (not x_j)) for all pairs i < j
+    if (k == Kind::AND && node.getNumChildren() >= 3)
+    {
+      std::unordered_map<TNode, uint64_t> ids;
+      std::unordered_set<uint64_t> pairs;
+      for (TNode c : node)
+      {
+        if (c.getKind() != Kind::OR || c.getNumChildren() != 2
+            || c[0].getKind() != Kind::NOT || c[1].getKind() != Kind::NOT
+            || c[0][0] == c[1][0])
+        {
+          pairs.clear();
+          break;
+        }
+        uint64_t x = ids.emplace(c[0][0], ids.size()).first->second;
+        uint64_t y = ids.emplace(c[1][0], ids.size()).first->second;
+        pairs.insert(x < y ? (x << 32 | y) : (y << 32 | x));
+      }
+      size_t n = ids.size();
+      if (n >= 3 && pairs.size() == node.getNumChildren()
+          && pairs.size() == n * (n - 1) / 2)
+      {
+        g.d_type = Gate::Type::AT_MOST_ONE;
+        g.d_inputs.resize(n);
+        for (const std::pair<const TNode, uint64_t>& x : ids)
+        {
+          g.d_inputs[x.second] = x.first;
+        }
+        g.d_inputs.insert(g.d_inputs.end(), node.begin(), node.end());
+        g.d_numVars = n;
+        return;
+      }
+    }
+    g.d_detected = false;
+  }
+  g.d_inputs.insert(g.d_inputs.end(), node.begin(), node.end());
+}
+
+uint32_t CnfStream::inputPolarity(const Gate& g, size_t i, uint32_t pol)
+{
+  switch (g.d_type)
+  {
+    case Gate::Type::AND:
+    case Gate::Type::OR: return pol;
+    case Gate::Type::IMPLIES: return i == 0 ? flipPolarity(pol) : pol;
+    case Gate::Type::XOR:
+    case Gate::Type::IFF: return pol == 0 ? 0 : POL_BOTH;
+    case Gate::Type::ITE: return i == 0 && pol != 0 ? POL_BOTH : pol;
+    case Gate::Type::AT_MOST_ONE:
+      // the variables occur negatively in the clauses of the positive
+      // polarity, the conjuncts in the clause of the negative polarity
+      if (i < g.d_numVars)
+      {
+        return (pol & POL_POS) ? POL_NEG : 0;
+      }
+      return pol & POL_NEG;
+    default: return 0;
+  }
+}
+
+void CnfStream::handleXor(TNode xorNode, TNode lhs, TNode rhs, uint32_t pol)
 {
-  Assert(!hasLiteral(xorNode)) << "Atom already mapped!";
-  Assert(xorNode.getKind() == Kind::XOR) << "Expecting an XOR expression!";
-  Assert(xorNode.getNumChildren() == 2) << "Expecting exactly 2 children!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
   Trace("cnf") << "CnfStream::handleXor(" << xorNode << ")\n";
 
-  SatLiteral a = getLiteral(xorNode[0]);
-  SatLiteral b = getLiteral(xorNode[1]);
+  SatLiteral a = getLiteral(lhs);
+  SatLiteral b = getLiteral(rhs);
 
-  SatLiteral xorLit = newLiteral(xorNode);
+  SatLiteral xorLit = getOrNewLiteral(xorNode);
 
-  assertClause(xorNode.negate(), a, b, ~xorLit);
-  assertClause(xorNode.negate(), ~a, ~b, ~xorLit);
-  assertClause(xorNode, a, ~b, xorLit);
-  assertClause(xorNode, ~a, b, xorLit);
+  if (pol & POL_POS)
+  {
+    assertClause(xorNode.negate(), a, b, ~xorLit);
+    assertClause(xorNode.negate(), ~a, ~b, ~xorLit);
+  }
+  if (pol & POL_NEG)
+  {
+    assertClause(xorNode, a, ~b, xorLit);
+    assertClause(xorNode, ~a, b, xorLit);
+  }
 }
 
-void CnfStream::handleOr(TNode orNode)
+void CnfStream::handleOr(TNode orNode, uint32_t pol)
 {
-  Assert(!hasLiteral(orNode)) << "Atom already mapped!";
   Assert(orNode.getKind() == Kind::OR) << "Expecting an OR expression!";
   Assert(orNode.getNumChildren() > 1) << "Expecting more then 1 child!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
@@ -334,7 +551,7 @@ void CnfStream::handleOr(TNode orNode)
   size_t numChildren = orNode.getNumChildren();
 
   // Get the literal for this node
-  SatLiteral orLit = newLiteral(orNode);
+  SatLiteral orLit = getOrNewLiteral(orNode);
 
   // Transform all the children first
   SatClause clause(numChildren + 1);
@@ -345,19 +562,25 @@ void CnfStream::handleOr(TNode orNode)
     // lit <- (a_1 | a_2 | a_3 | ... | a_n)
     // lit | ~(a_1 | a_2 | a_3 | ... | a_n)
     // (lit | ~a_1) & (lit | ~a_2) & (lit & ~a_3) & ... & (lit & ~a_n)
-    assertClause(orNode, orLit, ~clause[i]);
+    if (pol & POL_NEG)
+    {
+      assertClause(orNode, orLit, ~clause[i]);
+    }
   }
 
-  // lit -> (a_1 | a_2 | a_3 | ... | a_n)
-  // ~lit | a_1 | a_2 | a_3 | ... | a_n
-  clause[numChildren] = ~orLit;
-  // This needs to go last, as the clause might get modified by the SAT solver
-  assertClause(orNode.negate(), clause);
+  if (pol & POL_POS)
+  {
+    // lit -> (a_1 | a_2 | a_3 | ... | a_n)
+    // ~lit | a_1 | a_2 | a_3 | ... | a_n
+    clause[numChildren] = ~orLit;
+    // This needs to go last, as the clause might get modified by the SAT
+    // solver
+    assertClause(orNode.negate(), clause);
+  }
 }
 
-void CnfStream::handleAnd(TNode andNode)
+void CnfStream::handleAnd(TNode andNode, uint32_t pol)
 {
-  Assert(!hasLiteral(andNode)) << "Atom already mapped!";
   Assert(andNode.getKind() == Kind::AND) << "Expecting an AND expression!";
   Assert(andNode.getNumChildren() > 1) << "Expecting more than 1 child!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
@@ -367,7 +590,7 @@ void CnfStream::handleAnd(TNode andNode)
   size_t numChildren = andNode.getNumChildren();
 
   // Get the literal for this node
-  SatLiteral andLit = newLiteral(andNode);
+  SatLiteral andLit = getOrNewLiteral(andNode);
 
   // Transform all the children first (remembering the negation)
   SatClause clause(numChildren + 1);
@@ -378,20 +601,26 @@ void CnfStream::handleAnd(TNode andNode)
     // lit -> (a_1 & a_2 & a_3 & ... & a_n)
     // ~lit | (a_1 & a_2 & a_3 & ... & a_n)
     // (~lit | a_1) & (~lit | a_2) & ... & (~lit | a_n)
-    assertClause(andNode.negate(), ~andLit, ~clause[i]);
+    if (pol & POL_POS)
+    {
+      assertClause(andNode.negate(), ~andLit, ~clause[i]);
+    }
   }
 
-  // lit <- (a_1 & a_2 & a_3 & ... a_n)
-  // lit | ~(a_1 & a_2 & a_3 & ... & a_n)
-  // lit | ~a_1 | ~a_2 | ~a_3 | ... | ~a_n
-  clause[numChildren] = andLit;
-  // This needs to go last, as the clause might get modified by the SAT solver
-  assertClause(andNode, clause);
+  if (pol & POL_NEG)
+  {
+    // lit <- (a_1 & a_2 & a_3 & ... a_n)
+    // lit | ~(a_1 & a_2 & a_3 & ... & a_n)
+    // lit | ~a_1 | ~a_2 | ~a_3 | ... | ~a_n
+    clause[numChildren] = andLit;
+    // This needs to go last, as the clause might get modified by the SAT
+    // solver
+    assertClause(andNode, clause);
+  }
 }
 
-void CnfStream::handleImplies(TNode impliesNode)
+void CnfStream::handleImplies(TNode impliesNode, uint32_t pol)
 {
-  Assert(!hasLiteral(impliesNode)) << "Atom already mapped!";
   Assert(impliesNode.getKind() == Kind::IMPLIES)
       << "Expecting an IMPLIES expression!";
   Assert(impliesNode.getNumChildren() == 2) << "Expecting exactly 2 children!";
@@ -402,153 +631,261 @@ void CnfStream::handleImplies(TNode impliesNode)
   SatLiteral a = getLiteral(impliesNode[0]);
   SatLiteral b = getLiteral(impliesNode[1]);
 
-  SatLiteral impliesLit = newLiteral(impliesNode);
+  SatLiteral impliesLit = getOrNewLiteral(impliesNode);
 
-  // lit -> (a->b)
-  // ~lit | ~ a | b
-  assertClause(impliesNode.negate(), ~impliesLit, ~a, b);
+  if (pol & POL_POS)
+  {
+    // lit -> (a->b)
+    // ~lit | ~ a | b
+    assertClause(impliesNode.negate(), ~impliesLit, ~a, b);
+  }
 
-  // (a->b) -> lit
-  // ~(~a | b) | lit
-  // (a | l) & (~b | l)
-  assertClause(impliesNode, a, impliesLit);
-  assertClause(impliesNode, ~b, impliesLit);
+  if (pol & POL_NEG)
+  {
+    // (a->b) -> lit
+    // ~(~a | b) | lit
+    // (a | l) & (~b | l)
+    assertClause(impliesNode, a, impliesLit);
+    assertClause(impliesNode, ~b, impliesLit);
+  }
 }
 
-void CnfStream::handleIff(TNode iffNode)
+void CnfStream::handleIff(TNode iffNode, TNode lhs, TNode rhs, uint32_t pol)
 {
-  Assert(!hasLiteral(iffNode)) << "Atom already mapped!";
-  Assert(iffNode.getKind() == Kind::EQUAL) << "Expecting an EQUAL expression!";
-  Assert(iffNode.getNumChildren() == 2) << "Expecting exactly 2 children!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
   Trace("cnf") << "handleIff(" << iffNode << ")\n";
 
   // Convert the children to CNF
-  SatLiteral a = getLiteral(iffNode[0]);
-  SatLiteral b = getLiteral(iffNode[1]);
+  SatLiteral a = getLiteral(lhs);
+  SatLiteral b = getLiteral(rhs);
 
   // Get the now literal
-  SatLiteral iffLit = newLiteral(iffNode);
+  SatLiteral iffLit = getOrNewLiteral(iffNode);
 
-  // lit -> ((a-> b) & (b->a))
-  // ~lit | ((~a | b) & (~b | a))
-  // (~a | b | ~lit) & (~b | a | ~lit)
-  assertClause(iffNode.negate(), ~a, b, ~iffLit);
-  assertClause(iffNode.negate(), a, ~b, ~iffLit);
+  if (pol & POL_POS)
+  {
+    // lit -> ((a-> b) & (b->a))
+    // ~lit | ((~a | b) & (~b | a))
+    // (~a | b | ~lit) & (~b | a | ~lit)
+    assertClause(iffNode.negate(), ~a, b, ~iffLit);
+    assertClause(iffNode.negate(), a, ~b, ~iffLit);
+  }
 
-  // (a<->b) -> lit
-  // ~((a & b) | (~a & ~b)) | lit
-  // (~(a & b)) & (~(~a & ~b)) | lit
-  // ((~a | ~b) & (a | b)) | lit
-  // (~a | ~b | lit) & (a | b | lit)
-  assertClause(iffNode, ~a, ~b, iffLit);
-  assertClause(iffNode, a, b, iffLit);
+  if (pol & POL_NEG)
+  {
+    // (a<->b) -> lit
+    // ~((a & b) | (~a & ~b)) | lit
+    // (~(a & b)) & (~(~a & ~b)) | lit
+    // ((~a | ~b) & (a | b)) | lit
+    // (~a | ~b | lit) & (a | b | lit)
+    assertClause(iffNode, ~a, ~b, iffLit);
+    assertClause(iffNode, a, b, iffLit);
+  }
 }
 
-void CnfStream::handleIte(TNode iteNode)
+void CnfStream::handleIte(
+    TNode iteNode, TNode cond, TNode thenNode, TNode elseNode, uint32_t pol)
 {
-  Assert(!hasLiteral(iteNode)) << "Atom already mapped!";
-  Assert(iteNode.getKind() == Kind::ITE);
-  Assert(iteNode.getNumChildren() == 3);
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
-  Trace("cnf") << "handleIte(" << iteNode[0] << " " << iteNode[1] << " "
-               << iteNode[2] << ")\n";
-
-  SatLiteral condLit = getLiteral(iteNode[0]);
-  SatLiteral thenLit = getLiteral(iteNode[1]);
-  SatLiteral elseLit = getLiteral(iteNode[2]);
-
-  SatLiteral iteLit = newLiteral(iteNode);
-
-  // If ITE is true then one of the branches is true and the condition
-  // implies which one
-  // lit -> (ite b t e)
-  // lit -> (t | e) & (b -> t) & (!b -> e)
-  // lit -> (t | e) & (!b | t) & (b | e)
-  // (!lit | t | e) & (!lit | !b | t) & (!lit | b | e)
-  assertClause(iteNode.negate(), ~iteLit, thenLit, elseLit);
-  assertClause(iteNode.negate(), ~iteLit, ~condLit, thenLit);
-  assertClause(iteNode.negate(), ~iteLit, condLit, elseLit);
-
-  // If ITE is false then one of the branches is false and the condition
-  // implies which one
-  // !lit -> !(ite b t e)
-  // !lit -> (!t | !e) & (b -> !t) & (!b -> !e)
-  // !lit -> (!t | !e) & (!b | !t) & (b | !e)
-  // (lit | !t | !e) & (lit | !b | !t) & (lit | b | !e)
-  assertClause(iteNode, iteLit, ~thenLit, ~elseLit);
-  assertClause(iteNode, iteLit, ~condLit, ~thenLit);
-  assertClause(iteNode, iteLit, condLit, ~elseLit);
+  Trace("cnf") << "handleIte(" << cond << " " << thenNode << " " << elseNode
+               << ")\n";
+
+  SatLiteral condLit = getLiteral(cond);
+  SatLiteral thenLit = getLiteral(thenNode);
+  SatLiteral elseLit = getLiteral(elseNode);
+
+  SatLiteral iteLit = getOrNewLiteral(iteNode);
+
+  if (pol & POL_POS)
+  {
+    // If ITE is true then one of the branches is true and the condition
+    // implies which one
+    // lit -> (ite b t e)
+    // lit -> (t | e) & (b -> t) & (!b -> e)
+    // lit -> (t | e) & (!b | t) & (b | e)
+    // (!lit | t | e) & (!lit | !b | t) & (!lit | b | e)
+    assertClause(iteNode.negate(), ~iteLit, thenLit, elseLit);
+    assertClause(iteNode.negate(), ~iteLit, ~condLit, thenLit);
+    assertClause(iteNode.negate(), ~iteLit, condLit, elseLit);
+  }
+
+  if (pol & POL_NEG)
+  {
+    // If ITE is false then one of the branches is false and the condition
+    // implies which one
+    // !lit -> !(ite b t e)
+    // !lit -> (!t | !e) & (b -> !t) & (!b -> !e)
+    // !lit -> (!t | !e) & (!b | !t) & (b | !e)
+    // (lit | !t | !e) & (lit | !b | !t) & (lit | b | !e)
+    assertClause(iteNode, iteLit, ~thenLit, ~elseLit);
+    assertClause(iteNode, iteLit, ~condLit, ~thenLit);
+    assertClause(iteNode, iteLit, condLit, ~elseLit);
+  }
+}
+
+void CnfStream::handleAtMostOne(TNode amoNode, const Gate& g, uint32_t pol)
+{
+  Assert(g.d_type == Gate::Type::AT_MOST_ONE);
+  Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
+  Trace("cnf") << "handleAtMostOne(" << amoNode << ")\n";
+
+  SatLiteral amoLit = getOrNewLiteral(amoNode);
+
+  if (pol & POL_POS)
+  {
+    // lit -> (~x_i | ~x_j) for all i < j, which does not need literals for
+    // the conjuncts
+    std::vector<SatLiteral> vars;
+    for (size_t i = 0; i < g.d_numVars; ++i)
+    {
+      vars.push_back(getLiteral(g.d_inputs[i]));
+    }
+    for (size_t i = 0, n = vars.size(); i < n; ++i)
+    {
+      for (size_t j = i + 1; j < n; ++j)
+      {
+        assertClause(amoNode.negate(), ~amoLit, ~vars[i], ~vars[j]);
+      }
+    }
+  }
+
+  if (pol & POL_NEG)
+  {
+    // as for the conjunction of the conjuncts c_1, ..., c_k
+    // lit | ~c_1 | ... | ~c_k
+    SatClause clause;
+    for (size_t i = g.d_numVars, n = g.d_inputs.size(); i < n; ++i)
+    {
+      clause.push_back(~getLiteral(g.d_inputs[i]));
+    }
+    clause.push_back(amoLit);
+    assertClause(amoNode, clause);
+  }
 }
 
 SatLiteral CnfStream::toCNF(TNode node, bool negated)
+{
+  return toCNF(node, negated, negated ? POL_NEG : POL_POS);
+}
+
+SatLiteral CnfStream::toCNF(TNode node, bool negated, uint32_t pol)
 {
   Trace("cnf") << "toCNF(" << node
                << ", negated = " << (negated ? "true" : "false") << ")\n";
 
-  TNode cur;
-  SatLiteral nodeLit;
-  std::vector<TNode> visit;
-  std::unordered_map<TNode, bool> cache;
-
-  visit.push_back(node);
-  while (!visit.empty())
+  if (!d_polarityAware)
+  {
+    pol = POL_BOTH;
+  }
+  // The gates of the nodes to convert, and the polarities in which their
+  // literals must be defined in addition to the ones they are defined in.
+  // These are computed first, since a node may be reached in different
+  // polarities.
+  std::unordered_map<TNode, Gate> gates;
+  std::unordered_map<TNode, uint32_t> need;
+  std::vector<std::pair<TNode, uint32_t>> polVisit;
+  polVisit.emplace_back(node, pol);
+  while (!polVisit.empty())
   {
-    cur = visit.back();
+    auto [cur, p] = polVisit.back();
+    polVisit.pop_back();
     Assert(cur.getType().isBoolean());
-
-    if (hasLiteral(cur))
+    if (cur.getKind() == Kind::NOT)
     {
-      visit.pop_back();
+      polVisit.emplace_back(cur[0], flipPolarity(p));
       continue;
     }
-
-    const auto& it = cache.find(cur);
-    if (it == cache.end())
+    uint32_t& n = need[cur];
+    uint32_t add = p & ~(n | getDefinedPolarity(cur));
+    if (add == 0)
+    {
+      continue;
+    }
+    n |= add;
+    auto [it, inserted] = gates.try_emplace(cur);
+    if (inserted)
     {
-      cache.emplace(cur, false);
-      Kind k = cur.getKind();
-      // Only traverse Boolean nodes
-      if (k == Kind::NOT || k == Kind::XOR || k == Kind::ITE
-          || k == Kind::IMPLIES || k == Kind::OR || k == Kind::AND
-          || (k == Kind::EQUAL && cur[0].getType().isBoolean()))
+      getGate(cur, it->second);
+    }
+    const Gate& g = it->second;
+    for (size_t i = 0, size = g.d_inputs.size(); i < size; ++i)
+    {
+      uint32_t ip = inputPolarity(g, i, add);
+      if (ip != 0)
       {
-        // Preserve the order of the recursive version
-        for (size_t i = 0, size = cur.getNumChildren(); i < size; ++i)
-        {
-          visit.push_back(cur[size - 1 - i]);
-        }
+        polVisit.emplace_back(g.d_inputs[i], ip);
       }
+    }
+  }
+
+  // convert the gates, inputs first
+  std::unordered_set<TNode> visited;
+  std::vector<TNode> visit;
+  visit.push_back(node);
+  while (!visit.empty())
+  {
+    TNode cur = visit.back();
+    if (cur.getKind() == Kind::NOT)
+    {
+      visit.back() = cur[0];
       continue;
     }
-    else if (!it->second)
+    auto itn = need.find(cur);
+    if (itn == need.end() || itn->second == 0)
     {
-      it->second = true;
-      Kind k = cur.getKind();
-      switch (k)
+      visit.pop_back();
+      continue;
+    }
+    const Gate& g = gates[cur];
+    if (visited.insert(cur).second)
+    {
+      // Preserve the order of the recursive version
+      for (size_t i = g.d_inputs.size(); i > 0; --i)
       {
-        case Kind::NOT: Assert(hasLiteral(cur[0])); break;
-        case Kind::XOR: handleXor(cur); break;
-        case Kind::ITE: handleIte(cur); break;
-        case Kind::IMPLIES: handleImplies(cur); break;
-        case Kind::OR: handleOr(cur); break;
-        case Kind::AND: handleAnd(cur); break;
-        default:
-          if (k == Kind::EQUAL && cur[0].getType().isBoolean())
-          {
-            handleIff(cur);
-          }
-          else
-          {
-            convertAtom(cur);
-          }
-          break;
+        visit.push_back(g.d_inputs[i - 1]);
       }
+      continue;
     }
     visit.pop_back();
+    // the node may have been converted in the meantime by a lemma sent while
+    // preregistering an atom
+    uint32_t defined = getDefinedPolarity(cur);
+    uint32_t add = itn->second & ~defined;
+    itn->second = 0;
+    if (add == 0)
+    {
+      continue;
+    }
+    switch (g.d_type)
+    {
+      case Gate::Type::ATOM: convertAtom(cur); continue;
+      case Gate::Type::AND: handleAnd(cur, add); break;
+      case Gate::Type::OR: handleOr(cur, add); break;
+      case Gate::Type::XOR:
+        handleXor(cur, g.d_inputs[0], g.d_inputs[1], add);
+        break;
+      case Gate::Type::IFF:
+        handleIff(cur, g.d_inputs[0], g.d_inputs[1], add);
+        break;
+      case Gate::Type::IMPLIES: handleImplies(cur, add); break;
+      case Gate::Type::ITE:
+        handleIte(cur, g.d_inputs[0], g.d_inputs[1], g.d_inputs[2], add);
+        break;
+      case Gate::Type::AT_MOST_ONE: handleAtMostOne(cur, g, add); break;
+    }
+    if (g.d_detected && defined == 0)
+    {
+      ++d_stats.d_numGates;
+    }
+    defined |= add;
+    if (defined != POL_BOTH
+        || d_definedPolarity.find(cur) != d_definedPolarity.end())
+    {
+      d_definedPolarity.insert(cur, defined);
+    }
   }
 
-  nodeLit = getLiteral(node);
+  SatLiteral nodeLit = getLiteral(node);
   Trace("cnf") << "toCNF(): resulting literal: "
                << (!negated ? nodeLit : ~nodeLit) << "\n";
   return negated ? ~nodeLit : nodeLit;
@@ -611,8 +948,8 @@ void CnfStream::convertAndAssertXor(TNode node, bool negated)
                << ", negated = " << (negated ? "true" : "false") << ")\n";
   if (!negated) {
     // p XOR q
-    SatLiteral p = toCNF(node[0], false);
-    SatLiteral q = toCNF(node[1], false);
+    SatLiteral p = toCNF(node[0], false, POL_BOTH);
+    SatLiteral q = toCNF(node[1], false, POL_BOTH);
     // Construct the clauses (p => !q) and (!q => p)
     SatClause clause1(2);
     clause1[0] = ~p;
@@ -624,8 +961,8 @@ void CnfStream::convertAndAssertXor(TNode node, bool negated)
     assertClause(node, clause2);
   } else {
     // !(p XOR q) is the same as p <=> q
-    SatLiteral p = toCNF(node[0], false);
-    SatLiteral q = toCNF(node[1], false);
+    SatLiteral p = toCNF(node[0], false, POL_BOTH);
+    SatLiteral q = toCNF(node[1], false, POL_BOTH);
     // Construct the clauses (p => q) and (q => p)
     SatClause clause1(2);
     clause1[0] = ~p;
@@ -645,8 +982,8 @@ void CnfStream::convertAndAssertIff(TNode node, bool negated)
                << ", negated = " << (negated ? "true" : "false") << ")\n";
   if (!negated) {
     // p <=> q
-    SatLiteral p = toCNF(node[0], false);
-    SatLiteral q = toCNF(node[1], false);
+    SatLiteral p = toCNF(node[0], false, POL_BOTH);
+    SatLiteral q = toCNF(node[1], false, POL_BOTH);
     // Construct the clauses (p => q) and (q => p)
     SatClause clause1(2);
     clause1[0] = ~p;
@@ -658,8 +995,8 @@ void CnfStream::convertAndAssertIff(TNode node, bool negated)
     assertClause(node, clause2);
   } else {
     // !(p <=> q) is the same as p XOR q
-    SatLiteral p = toCNF(node[0], false);
-    SatLiteral q = toCNF(node[1], false);
+    SatLiteral p = toCNF(node[0], false, POL_BOTH);
+    SatLiteral q = toCNF(node[1], false, POL_BOTH);
     // Construct the clauses (p => !q) and (!q => p)
     SatClause clause1(2);
     clause1[0] = ~p;
@@ -679,7 +1016,7 @@ void CnfStream::convertAndAssertImplies(TNode node, bool negated)
                << ", negated = " << (negated ? "true" : "false") << ")\n";
   if (!negated) {
     // p => q
-    SatLiteral p = toCNF(node[0], false);
+    SatLiteral p = toCNF(node[0], false, POL_NEG);
     SatLiteral q = toCNF(node[1], false);
     // Construct the clause ~p || q
     SatClause clause(2);
@@ -699,7 +1036,7 @@ void CnfStream::convertAndAssertIte(TNode node, bool negated)
   Trace("cnf") << "CnfStream::convertAndAssertIte(" << node
                << ", negated = " << (negated ? "true" : "false") << ")\n";
   // ITE(p, q, r)
-  SatLiteral p = toCNF(node[0], false);
+  SatLiteral p = toCNF(node[0], false, POL_BOTH);
   SatLiteral q = toCNF(node[1], negated);
   SatLiteral r = toCNF(node[2], negated);
   // Construct the clauses:
@@ -769,11 +1106,434 @@ void CnfStream::convertAndAssert(TNode node, bool negated)
   }
 }
 
+/**
+ * The state of a batched conversion. The top-level structure of each
+ * assertion is decomposed into clauses over references to Boolean subterms,
+ * as done by convertAndAssert. Each referenced subterm is registered once,
+ * which traverses its Boolean structure and assigns indices to the subterms
+ * in post-order, such that children have smaller indices than their parents.
+ * The literals of the subterms are then defined in the order of their
+ * indices, and all clauses are buffered until the end of the batch.
+ */
+class CnfStream::Batch
+{
+ public:
+  Batch(CnfStream& cs) : d_cs(cs) {}
+
+  /** Decompose the assertion of node with the given polarity into clauses */
+  void addAssertion(TNode node, bool negated);
+  /** Define the literals of all subterms and assert all clauses */
+  void finish();
+
+ private:
+  /** A reference to a subterm, possibly negated */
+  struct Ref
+  {
+    uint32_t d_index;
+    bool d_negated;
+    Ref operator~() const { return Ref{d_index, !d_negated}; }
+  };
+  /** A subterm */
+  struct Entry
+  {
+    TNode d_node;
+    /** The literal of the subterm, if d_defined is true */
+    SatLiteral d_lit;
+    bool d_defined;
+    /** The range of the indices of its children in d_children */
+    size_t d_childBegin;
+    size_t d_childEnd;
+  };
+
+  /** Returns true if the literal of n is defined by its Boolean structure */
+  static bool isConnective(TNode n)
+  {
+    Kind k = n.getKind();
+    return k == Kind::NOT || k == Kind::XOR || k == Kind::ITE
+           || k == Kind::IMPLIES || k == Kind::OR || k == Kind::AND
+           || (k == Kind::EQUAL && n[0].getType().isBoolean());
+  }
+  /** Register n and its subterms, and return a reference to n */
+  Ref ref(TNode n, bool negated);
+  /** Get the literal of a reference to a defined subterm */
+  SatLiteral lit(Ref r) const
+  {
+    Assert(d_entries[r.d_index].d_defined);
+    SatLiteral l = d_entries[r.d_index].d_lit;
+    return r.d_negated ? ~l : l;
+  }
+  /** Get the literal of the i^th child of e */
+  SatLiteral child(const Entry& e, size_t i) const
+  {
+    Assert(e.d_childBegin + i < e.d_childEnd);
+    return d_entries[d_children[e.d_childBegin + i]].d_lit;
+  }
+  /** Define the literal of e and add its defining clauses */
+  void define(Entry& e);
+  /** Add a top-level clause */
+  void addTopClause(std::initializer_list<Ref> refs)
+  {
+    d_topRefs.insert(d_topRefs.end(), refs);
+    d_topEnds.push_back(d_topRefs.size());
+  }
+  /** Add a clause to the buffer */
+  void addClause(std::initializer_list<SatLiteral> lits)
+  {
+    d_lits.insert(d_lits.end(), lits);
+    d_lits.push_back(undefSatLiteral);
+  }
+
+  /** The number of bits of the id of a node within its page of d_index */
+  static constexpr uint64_t PAGE_BITS = 10;
+  /** The number of ids of a page of d_index */
+  static constexpr size_t PAGE_SIZE = static_cast<size_t>(1) << PAGE_BITS;
+  /** The index of subterms that are not registered */
+  static constexpr uint32_t UNREGISTERED = std::numeric_limits<uint32_t>::max();
+  /** The index of subterms that are being registered */
+  static constexpr uint32_t VISITING = UNREGISTERED - 1;
+  /** Get the index of n, which is UNREGISTERED if n is not registered */
+  uint32_t getIndex(TNode n) const
+  {
+    uint64_t id = n.getId();
+    size_t page = static_cast<size_t>(id >> PAGE_BITS);
+    if (page >= d_index.size() || d_index[page] == nullptr)
+    {
+      return UNREGISTERED;
+    }
+    return d_index[page][id & (PAGE_SIZE - 1)];
+  }
+  /** Get a reference to the index of n, allocating its page if needed */
+  uint32_t& index(TNode n)
+  {
+    uint64_t id = n.getId();
+    size_t page = static_cast<size_t>(id >> PAGE_BITS);
+    if (page >= d_index.size())
+    {
+      d_index.resize(page + 1);
+    }
+    if (d_index[page] == nullptr)
+    {
+      d_index[page].reset(new uint32_t[PAGE_SIZE]);
+      std::fill_n(d_index[page].get(), PAGE_SIZE, UNREGISTERED);
+    }
+    return d_index[page][id & (PAGE_SIZE - 1)];
+  }
+
+  /** The CNF stream */
+  CnfStream& d_cs;
+  /**
+   * The indices of the registered subterms, by node id. The ids are split
+   * into pages of PAGE_SIZE consecutive ids, which are allocated when a
+   * subterm with an id of the page is registered, so that looking up a
+   * subterm does not hash.
+   */
+  std::vector<std::unique_ptr<uint32_t[]>> d_index;
+  /** The registered subterms, by index */
+  std::vector<Entry> d_entries;
+  /** The indices of the children of the registered subterms */
+  std::vector<uint32_t> d_children;
+  /** The top-level clauses and the ends of each clause in d_topRefs */
+  std::vector<Ref> d_topRefs;
+  std::vector<size_t> d_topEnds;
+  /**
+   * The buffered clauses, each of which is terminated by undefSatLiteral, see
+   * SatSolver::addClauses
+   */
+  std::vector<SatLiteral> d_lits;
+};
+
+void CnfStream::Batch::addAssertion(TNode node, bool negated)
+{
+  std::vector<std::pair<TNode, bool>> visit;
+  visit.emplace_back(node, negated);
+  while (!visit.empty())
+  {
+    auto [cur, neg] = visit.back();
+    visit.pop_back();
+    Trace("cnf") << "CnfStream::Batch::addAssertion(" << cur
+                 << ", negated = " << (neg ? "true" : "false") << ")\n";
+    d_cs.resourceManager()->spendResource(Resource::CnfStep);
+    Kind k = cur.getKind();
+    if (k == Kind::EQUAL && !cur[0].getType().isBoolean())
+    {
+      k = Kind::UNDEFINED_KIND;
+    }
+    switch (k)
+    {
+      case Kind::NOT: visit.emplace_back(cur[0], !neg); break;
+      case Kind::AND:
+      case Kind::OR:
+        if ((k == Kind::AND) != neg)
+        {
+          // a conjunction, whose conjuncts are asserted separately in order
+          for (size_t i = cur.getNumChildren(); i > 0; --i)
+          {
+            visit.emplace_back(cur[i - 1], neg);
+          }
+        }
+        else
+        {
+          // a disjunction
+          for (TNode c : cur)
+          {
+            d_topRefs.push_back(ref(c, neg));
+          }
+          d_topEnds.push_back(d_topRefs.size());
+        }
+        break;
+      case Kind::XOR:
+      case Kind::EQUAL:
+      {
+        Ref p = ref(cur[0], false);
+        Ref q = ref(cur[1], false);
+        if ((k == Kind::XOR) != neg)
+        {
+          addTopClause({~p, ~q});
+          addTopClause({p, q});
+        }
+        else
+        {
+          addTopClause({~p, q});
+          addTopClause({p, ~q});
+        }
+        break;
+      }
+      case Kind::IMPLIES:
+        if (!neg)
+        {
+          addTopClause({~ref(cur[0], false), ref(cur[1], false)});
+        }
+        else
+        {
+          visit.emplace_back(cur[1], true);
+          visit.emplace_back(cur[0], false);
+        }
+        break;
+      case Kind::ITE:
+      {
+        Ref p = ref(cur[0], false);
+        Ref q = ref(cur[1], neg);
+        Ref r = ref(cur[2], neg);
+        addTopClause({~p, q});
+        addTopClause({p, r});
+        break;
+      }
+      default: addTopClause({ref(cur, neg)}); break;
+    }
+  }
+}
+
+CnfStream::Batch::Ref CnfStream::Batch::ref(TNode n, bool negated)
+{
+  uint32_t i = getIndex(n);
+  if (i != UNREGISTERED)
+  {
+    Assert(i != VISITING);
+    return Ref{i, negated};
+  }
+  std::vector<TNode> visit;
+  visit.push_back(n);
+  while (!visit.empty())
+  {
+    TNode cur = visit.back();
+    uint32_t& ic = index(cur);
+    if (ic != UNREGISTERED && ic != VISITING)
+    {
+      // already registered
+      visit.pop_back();
+      continue;
+    }
+    if (ic == UNREGISTERED)
+    {
+      Assert(cur.getType().isBoolean());
+      ic = VISITING;
+      NodeToLiteralMap::const_iterator itl =
+          d_cs.d_nodeToLiteralMap.find(cur);
+      if (itl != d_cs.d_nodeToLiteralMap.end())
+      {
+        if (d_cs.getDefinedPolarity(cur) != POL_BOTH)
+        {
+          // converted polarity-aware before, the literal is used in both
+          // polarities here
+          d_cs.toCNF(cur, false, POL_BOTH);
+        }
+        // converted before, we do not traverse it
+        index(cur) = d_entries.size();
+        size_t end = d_children.size();
+        d_entries.push_back(Entry{cur, (*itl).second, true, end, end});
+        visit.pop_back();
+        continue;
+      }
+      if (isConnective(cur))
+      {
+        for (size_t j = cur.getNumChildren(); j > 0; --j)
+        {
+          visit.push_back(cur[j - 1]);
+        }
+        continue;
+      }
+    }
+    // all children are registered
+    size_t begin = d_children.size();
+    if (isConnective(cur))
+    {
+      for (TNode c : cur)
+      {
+        Assert(getIndex(c) < VISITING);
+        d_children.push_back(getIndex(c));
+      }
+    }
+    index(cur) = d_entries.size();
+    d_entries.push_back(
+        Entry{cur, SatLiteral(), false, begin, d_children.size()});
+    visit.pop_back();
+  }
+  return Ref{getIndex(n), negated};
+}
+
+void CnfStream::Batch::define(Entry& e)
+{
+  TNode node = e.d_node;
+  Kind k = node.getKind();
+  e.d_defined = true;
+  if (k == Kind::NOT)
+  {
+    // the literal of the negation is registered with the one of its child
+    e.d_lit = ~child(e, 0);
+    return;
+  }
+  // the literal may have been introduced by a lemma while preregistering the
+  // atoms of this batch
+  if (d_cs.hasLiteral(node))
+  {
+    if (d_cs.getDefinedPolarity(node) != POL_BOTH)
+    {
+      d_cs.toCNF(node, false, POL_BOTH);
+    }
+    e.d_lit = d_cs.getLiteral(node);
+    return;
+  }
+  if (!isConnective(node))
+  {
+    e.d_lit = d_cs.convertAtom(node);
+    return;
+  }
+  SatLiteral l = d_cs.newLiteral(node);
+  e.d_lit = l;
+  size_t n = e.d_childEnd - e.d_childBegin;
+  switch (k)
+  {
+    case Kind::AND:
+    case Kind::OR:
+    {
+      // for AND, (~l | c_i) for all i and (l | ~c_1 | ... | ~c_n), and dually
+      // for OR
+      bool isAnd = k == Kind::AND;
+      SatLiteral pl = isAnd ? l : ~l;
+      for (size_t i = 0; i < n; ++i)
+      {
+        SatLiteral c = child(e, i);
+        addClause({~pl, isAnd ? c : ~c});
+      }
+      for (size_t i = 0; i < n; ++i)
+      {
+        SatLiteral c = child(e, i);
+        d_lits.push_back(isAnd ? ~c : c);
+      }
+      d_lits.push_back(pl);
+      d_lits.push_back(undefSatLiteral);
+      break;
+    }
+    case Kind::XOR:
+    {
+      SatLiteral a = child(e, 0);
+      SatLiteral b = child(e, 1);
+      addClause({a, b, ~l});
+      addClause({~a, ~b, ~l});
+      addClause({a, ~b, l});
+      addClause({~a, b, l});
+      break;
+    }
+    case Kind::IMPLIES:
+    {
+      SatLiteral a = child(e, 0);
+      SatLiteral b = child(e, 1);
+      addClause({~l, ~a, b});
+      addClause({a, l});
+      addClause({~b, l});
+      break;
+    }
+    case Kind::EQUAL:
+    {
+      SatLiteral a = child(e, 0);
+      SatLiteral b = child(e, 1);
+      addClause({~a, b, ~l});
+      addClause({a, ~b, ~l});
+      addClause({~a, ~b, l});
+      addClause({a, b, l});
+      break;
+    }
+    case Kind::ITE:
+    {
+      SatLiteral c = child(e, 0);
+      SatLiteral t = child(e, 1);
+      SatLiteral f = child(e, 2);
+      addClause({~l, t, f});
+      addClause({~l, ~c, t});
+      addClause({~l, c, f});
+      addClause({l, ~t, ~f});
+      addClause({l, ~c, ~t});
+      addClause({l, c, ~f});
+      break;
+    }
+    default: Unreachable();
+  }
+}
+
+void CnfStream::Batch::finish()
+{
+  // children have smaller indices than their parents
+  for (Entry& e : d_entries)
+  {
+    if (!e.d_defined)
+    {
+      define(e);
+    }
+  }
+  size_t begin = 0;
+  for (size_t end : d_topEnds)
+  {
+    for (size_t i = begin; i < end; ++i)
+    {
+      d_lits.push_back(lit(d_topRefs[i]));
+    }
+    d_lits.push_back(undefSatLiteral);
+    begin = end;
+  }
+  Trace("cnf") << "CnfStream::Batch::finish: " << d_lits.size()
+               << " literals over " << d_entries.size() << " subterms\n";
+  d_cs.d_satSolver->addClauses(d_lits, false);
+}
+
+void CnfStream::convertAndAssertBatch(const std::vector<Node>& nodes)
+{
+  Trace("cnf") << "convertAndAssertBatch(" << nodes.size() << " formulas)\n";
+  d_removable = false;
+  TimerStat::CodeTimer codeTimer(d_stats.d_cnfConversionTime, true);
+  Batch batch(*this);
+  for (const Node& node : nodes)
+  {
+    batch.addAssertion(node, false);
+  }
+  batch.finish();
+}
+
 CnfStream::Statistics::Statistics(StatisticsRegistry& sr,
                                   const std::string& name)
     : d_cnfConversionTime(
         sr.registerTimer(name + "::CnfStream::cnfConversionTime")),
-      d_numAtoms(sr.registerInt(name + "::CnfStream::numAtoms"))
+      d_numAtoms(sr.registerInt(name + "::CnfStream::numAtoms")),
+      d_numGates(sr.registerInt(name + "::CnfStream::numGates"))
 {
 }
 
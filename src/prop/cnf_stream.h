@@ -26,6 +26,7 @@
 #ifndef CVC5__PROP__CNF_STREAM_H
 #define CVC5__PROP__CNF_STREAM_H
 
+#include "context/cdhashmap.h"
 #include "context/cdhashset.h"
 #include "context/cdinsert_hashmap.h"
 #include "context/cdlist.h"
@@ -66,6 +67,15 @@ enum class FormulaLitPolicy : uint32_t
  * The general idea is to introduce a new literal that will be equivalent to
  * each subexpression in the constructed equi-satisfiable formula, then
  * substitute the new literal for the formula, and so on, recursively.
+ *
+ * If polarity-aware conversion is enabled, the literal of a subexpression is
+ * only defined in the polarities in which the subexpression occurs (Plaisted
+ * and Greenbaum): a literal l that only occurs positively in the clauses only
+ * needs the clauses for l => subexpression, and dually for negative
+ * occurrences. The missing polarity is added once the literal is used in it.
+ * If gate detection is enabled, disjunctions and conjunctions that encode an
+ * if-then-else, an exclusive or, an equivalence or an at-most-one constraint
+ * are converted as such, which requires fewer literals and clauses.
  */
 class CnfStream : protected EnvObj
 {
@@ -73,6 +83,15 @@ class CnfStream : protected EnvObj
   friend ProofCnfStream;
 
  public:
+  /**
+   * The polarities in which the literal l of a formula is defined, as a bit
+   * mask. In positive polarity l implies the formula, in negative polarity
+   * the formula implies l.
+   */
+  static constexpr uint32_t POL_POS = 1;
+  static constexpr uint32_t POL_NEG = 2;
+  static constexpr uint32_t POL_BOTH = POL_POS | POL_NEG;
+
   /** Cache of what nodes have been registered to a literal. */
   typedef context::CDInsertHashMap<SatLiteral, TNode, SatLiteralHashFunction>
       LiteralToNodeMap;
@@ -93,13 +112,17 @@ class CnfStream : protected EnvObj
    * not-theory literals).
    * @param name string identifier to distinguish between different instances
    * even for non-theory literals.
+   * @param polarityAware whether literals of formulas are only defined in the
+   * polarities they are used in, which is only sound if the values of the
+   * literals of formulas are read via isValueDefined.
    */
   CnfStream(Env& env,
             SatSolver* satSolver,
             Registrar* registrar,
             context::Context* c,
             FormulaLitPolicy flpol = FormulaLitPolicy::INTERNAL,
-            std::string name = "");
+            std::string name = "",
+            bool polarityAware = false);
   /**
    * Convert a given formula to CNF and assert it to the SAT solver.
    *
@@ -108,6 +131,18 @@ class CnfStream : protected EnvObj
    * @param negated whether we are asserting the node negated
    */
   void convertAndAssert(TNode node, bool removable, bool negated);
+  /**
+   * Convert the given formulas to CNF and assert them to the SAT solver as
+   * non-removable clauses. This has the same effect as calling
+   * convertAndAssert on each formula, but converts all formulas in one
+   * iterative pass over their DAG: each Boolean subterm is looked up in the
+   * translation cache once, the literals of subterms are kept in a flat table
+   * indexed by their position in the pass, and the clauses are collected in a
+   * flat buffer that is handed to the SAT solver at the end.
+   *
+   * @param nodes the formulas to convert and assert
+   */
+  void convertAndAssertBatch(const std::vector<Node>& nodes);
   /**
    * Get the node that is represented by the given SatLiteral.
    * @param literal the literal from the sat solver
@@ -122,6 +157,15 @@ class CnfStream : protected EnvObj
    */
   bool hasLiteral(TNode node) const;
 
+  /**
+   * Returns true if the literal of node having the given value implies that
+   * node has this value. This is always the case unless node was converted
+   * polarity-aware and its literal is only defined in the other polarity.
+   * @param node a node that has a literal
+   * @param value the value of the literal
+   */
+  bool isValueDefined(TNode node, bool value) const;
+
   /**
    * Ensure that the given node will have a designated SAT literal that is
    * definitionally equal to it.  The result of this function is that the Node
@@ -220,6 +264,8 @@ class CnfStream : protected EnvObj
   void convertAndAssertImplies(TNode node, bool negated);
   void convertAndAssertIte(TNode node, bool negated);
 
+  /** A Boolean gate that is recognized by toCNF, see cnf_stream.cpp */
+  struct Gate;
   /**
    * Transforms the node into CNF recursively and yields a literal
    * definitionally equal to it.
@@ -228,22 +274,49 @@ class CnfStream : protected EnvObj
    * and literals to avoid redundant work and to retrieve formulas from literals
    * and vice-versa.
    *
+   * If the conversion is polarity-aware, the returned literal is only defined
+   * in the polarity in which it is used, which is positive if it is asserted
+   * as part of a clause.
+   *
    * @param node the formula to transform
    * @param negated whether the literal is negated
    * @return the literal representing the root of the formula
    */
   SatLiteral toCNF(TNode node, bool negated = false);
+  /**
+   * Same as above, but the literal of node is defined in (at least) the
+   * polarities pol if the conversion is polarity-aware.
+   */
+  SatLiteral toCNF(TNode node, bool negated, uint32_t pol);
 
   /**
    * Specific clausifiers that clausify a formula based on the given formula
-   * kind and introduce a literal definitionally equal to it.
+   * kind and introduce a literal for it that is defined in the polarities
+   * pol. The literals of the inputs of the formula must be defined in the
+   * polarities required by pol, see inputPolarity.
+   */
+  void handleXor(TNode node, TNode a, TNode b, uint32_t pol);
+  void handleImplies(TNode node, uint32_t pol);
+  void handleIff(TNode node, TNode a, TNode b, uint32_t pol);
+  void handleIte(TNode node, TNode c, TNode t, TNode e, uint32_t pol);
+  void handleAnd(TNode node, uint32_t pol);
+  void handleOr(TNode node, uint32_t pol);
+  void handleAtMostOne(TNode node, const Gate& g, uint32_t pol);
+
+  /** Get the literal of node, or a new one if it has none */
+  SatLiteral getOrNewLiteral(TNode node);
+  /**
+   * Get the polarities in which the literal of node is defined, which is
+   * none if node has no literal.
+   */
+  uint32_t getDefinedPolarity(TNode node) const;
+  /** Set the gate that is used to convert node to g */
+  void getGate(TNode node, Gate& g) const;
+  /**
+   * Get the polarities in which the i^th input of gate g must be defined, if
+   * the literal of g is defined in the polarities pol.
    */
-  void handleXor(TNode node);
-  void handleImplies(TNode node);
-  void handleIff(TNode node);
-  void handleIte(TNode node);
-  void handleAnd(TNode node);
-  void handleOr(TNode node);
+  static uint32_t inputPolarity(const Gate& g, size_t i, uint32_t pol);
 
   /** Stores the literal of the given node in d_literalToNodeMap.
    *
@@ -328,6 +401,18 @@ class CnfStream : protected EnvObj
   /** Map from literals to nodes */
   LiteralToNodeMap d_literalToNodeMap;
 
+  /**
+   * The polarities of the formulas whose literals are only defined in one
+   * polarity. Formulas that have a literal and are not in this map are
+   * defined in both polarities.
+   */
+  context::CDHashMap<Node, uint32_t> d_definedPolarity;
+
+  /** Whether the conversion is polarity-aware */
+  const bool d_polarityAware;
+  /** Whether gates are detected */
+  const bool d_detectGates;
+
   /**
    * True if the lit-to-Node map should be kept for all lits, not just
    * theory lits.  This is true if e.g. replay logging is on, which
@@ -353,12 +438,17 @@ class CnfStream : protected EnvObj
   ResourceManager* d_resourceManager;
 
  private:
+  /** The state of a call to convertAndAssertBatch, see cnf_stream.cpp */
+  class Batch;
+
   struct Statistics
   {
     Statistics(StatisticsRegistry& sr, const std::string& name);
     TimerStat d_cnfConversionTime;
     /** Number of atoms */
     IntStat d_numAtoms;
+    /** Number of detected if-then-else, xor and at-most-one gates */
+    IntStat d_numGates;
   };
   /** Statistics */
   Statistics d_stats;
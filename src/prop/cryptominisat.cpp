@@ -156,6 +156,30 @@ ClauseId CryptoMinisatSolver::addClause(SatClause& clause, bool removable){
   return freshId;
 }
 
+void CryptoMinisatSolver::addClauses(const std::vector<SatLiteral>& lits,
+                                     bool removable)
+{
+  Trace("sat::cryptominisat") << "Add " << lits.size() << " literals\n";
+  // the clause is reused for all clauses of the buffer
+  std::vector<CMSat::Lit> internal_clause;
+  for (const SatLiteral& lit : lits)
+  {
+    if (!lit.isNull())
+    {
+      internal_clause.push_back(toInternalLit(lit));
+      continue;
+    }
+    if (!d_okay)
+    {
+      Trace("sat::cryptominisat") << "Solver unsat: not adding clauses.\n";
+      return;
+    }
+    ++(d_statistics.d_clausesAdded);
+    d_okay &= d_solver->add_clause(internal_clause);
+    internal_clause.clear();
+  }
+}
+
 bool CryptoMinisatSolver::ok() const { return d_okay; }
 
 SatVariable CryptoMinisatSolver::newVar(bool isTheoryAtom, bool canErase)
@@ -44,6 +44,8 @@ class CryptoMinisatSolver : public SatSolver
   ~CryptoMinisatSolver() override;
 
   ClauseId addClause(SatClause& clause, bool removable) override;
+  void addClauses(const std::vector<SatLiteral>& lits,
+                  bool removable) override;
   ClauseId addXorClause(SatClause& clause, bool rhs, bool removable) override;
 
   bool nativeXor() override { return true; }
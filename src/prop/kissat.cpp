@@ -95,6 +95,23 @@ ClauseId KissatSolver::addClause(SatClause& clause, bool removable)
   return ClauseIdError;
 }
 
+void KissatSolver::addClauses(const std::vector<SatLiteral>& lits,
+                              bool removable)
+{
+  for (const SatLiteral& lit : lits)
+  {
+    if (lit.isNull())
+    {
+      kissat_add(d_solver, 0);
+      ++d_statistics.d_numClauses;
+    }
+    else
+    {
+      kissat_add(d_solver, toKissatLit(lit));
+    }
+  }
+}
+
 ClauseId KissatSolver::addXorClause(SatClause& clause, bool rhs, bool removable)
 {
   Unreachable() << "Kissat does not support adding XOR clauses.";
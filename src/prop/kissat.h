@@ -39,6 +39,8 @@ class KissatSolver : public SatSolver
   ~KissatSolver() override;
 
   ClauseId addClause(SatClause& clause, bool removable) override;
+  void addClauses(const std::vector<SatLiteral>& lits,
+                  bool removable) override;
 
   ClauseId addXorClause(SatClause& clause, bool rhs, bool removable) override;
 
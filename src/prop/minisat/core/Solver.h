@@ -273,6 +273,8 @@ public:
      Var v,
      bool b);  // Declare which polarity the decision heuristic MUST ALWAYS use
                // for a variable. Requires mode 'polarity_user'.
+ void thawPolarity(Var v);  // Undo freezePolarity, the frozen polarity is
+                            // kept as the saved phase of the variable.
  void setDecisionVar(Var v,
                      bool b);  // Declare if a variable should be eligible for
                                // selection in the decision heuristic.
@@ -686,6 +688,7 @@ inline int      Solver::nFreeVars     ()      const   { return (int)dec_vars - (
 inline bool     Solver::properExplanation(Lit l, Lit expl) const { return value(l) == l_True && value(expl) == l_True && trail_index(var(expl)) < trail_index(var(l)); }
 inline void     Solver::setPolarity   (Var v, bool b) { polarity[v] = b; }
 inline void     Solver::freezePolarity(Var v, bool b) { polarity[v] = int(b) | 0x2; }
+inline void     Solver::thawPolarity  (Var v)         { polarity[v] &= 0x1; }
 inline void     Solver::setDecisionVar(Var v, bool b)
 {
     if      ( b && !decision[v] ) dec_vars++;
@@ -182,6 +182,28 @@ ClauseId MinisatSatSolver::addClause(SatClause& clause, bool removable)
   return clause_id;
 }
 
+void MinisatSatSolver::addClauses(const std::vector<SatLiteral>& lits,
+                                  bool removable)
+{
+  // the clause is reused for all clauses of the buffer
+  Minisat::vec<Minisat::Lit> minisat_clause;
+  for (const SatLiteral& lit : lits)
+  {
+    if (!lit.isNull())
+    {
+      minisat_clause.push(toMinisatLit(lit));
+      continue;
+    }
+    if (!ok())
+    {
+      return;
+    }
+    ClauseId clause_id = ClauseIdError;
+    d_minisat->addClause(minisat_clause, removable, clause_id);
+    minisat_clause.clear();
+  }
+}
+
 SatVariable MinisatSatSolver::newVar(bool isTheoryAtom, bool canErase)
 {
   return d_minisat->newVar(true, true, isTheoryAtom, canErase);
@@ -272,6 +294,12 @@ void MinisatSatSolver::preferPhase(SatLiteral lit)
   d_minisat->freezePolarity(v, lit.isNegated());
 }
 
+void MinisatSatSolver::unsetPreferredPhase(SatVariable var)
+{
+  Trace("minisat") << "unsetPreferredPhase(" << var << ")" << std::endl;
+  d_minisat->thawPolarity(var);
+}
+
 bool MinisatSatSolver::isDecision(SatVariable decn) const {
   return d_minisat->isDecision( decn );
 }
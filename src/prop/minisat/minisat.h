@@ -51,6 +51,8 @@ class MinisatSatSolver : public CDCLTSatSolver, protected EnvObj
   void initialize(TheoryProxy* theoryProxy, PropPfManager* ppm) override;
 
   ClauseId addClause(SatClause& clause, bool removable) override;
+  void addClauses(const std::vector<SatLiteral>& lits,
+                  bool removable) override;
   ClauseId addXorClause(SatClause& clause, bool rhs, bool removable) override
   {
     Unreachable() << "Minisat does not support native XOR reasoning";
@@ -85,6 +87,8 @@ class MinisatSatSolver : public CDCLTSatSolver, protected EnvObj
 
   void preferPhase(SatLiteral lit) override;
 
+  void unsetPreferredPhase(SatVariable var) override;
+
   bool isDecision(SatVariable decn) const override;
 
   bool isFixed(SatVariable var) const override;
@@ -102,7 +102,9 @@ PropEngine::PropEngine(Env& env, TheoryEngine* te)
                               d_theoryProxy,
                               userContext,
                               FormulaLitPolicy::TRACK,
-                              "prop");
+                              "prop",
+                              options().prop.cnfPolarity
+                                  && !options().smt.produceProofs);
 
   // connect theory proxy
   d_theoryProxy->finishInit(d_satSolver, d_cnfStream);
@@ -161,10 +163,21 @@ void PropEngine::assertInputFormulas(
   Assert(!d_inCheckSat) << "Sat solver in solve()!";
   d_theoryProxy->notifyInputFormulas(assertions, skolemMap);
   int64_t natomsPre = d_cnfStream->d_stats.d_numAtoms.get();
-  for (const Node& node : assertions)
+  if (options().prop.cnfBatch && !isProofEnabled()
+      && options().smt.unsatCoresMode != options::UnsatCoresMode::ASSUMPTIONS)
   {
-    Trace("prop") << "assertFormula(" << node << ")" << std::endl;
-    assertInternal(theory::InferenceId::INPUT, node, false, false, true);
+    // same as assertInternal below for each assertion
+    Trace("prop") << "assertFormulas(" << assertions.size() << ")"
+                  << std::endl;
+    d_cnfStream->convertAndAssertBatch(assertions);
+  }
+  else
+  {
+    for (const Node& node : assertions)
+    {
+      Trace("prop") << "assertFormula(" << node << ")" << std::endl;
+      assertInternal(theory::InferenceId::INPUT, node, false, false, true);
+    }
   }
   int64_t natomsPost = d_cnfStream->d_stats.d_numAtoms.get();
   Assert(natomsPost >= natomsPre);
@@ -359,6 +372,45 @@ void PropEngine::preferPhase(TNode n, bool phase)
   Assert(n.getType().isBoolean());
   SatLiteral lit = d_cnfStream->getLiteral(n);
   d_satSolver->preferPhase(phase ? lit : ~lit);
+  d_phaseVars.insert(lit.getSatVariable());
+  d_modelPhaseVars.erase(lit.getSatVariable());
+}
+
+void PropEngine::preferModelPhases()
+{
+  Trace("prop") << "preferModelPhases()" << std::endl;
+  for (const std::pair<const Node, SatLiteral>& p :
+       d_cnfStream->getTranslationCache())
+  {
+    // The negation shares the variable of the negated formula. We also set
+    // the phases of the variables of Boolean connectives, since the SAT
+    // solver may decide on them before their atoms.
+    if (p.first.getKind() == Kind::NOT)
+    {
+      continue;
+    }
+    SatVariable var = p.second.getSatVariable();
+    if (d_phaseVars.find(var) != d_phaseVars.end())
+    {
+      continue;
+    }
+    SatValue v = d_satSolver->modelValue(p.second);
+    if (v != SAT_VALUE_UNKNOWN)
+    {
+      d_satSolver->preferPhase(v == SAT_VALUE_TRUE ? p.second : ~p.second);
+      d_modelPhaseVars.insert(var);
+    }
+  }
+}
+
+void PropEngine::unsetModelPhases()
+{
+  Trace("prop") << "unsetModelPhases()" << std::endl;
+  for (SatVariable var : d_modelPhaseVars)
+  {
+    d_satSolver->unsetPreferredPhase(var);
+  }
+  d_modelPhaseVars.clear();
 }
 
 bool PropEngine::isDecision(Node lit) const {
@@ -529,6 +581,13 @@ Node PropEngine::getValue(TNode node) const
   SatLiteral lit = d_cnfStream->getLiteral(node);
 
   SatValue v = d_satSolver->value(lit);
+  if (v != SAT_VALUE_UNKNOWN
+      && !d_cnfStream->isValueDefined(node, v == SAT_VALUE_TRUE))
+  {
+    // the literal of a formula that is only defined in the other polarity
+    // does not determine its value
+    v = SAT_VALUE_UNKNOWN;
+  }
   if (v == SAT_VALUE_TRUE)
   {
     return nodeManager()->mkConst(true);
@@ -557,6 +616,13 @@ bool PropEngine::hasValue(TNode node, bool& value) const
   SatLiteral lit = d_cnfStream->getLiteral(node);
 
   SatValue v = d_satSolver->value(lit);
+  if (v != SAT_VALUE_UNKNOWN
+      && !d_cnfStream->isValueDefined(node, v == SAT_VALUE_TRUE))
+  {
+    // the literal of a formula that is only defined in the other polarity
+    // does not determine its value
+    v = SAT_VALUE_UNKNOWN;
+  }
   if (v == SAT_VALUE_TRUE)
   {
     value = true;
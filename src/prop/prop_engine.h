@@ -22,11 +22,14 @@
 
 #include <cvc5/cvc5_types.h>
 
+#include <unordered_set>
+
 #include "context/cdlist.h"
 #include "expr/node.h"
 #include "proof/proof.h"
 #include "proof/trust_node.h"
 #include "prop/learned_db.h"
+#include "prop/sat_solver_types.h"
 #include "prop/skolem_def_manager.h"
 #include "smt/env_obj.h"
 #include "theory/inference_id.h"
@@ -166,6 +169,26 @@ class PropEngine : protected EnvObj
    */
   void preferPhase(TNode n, bool phase);
 
+  /**
+   * Prefer the phase of each SAT variable to its value in the model computed
+   * by the last call to checkSat, which must have returned "sat". This
+   * applies to the decisions of the SAT solver as well as those suggested by
+   * the decision engine, e.g. the justification strategy, whose polarity the
+   * SAT solver replaces by the preferred phase. Variables whose phase was
+   * configured by preferPhase keep that phase. This is used for
+   * solution-guided search in optimization queries, where subsequent checks
+   * should deviate from the best model found so far only where necessary.
+   *
+   * Unlike preferPhase, the phases last until unsetModelPhases is called.
+   */
+  void preferModelPhases();
+
+  /**
+   * Forget the phases configured by preferModelPhases, after which the SAT
+   * solver chooses the phases of these variables as before.
+   */
+  void unsetModelPhases();
+
   /**
    * Return whether the given literal is a SAT decision.  Either phase
    * is permitted; that is, if "lit" is a SAT decision, this function
@@ -434,6 +457,10 @@ class PropEngine : protected EnvObj
 
   /** The CNF converter in use */
   CnfStream* d_cnfStream;
+  /** The variables whose phase was configured by preferPhase */
+  std::unordered_set<SatVariable> d_phaseVars;
+  /** The variables whose phase was configured by preferModelPhases */
+  std::unordered_set<SatVariable> d_modelPhaseVars;
   /** A default proof generator for theory lemmas */
   CDProof d_theoryLemmaPg;
 
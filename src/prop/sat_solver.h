@@ -19,7 +19,9 @@
 #define CVC5__PROP__SAT_SOLVER_H
 
 #include <string>
+#include <vector>
 
+#include "base/check.h"
 #include "context/cdlist.h"
 #include "context/context.h"
 #include "expr/node.h"
@@ -50,6 +52,32 @@ public:
   virtual ClauseId addClause(SatClause& clause,
                              bool removable) = 0;
 
+  /**
+   * Add the clauses of the given buffer to the SAT solver. The buffer holds
+   * the literals of each clause followed by undefSatLiteral, which terminates
+   * the clause, as in the interface of CaDiCaL. This avoids constructing a
+   * clause per clause when many clauses are added at once. The default
+   * implementation adds the clauses one by one via addClause.
+   *
+   * @param lits      The literals of the clauses.
+   * @param removable True to indicate that the clauses are not irredundant.
+   */
+  virtual void addClauses(const std::vector<SatLiteral>& lits, bool removable)
+  {
+    SatClause clause;
+    for (const SatLiteral& lit : lits)
+    {
+      if (!lit.isNull())
+      {
+        clause.push_back(lit);
+        continue;
+      }
+      addClause(clause, removable);
+      clause.clear();
+    }
+    Assert(clause.empty()) << "Clause is not terminated";
+  }
+
   /** Return true if the solver supports native xor resoning */
   virtual bool nativeXor() { return false; }
 
@@ -162,6 +190,14 @@ class CDCLTSatSolver : public SatSolver
    */
   virtual void preferPhase(SatLiteral lit) = 0;
 
+  /**
+   * Forget the phase configured by preferPhase for the given variable, after
+   * which its phase is chosen as for any other variable.
+   *
+   * @param var The variable.
+   */
+  virtual void unsetPreferredPhase(SatVariable var) = 0;
+
   virtual bool isDecision(SatVariable decn) const = 0;
 
   /**
@@ -42,10 +42,49 @@ using namespace cvc5::internal::smt;
 
 namespace cvc5::internal {
 
+namespace {
+/** Get the configuration of the context memory managers from opts */
+context::ContextMemoryConfig getContextMemoryConfig(const Options* opts)
+{
+  context::ContextMemoryConfig config;
+  if (opts != nullptr)
+  {
+    config.d_chunkSize = opts->smt.contextChunkSize;
+    config.d_hugePages = opts->smt.contextHugePages;
+  }
+  return config;
+}
+}  // namespace
+
+/** Statistics on the memory of the SAT context */
+struct Env::ContextStatistics
+{
+  ContextStatistics(StatisticsRegistry& reg,
+                    const context::ContextMemoryStatistics& stats)
+      : d_chunksAllocated(reg.registerReference<uint64_t>(
+          "context::chunksAllocated", stats.d_chunksAllocated)),
+        d_chunksFreed(reg.registerReference<uint64_t>("context::chunksFreed",
+                                                      stats.d_chunksFreed)),
+        d_chunksReused(reg.registerReference<uint64_t>(
+            "context::chunksReused", stats.d_chunksReused)),
+        d_maxChunksInUse(reg.registerReference<uint64_t>(
+            "context::maxChunksInUse", stats.d_maxChunksInUse))
+  {
+  }
+  /** The number of chunks allocated from the system */
+  ReferenceStat<uint64_t> d_chunksAllocated;
+  /** The number of chunks returned to the system */
+  ReferenceStat<uint64_t> d_chunksFreed;
+  /** The number of chunks reused from the free list */
+  ReferenceStat<uint64_t> d_chunksReused;
+  /** The maximal number of chunks in use */
+  ReferenceStat<uint64_t> d_maxChunksInUse;
+};
+
 Env::Env(NodeManager* nm, const Options* opts)
     : d_nm(nm),
-      d_context(new context::Context()),
-      d_userContext(new context::UserContext()),
+      d_context(new context::Context(getContextMemoryConfig(opts))),
+      d_userContext(new context::UserContext(getContextMemoryConfig(opts))),
       d_pfManager(nullptr),
       d_proofNodeManager(nullptr),
       d_rewriter(new theory::Rewriter(nm)),
@@ -62,14 +101,20 @@ Env::Env(NodeManager* nm, const Options* opts)
   {
     d_options.copyValues(*opts);
   }
-  d_statisticsRegistry.reset(new StatisticsRegistry(
-      d_options.base.statisticsInternal, d_options.base.statisticsAll));
+  d_statisticsRegistry.reset(
+      new StatisticsRegistry(d_options.base.statisticsInternal,
+                             d_options.base.statisticsAll,
+                             true,
+                             d_options.base.statisticsTimerSampling,
+                             d_options.base.statisticsOverhead));
   // make the evaluators, which depend on the alphabet of strings
   d_evalRew.reset(new theory::Evaluator(d_rewriter.get(),
                                         d_options.strings.stringsAlphaCard));
   d_eval.reset(
       new theory::Evaluator(nullptr, d_options.strings.stringsAlphaCard));
   d_statisticsRegistry->registerTimer("global::totalTime").start();
+  d_contextStats = std::make_unique<ContextStatistics>(
+      *d_statisticsRegistry, d_context->getCMM()->getStatistics());
   d_resourceManager = std::make_unique<ResourceManager>(*d_statisticsRegistry, d_options);
   d_rewriter->d_resourceManager = d_resourceManager.get();
 }
@@ -101,6 +146,7 @@ void Env::shutdown()
   d_rewriter.reset(nullptr);
   // d_resourceManager must be destroyed before d_statisticsRegistry
   d_resourceManager.reset(nullptr);
+  d_contextStats.reset(nullptr);
 }
 
 context::Context* Env::getContext() { return d_context.get(); }
@@ -399,6 +399,9 @@ class Env
   Options d_options;
   /** Manager for limiting time and abstract resource usage. */
   std::unique_ptr<ResourceManager> d_resourceManager;
+  struct ContextStatistics;
+  /** Statistics on the memory of the SAT context */
+  std::unique_ptr<ContextStatistics> d_contextStats;
   /** The theory that owns the uninterpreted sort. */
   theory::TheoryId d_uninterpretedSortOwner;
   /** The separation logic location and data types */
@@ -0,0 +1,991 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The solver for optimization queries.
+ */
+
+#include "smt/optimization_solver.h"
+
+#include "base/modal_exception.h"
+#include "expr/node_manager.h"
+#include "options/base_options.h"
+#include "options/decision_options.h"
+#include "options/smt_options.h"
+#include "prop/prop_engine.h"
+#include "smt/smt_solver.h"
+#include "smt/solver_engine.h"
+#include "theory/arith/theory_arith.h"
+#include "theory/bv/theory_bv_utils.h"
+#include "theory/theory_engine.h"
+#include "util/bitvector.h"
+#include "util/statistics_registry.h"
+
+using namespace cvc5::internal::kind;
+
+namespace cvc5::internal {
+namespace smt {
+
+namespace {
+/**
+ * Pushes a user context of a solver engine, which is popped when this object
+ * is destroyed. This ensures that the solver engine returns to its user
+ * context level when a check throws, e.g., on a resource out.
+ */
+class ScopedUserPush
+{
+ public:
+  ScopedUserPush(SolverEngine* slv) : d_slv(slv) { d_slv->push(); }
+  ~ScopedUserPush() { d_slv->pop(); }
+
+ private:
+  SolverEngine* d_slv;
+};
+
+/**
+ * Unsets the phases preferred by the models of an optimization query when
+ * this object is destroyed, so that they do not affect later queries.
+ */
+class ScopedModelPhases
+{
+ public:
+  ScopedModelPhases(SmtSolver* smt, bool enabled)
+      : d_smt(enabled ? smt : nullptr)
+  {
+  }
+  ~ScopedModelPhases()
+  {
+    if (d_smt != nullptr && d_smt->getPropEngine() != nullptr)
+    {
+      d_smt->getPropEngine()->unsetModelPhases();
+    }
+  }
+
+ private:
+  SmtSolver* d_smt;
+};
+}  // namespace
+
+OptimizationObjective::OptimizationObjective(Node target,
+                                             modes::ObjectiveType type,
+                                             bool bvSigned)
+    : d_target(target), d_type(type), d_bvSigned(bvSigned), d_isSoft(false)
+{
+}
+
+OptimizationObjective::OptimizationObjective(Node target,
+                                             const std::string& softId)
+    : d_target(target),
+      d_type(modes::ObjectiveType::MINIMIZE),
+      d_bvSigned(false),
+      d_isSoft(true),
+      d_softId(softId)
+{
+}
+
+SoftConstraint::SoftConstraint(Node formula,
+                               const Integer& weight,
+                               size_t objective)
+    : d_formula(formula), d_weight(weight), d_objective(objective)
+{
+}
+
+Node OptimizationObjective::mkStrictImprovement(NodeManager* nm,
+                                                const Node& value) const
+{
+  return d_type == modes::ObjectiveType::MINIMIZE
+             ? mkLess(nm, d_target, value, true)
+             : mkLess(nm, value, d_target, true);
+}
+
+Node OptimizationObjective::mkWeakImprovement(NodeManager* nm,
+                                              const Node& value) const
+{
+  return d_type == modes::ObjectiveType::MINIMIZE
+             ? mkLess(nm, d_target, value, false)
+             : mkLess(nm, value, d_target, false);
+}
+
+Node OptimizationObjective::mkLess(NodeManager* nm,
+                                   const Node& a,
+                                   const Node& b,
+                                   bool strict) const
+{
+  Kind k;
+  if (d_target.getType().isBitVector())
+  {
+    if (d_bvSigned)
+    {
+      k = strict ? Kind::BITVECTOR_SLT : Kind::BITVECTOR_SLE;
+    }
+    else
+    {
+      k = strict ? Kind::BITVECTOR_ULT : Kind::BITVECTOR_ULE;
+    }
+  }
+  else
+  {
+    Assert(d_target.getType().isRealOrInt());
+    k = strict ? Kind::LT : Kind::LEQ;
+  }
+  return nm->mkNode(k, a, b);
+}
+
+bool OptimizationObjective::isBetter(const Node& a, const Node& b) const
+{
+  if (!a.isConst() || !b.isConst())
+  {
+    return false;
+  }
+  int cmp;
+  if (d_target.getType().isBitVector())
+  {
+    const BitVector& x = a.getConst<BitVector>();
+    const BitVector& y = b.getConst<BitVector>();
+    if (d_bvSigned)
+    {
+      cmp = x.signedLessThan(y) ? -1 : (y.signedLessThan(x) ? 1 : 0);
+    }
+    else
+    {
+      cmp = x.unsignedLessThan(y) ? -1 : (y.unsignedLessThan(x) ? 1 : 0);
+    }
+  }
+  else
+  {
+    cmp = a.getConst<Rational>().cmp(b.getConst<Rational>());
+  }
+  return d_type == modes::ObjectiveType::MINIMIZE ? cmp < 0 : cmp > 0;
+}
+
+OptimizationSolver::OptimizationSolver(Env& env, SolverEngine* parent)
+    : EnvObj(env),
+      d_parent(parent),
+      d_objectives(userContext()),
+      d_soft(userContext()),
+      d_paretoValid(userContext(), false),
+      d_paretoAssertions(0),
+      d_paretoObjectives(0),
+      d_mode(modes::OptimizationMode::LEX),
+      d_interrupted(false),
+      d_numQueries(
+          statisticsRegistry().registerInt("smt::OptimizationSolver::queries")),
+      d_numChecks(
+          statisticsRegistry().registerInt("smt::OptimizationSolver::checks")),
+      d_numImprovements(statisticsRegistry().registerInt(
+          "smt::OptimizationSolver::improvements")),
+      d_numCores(
+          statisticsRegistry().registerInt("smt::OptimizationSolver::cores")),
+      d_numExternal(statisticsRegistry().registerInt(
+          "smt::OptimizationSolver::externalBounds")),
+      d_optTime(
+          statisticsRegistry().registerTimer("smt::OptimizationSolver::time")),
+      d_firstModelTime(statisticsRegistry().registerTimer(
+          "smt::OptimizationSolver::firstModelTime"))
+{
+}
+
+OptimizationSolver::~OptimizationSolver() {}
+
+void OptimizationSolver::addObjective(const Node& target,
+                                      modes::ObjectiveType type,
+                                      bool bvSigned)
+{
+  TypeNode tn = target.getType();
+  if (!tn.isRealOrInt() && !tn.isBitVector())
+  {
+    throw ModalException(
+        "Expecting an objective of arithmetic or bit-vector type.");
+  }
+  Trace("smt-opt") << "OptimizationSolver: add objective " << target << " ("
+                   << type << ")" << std::endl;
+  d_objectives.push_back(OptimizationObjective(target, type, bvSigned));
+}
+
+void OptimizationSolver::assertSoft(const Node& formula,
+                                    const Integer& weight,
+                                    const std::string& id)
+{
+  Assert(formula.getType().isBoolean());
+  if (weight.sgn() <= 0)
+  {
+    throw ModalException("Expecting a positive weight for a soft constraint.");
+  }
+  Trace("smt-opt") << "OptimizationSolver: assert soft " << formula
+                   << " :weight " << weight << " :id " << id << std::endl;
+  // find the objective of the soft constraints with the same id
+  size_t index = 0;
+  size_t nobjs = d_objectives.size();
+  while (index < nobjs
+         && !(d_objectives[index].isSoft()
+              && d_objectives[index].getSoftId() == id))
+  {
+    index++;
+  }
+  if (index == nobjs)
+  {
+    // the target is a placeholder, which is replaced by the penalty of the
+    // soft constraints when a query is made
+    d_objectives.push_back(
+        OptimizationObjective(nodeManager()->mkConstInt(Rational(0)), id));
+  }
+  d_soft.push_back(SoftConstraint(formula, weight, index));
+}
+
+Result OptimizationSolver::checkOpt(
+    modes::OptimizationMode mode,
+    const std::function<bool(const std::vector<Node>&)>& callback,
+    const std::function<std::vector<Node>()>& bounds,
+    const std::function<bool(const std::vector<Node>&)>& boundCallback)
+{
+  TimerStat::CodeTimer codeTimer(d_optTime);
+  ++d_numQueries;
+  d_values.clear();
+  d_query.clear();
+  d_incumbent.clear();
+  d_dualBounds.clear();
+  d_mode = mode;
+  d_callback = callback;
+  d_bounds = bounds;
+  d_boundCallback = boundCallback;
+  d_interrupted = false;
+  if (d_objectives.empty())
+  {
+    return checkSat({});
+  }
+  if (!options().base.incrementalSolving)
+  {
+    throw ModalException(
+        "Cannot optimize objectives unless incremental solving is enabled.");
+  }
+  Trace("smt-opt") << "OptimizationSolver: check opt (" << mode << ")"
+                   << std::endl;
+  // stopped by updateIncumbent when the first model is found
+  d_firstModelTime.start();
+  // The objectives of this query, where the target of a MaxSMT objective is
+  // the penalty of its soft constraints.
+  NodeManager* nm = nodeManager();
+  std::vector<std::vector<Node>> penalties(d_objectives.size());
+  for (const SoftConstraint& sc : d_soft)
+  {
+    penalties[sc.d_objective].push_back(
+        nm->mkNode(Kind::ITE,
+                   sc.d_formula,
+                   nm->mkConstInt(Rational(0)),
+                   nm->mkConstInt(Rational(sc.d_weight))));
+  }
+  for (size_t i = 0, nobjs = d_objectives.size(); i < nobjs; i++)
+  {
+    const OptimizationObjective& obj = d_objectives[i];
+    if (!obj.isSoft() || penalties[i].empty())
+    {
+      d_query.push_back(obj);
+      continue;
+    }
+    Node penalty = penalties[i].size() == 1
+                       ? penalties[i][0]
+                       : nm->mkNode(Kind::ADD, penalties[i]);
+    d_query.push_back(OptimizationObjective(penalty, obj.getSoftId()));
+  }
+  d_dualBounds.resize(d_query.size());
+  Result r;
+  {
+    // the phases preferred by updateIncumbent only apply to this query
+    ScopedModelPhases phases(d_parent->d_smtSolver.get(),
+                             options().decision.optPhase);
+    switch (mode)
+    {
+      case modes::OptimizationMode::BOX: r = checkBox(); break;
+      case modes::OptimizationMode::PARETO: r = checkPareto(); break;
+      default: r = checkLexicographic(); break;
+    }
+  }
+  d_callback = nullptr;
+  d_bounds = nullptr;
+  d_boundCallback = nullptr;
+  if (d_firstModelTime.running())
+  {
+    d_firstModelTime.stop();
+  }
+  if (r.getStatus() == Result::UNKNOWN)
+  {
+    // the best values found so far, which are not known to be optimal
+    d_values = d_incumbent;
+  }
+  Trace("smt-opt") << "OptimizationSolver: return " << r << std::endl;
+  return r;
+}
+
+Result OptimizationSolver::checkLexicographic()
+{
+  Result r;
+  std::vector<Node> values;
+  std::vector<Node> fixed;
+  {
+    // All bounds on the objectives are asserted in a user context of their
+    // own, which we pop after the optimum is found.
+    ScopedUserPush scope(d_parent);
+    r = checkSat({});
+    if (r.getStatus() == Result::SAT)
+    {
+      for (size_t i = 0, nobjs = d_query.size(); i < nobjs; i++)
+      {
+        Node best;
+        if (!optimizeObjective(i, best, r))
+        {
+          // we failed to show that best is optimal
+          break;
+        }
+        values.push_back(best);
+        // Fix the objective to its optimal value, which ensures the remaining
+        // objectives are optimized lexicographically. The last model has
+        // this value, hence it is a valid starting point for the next
+        // objective.
+        Node fix = d_query[i].getTarget().eqNode(best);
+        fixed.push_back(fix);
+        d_parent->assertFormula(fix);
+      }
+    }
+  }
+  if (values.size() < d_query.size())
+  {
+    // either the assertions are unsatisfiable, or we could not prove
+    // optimality
+    return r;
+  }
+  // The last check showed that the values are optimal and hence was unsat.
+  // We recompute a model in which all objectives have their optimal value.
+  // This check is cheap since it is fully constrained by the objectives.
+  r = checkSat(fixed);
+  if (r.getStatus() == Result::SAT)
+  {
+    d_values = values;
+  }
+  return r;
+}
+
+Result OptimizationSolver::checkBox()
+{
+  Result r;
+  std::vector<Node> values;
+  {
+    // The checkpoint shared by all objectives: the assertions are
+    // preprocessed and checked once, after which each objective is optimized
+    // in a user context of its own that is popped afterwards.
+    ScopedUserPush scope(d_parent);
+    r = checkSat({});
+    if (r.getStatus() == Result::SAT)
+    {
+      for (size_t i = 0, nobjs = d_query.size(); i < nobjs; i++)
+      {
+        // Any model of the checkpoint is a valid starting point, in
+        // particular the last model found for the previous objective.
+        Node best;
+        bool optimal;
+        {
+          ScopedUserPush objScope(d_parent);
+          optimal = optimizeObjective(i, best, r);
+        }
+        if (!optimal)
+        {
+          break;
+        }
+        values.push_back(best);
+      }
+    }
+  }
+  if (values.size() < d_query.size())
+  {
+    return r;
+  }
+  // The objectives are in general not optimal in the same model. We compute
+  // a model in which the last objective is optimal.
+  r = checkSat({d_query[values.size() - 1].getTarget().eqNode(
+      values.back())});
+  if (r.getStatus() == Result::SAT)
+  {
+    d_values = values;
+  }
+  return r;
+}
+
+Result OptimizationSolver::checkPareto()
+{
+  // The Pareto points found by previous calls are only valid if the
+  // assertions and the objectives have not changed since.
+  size_t nassertions =
+      d_parent->d_smtSolver->getAssertions().getAssertionList().size();
+  if (!d_paretoValid.get() || d_paretoAssertions != nassertions
+      || d_paretoObjectives != d_objectives.size() + d_soft.size())
+  {
+    Trace("smt-opt") << "OptimizationSolver: reset Pareto front" << std::endl;
+    d_paretoBlock.clear();
+  }
+  NodeManager* nm = nodeManager();
+  Result r;
+  std::vector<Node> values;
+  {
+    ScopedUserPush scope(d_parent);
+    // exclude the points dominated by (or equal to) previous Pareto points
+    for (const Node& block : d_paretoBlock)
+    {
+      d_parent->assertFormula(block);
+    }
+    r = checkSat({});
+    // This is the guided improvement algorithm: we search for a model that
+    // dominates the last one, until no such model exists.
+    while (r.getStatus() == Result::SAT)
+    {
+      values = d_lastValues;
+      std::vector<Node> weak;
+      std::vector<Node> strict;
+      for (size_t i = 0, nobjs = d_query.size(); i < nobjs; i++)
+      {
+        weak.push_back(d_query[i].mkWeakImprovement(nm, values[i]));
+        strict.push_back(d_query[i].mkStrictImprovement(nm, values[i]));
+      }
+      weak.push_back(nm->mkOr(strict));
+      r = checkSat({nm->mkAnd(weak)});
+      if (r.getStatus() == Result::SAT)
+      {
+        ++d_numImprovements;
+      }
+      else if (r.getStatus() == Result::UNSAT)
+      {
+        Trace("smt-opt") << "OptimizationSolver: Pareto point " << values
+                         << std::endl;
+        d_paretoBlock.push_back(nm->mkOr(strict));
+      }
+      else
+      {
+        values.clear();
+      }
+    }
+  }
+  d_paretoValid = true;
+  d_paretoAssertions = nassertions;
+  d_paretoObjectives = d_objectives.size() + d_soft.size();
+  if (values.empty())
+  {
+    // either there are no more Pareto points, or we could not prove that the
+    // last point is a Pareto point
+    return r;
+  }
+  std::vector<Node> fixed;
+  for (size_t i = 0, nobjs = d_query.size(); i < nobjs; i++)
+  {
+    fixed.push_back(d_query[i].getTarget().eqNode(values[i]));
+  }
+  r = checkSat(fixed);
+  if (r.getStatus() == Result::SAT)
+  {
+    d_values = values;
+  }
+  return r;
+}
+
+bool OptimizationSolver::optimizeObjective(size_t i, Node& best, Result& r)
+{
+  const OptimizationObjective& obj = d_query[i];
+  best = d_lastValues[i];
+  bool optimal;
+  if (options().smt.optSearch == options::OptSearchMode::LINEAR)
+  {
+    optimal = optimizeLinear(i, best, r);
+  }
+  else if (obj.isSoft())
+  {
+    optimal = optimizeSoft(i, best, r);
+  }
+  else if (obj.getTarget().getType().isBitVector())
+  {
+    optimal = optimizeBitVector(i, best, r);
+  }
+  else
+  {
+    optimal = optimizeLinear(i, best, r);
+  }
+  if (optimal)
+  {
+    Trace("smt-opt") << "OptimizationSolver: optimal value for "
+                     << obj.getTarget() << " is " << best << std::endl;
+  }
+  return optimal;
+}
+
+bool OptimizationSolver::optimizeLinear(size_t i, Node& best, Result& r)
+{
+  NodeManager* nm = nodeManager();
+  const OptimizationObjective& obj = d_query[i];
+  Node target = obj.getTarget();
+  Trace("smt-opt") << "OptimizationSolver: optimize " << target
+                   << ", initial value " << best << std::endl;
+  // Linear arithmetic objectives are moreover optimized by the arithmetic
+  // solver, which pivots to the optimum of the current branch before the
+  // model is returned.
+  theory::arith::TheoryArith* arith = nullptr;
+  if (target.getType().isRealOrInt())
+  {
+    arith = getTheoryArith();
+    arith->setObjective(target,
+                        obj.getType() == modes::ObjectiveType::MINIMIZE);
+  }
+  Node infimum;
+  // an external value that is known not to be attained
+  Node rejected;
+  bool unbounded = false;
+  do
+  {
+    if (arith != nullptr && arith->isObjectiveUnbounded())
+    {
+      // The last model can be improved without bound, hence the linear search
+      // would not terminate.
+      unbounded = true;
+      break;
+    }
+    Node external = getExternalBound(i, best, rejected);
+    if (!external.isNull())
+    {
+      // Jump to a model that is at least as good as the external value. If
+      // there is none, the external value is ignored.
+      r = checkSat({obj.mkWeakImprovement(nm, external)});
+      if (r.getStatus() == Result::SAT)
+      {
+        best = d_lastValues[i];
+        ++d_numImprovements;
+        ++d_numExternal;
+        Trace("smt-opt") << "...improved to " << best << " by external value "
+                         << external << std::endl;
+        d_parent->assertFormula(obj.mkWeakImprovement(nm, best));
+        continue;
+      }
+      rejected = external;
+    }
+    // We ask for a strictly better value under an assumption, which is
+    // retracted after the check. If the check is unsat, best is optimal.
+    Node improve = obj.mkStrictImprovement(nm, best);
+    infimum = Node::null();
+    Rational bound;
+    bool strict;
+    if (arith != nullptr && target.getType().isReal()
+        && arith->getObjectiveBound(bound, strict) && strict)
+    {
+      // The model only approaches the optimum of its branch up to an
+      // infinitesimal, hence we must reach the optimum itself to improve.
+      infimum = nm->mkConstReal(bound);
+      improve = obj.mkWeakImprovement(nm, infimum);
+    }
+    r = checkSat({improve});
+    if (r.getStatus() == Result::SAT)
+    {
+      best = d_lastValues[i];
+      ++d_numImprovements;
+      Trace("smt-opt") << "...improved to " << best << std::endl;
+      // Tighten the bound permanently in the optimization context, which is
+      // the only new assertion the next check needs to preprocess.
+      d_parent->assertFormula(obj.mkWeakImprovement(nm, best));
+    }
+  } while (r.getStatus() == Result::SAT);
+  if (arith != nullptr)
+  {
+    arith->setObjective(Node::null(), true);
+  }
+  if (unbounded)
+  {
+    Trace("smt-opt") << "...objective is unbounded" << std::endl;
+    r = Result(Result::UNKNOWN, UnknownExplanation::INCOMPLETE);
+  }
+  else if (r.getStatus() == Result::UNSAT)
+  {
+    // no model improves on the last value we asked for
+    updateBound(i, infimum.isNull() ? best : infimum);
+    if (!infimum.isNull())
+    {
+      Trace("smt-opt") << "...optimum " << infimum << " is not attained"
+                       << std::endl;
+      r = Result(Result::UNKNOWN, UnknownExplanation::INCOMPLETE);
+      return false;
+    }
+  }
+  return r.getStatus() == Result::UNSAT;
+}
+
+Node OptimizationSolver::getExternalBound(size_t i,
+                                          const Node& best,
+                                          const Node& rejected)
+{
+  if (!d_bounds || d_interrupted
+      || (d_mode != modes::OptimizationMode::BOX
+          && !(d_mode == modes::OptimizationMode::LEX && i == 0)))
+  {
+    return Node::null();
+  }
+  std::vector<Node> values = d_bounds();
+  if (values.size() != d_query.size())
+  {
+    return Node::null();
+  }
+  const OptimizationObjective& obj = d_query[i];
+  Node value = values[i];
+  TypeNode tn = obj.getTarget().getType();
+  if (value.isNull() || !value.isConst()
+      || (tn.isBitVector() ? value.getType() != tn
+                           : !value.getType().isRealOrInt()))
+  {
+    return Node::null();
+  }
+  if (tn.isInteger() && !value.getConst<Rational>().isIntegral())
+  {
+    return Node::null();
+  }
+  if (!obj.isBetter(value, best)
+      || (!rejected.isNull()
+          && (value == rejected || obj.isBetter(value, rejected))))
+  {
+    return Node::null();
+  }
+  return value;
+}
+
+bool OptimizationSolver::optimizeBitVector(size_t i, Node& best, Result& r)
+{
+  NodeManager* nm = nodeManager();
+  const OptimizationObjective& obj = d_query[i];
+  Node target = obj.getTarget();
+  uint32_t width = target.getType().getBitVectorSize();
+  BitVector value = best.getConst<BitVector>();
+  Trace("smt-opt") << "OptimizationSolver: optimize bits of " << target
+                   << ", initial value " << value << std::endl;
+  Node zero = theory::bv::utils::mkZero(nm, 1);
+  Node one = theory::bv::utils::mkOne(nm, 1);
+  // The bits fixed so far, as assumptions. The last model, whose value for
+  // target is value, satisfies all of them.
+  std::vector<Node> fixed;
+  for (uint32_t j = width; j-- > 0;)
+  {
+    // The preferred value of bit j. For signed targets, the sign bit is
+    // preferred opposite to the other bits.
+    bool pref = obj.getType() == modes::ObjectiveType::MAXIMIZE;
+    if (obj.bvSigned() && j == width - 1)
+    {
+      pref = !pref;
+    }
+    Node bit = theory::bv::utils::mkExtract(target, j, j);
+    Node lit = bit.eqNode(pref ? one : zero);
+    if (value.isBitSet(j) != pref)
+    {
+      // Probe whether the preferred value is consistent with the bits fixed
+      // so far. Only these small assumptions are new to the SAT solver,
+      // which reuses the bits of target it has already computed.
+      std::vector<Node> assumptions = fixed;
+      assumptions.push_back(lit);
+      r = checkSat(assumptions);
+      if (r.getStatus() == Result::SAT)
+      {
+        value = d_lastValues[i].getConst<BitVector>();
+        ++d_numImprovements;
+        Trace("smt-opt") << "...improved to " << value << std::endl;
+      }
+      else if (r.getStatus() == Result::UNSAT)
+      {
+        lit = bit.eqNode(pref ? zero : one);
+        // no model is better than the fixed bits followed by the preferred
+        // values of the bits below j
+        BitVector bound = value;
+        for (uint32_t k = 0; k < j; ++k)
+        {
+          bound.setBit(k, obj.getType() == modes::ObjectiveType::MAXIMIZE);
+        }
+        updateBound(i, nm->mkConst(bound));
+      }
+      else
+      {
+        best = nm->mkConst(value);
+        return false;
+      }
+    }
+    fixed.push_back(lit);
+  }
+  best = nm->mkConst(value);
+  updateBound(i, best);
+  return true;
+}
+
+bool OptimizationSolver::optimizeSoft(size_t i, Node& best, Result& r)
+{
+  if (!options().smt.unsatAssumptions)
+  {
+    // without unsat assumptions, we resort to a linear search on the penalty
+    return optimizeLinear(i, best, r);
+  }
+  NodeManager* nm = nodeManager();
+  Node zero = nm->mkConstInt(Rational(0));
+  Node one = nm->mkConstInt(Rational(1));
+  // The weights of the current assumptions, which are initially the soft
+  // constraints of this objective. An assumption whose weight is reduced to
+  // zero is removed.
+  std::map<Node, Integer> weights;
+  for (const SoftConstraint& sc : d_soft)
+  {
+    if (sc.d_objective == i)
+    {
+      weights[sc.d_formula] += sc.d_weight;
+    }
+  }
+  // The cardinality constraints (<= s k) introduced for cores, mapped to s
+  // and k, where s counts the violated assumptions of a core.
+  std::map<Node, std::pair<Node, uint32_t>> cards;
+  // The lower bound on the optimal penalty, which is the sum of the weights
+  // of the cores found so far.
+  Integer lower;
+  // We only assume the assumptions whose weight is at least the threshold,
+  // starting with the largest weight. This stratification makes the first
+  // cores consist of heavy soft constraints. Without it, the threshold is the
+  // smallest weight, i.e., all assumptions are assumed from the start.
+  Integer threshold = weights.empty() ? Integer() : weights.begin()->second;
+  for (const std::pair<const Node, Integer>& w : weights)
+  {
+    threshold = options().smt.optStratify ? std::max(threshold, w.second)
+                                          : std::min(threshold, w.second);
+  }
+  Trace("smt-opt") << "OptimizationSolver: optimize " << weights.size()
+                   << " soft constraints, threshold " << threshold
+                   << std::endl;
+  while (true)
+  {
+    std::vector<Node> active;
+    for (const std::pair<const Node, Integer>& w : weights)
+    {
+      if (w.second >= threshold)
+      {
+        active.push_back(w.first);
+      }
+    }
+    r = checkSat(active);
+    if (r.getStatus() == Result::SAT)
+    {
+      best = d_lastValues[i];
+      // lower the threshold to the next smaller weight
+      Integer next;
+      for (const std::pair<const Node, Integer>& w : weights)
+      {
+        if (w.second < threshold && w.second > next)
+        {
+          next = w.second;
+        }
+      }
+      if (next.isZero())
+      {
+        // All assumptions hold, hence the penalty is the lower bound.
+        Assert(best.getConst<Rational>() == Rational(lower));
+        updateBound(i, best);
+        return true;
+      }
+      Trace("smt-opt") << "...penalty " << best << ", threshold " << next
+                       << std::endl;
+      threshold = next;
+      continue;
+    }
+    if (r.getStatus() != Result::UNSAT)
+    {
+      return false;
+    }
+    std::vector<Node> core = d_parent->getUnsatAssumptions();
+    if (core.empty())
+    {
+      // the assertions were satisfiable, hence this should not happen
+      Assert(false) << "empty core when optimizing soft constraints";
+      r = Result(Result::UNKNOWN, UnknownExplanation::INCOMPLETE);
+      return false;
+    }
+    ++d_numCores;
+    Integer wmin = weights[core[0]];
+    for (const Node& c : core)
+    {
+      wmin = std::min(wmin, weights[c]);
+    }
+    lower += wmin;
+    Trace("smt-opt") << "...core of size " << core.size() << ", weight "
+                     << wmin << ", lower bound " << lower << std::endl;
+    updateBound(i, nm->mkConstInt(Rational(lower)));
+    // At least one assumption of the core is violated, hence we relax each
+    // one by wmin and penalize each additional violation by wmin.
+    std::vector<Node> violated;
+    for (const Node& c : core)
+    {
+      Integer& w = weights[c];
+      w -= wmin;
+      if (w.isZero())
+      {
+        weights.erase(c);
+      }
+      violated.push_back(nm->mkNode(Kind::ITE, c, zero, one));
+      std::map<Node, std::pair<Node, uint32_t>>::iterator it = cards.find(c);
+      if (it != cards.end())
+      {
+        // (<= s k) is violated, hence we penalize (<= s (+ k 1)) instead
+        Node s = it->second.first;
+        uint32_t k = it->second.second + 1;
+        if (k < s.getNumChildren())
+        {
+          Node card = nm->mkNode(Kind::LEQ, s, nm->mkConstInt(Rational(k)));
+          weights[card] += wmin;
+          cards[card] = std::pair<Node, uint32_t>(s, k);
+        }
+      }
+    }
+    if (violated.size() > 1)
+    {
+      Node s = nm->mkNode(Kind::ADD, violated);
+      Node card = nm->mkNode(Kind::LEQ, s, one);
+      weights[card] += wmin;
+      cards[card] = std::pair<Node, uint32_t>(s, 1);
+    }
+  }
+}
+
+const std::vector<Node>& OptimizationSolver::getObjectiveValues() const
+{
+  return d_values;
+}
+
+Result OptimizationSolver::checkSat(const std::vector<Node>& assumptions)
+{
+  if (d_interrupted)
+  {
+    return Result(Result::UNKNOWN, UnknownExplanation::INTERRUPTED);
+  }
+  ++d_numChecks;
+  Result r = d_parent->checkSatInternal(assumptions);
+  if (r.getStatus() == Result::SAT)
+  {
+    d_lastValues.clear();
+    for (const OptimizationObjective& obj : d_query)
+    {
+      d_lastValues.push_back(getValue(obj.getTarget()));
+    }
+    updateIncumbent();
+  }
+  return r;
+}
+
+void OptimizationSolver::updateIncumbent()
+{
+  if (d_query.empty())
+  {
+    return;
+  }
+  bool improved = false;
+  if (d_incumbent.empty())
+  {
+    d_incumbent = d_lastValues;
+    improved = true;
+    if (d_firstModelTime.running())
+    {
+      d_firstModelTime.stop();
+    }
+  }
+  else if (d_mode == modes::OptimizationMode::BOX)
+  {
+    // any model of the checkpoint is a model of the assertions, hence each
+    // objective can take its best value from a different model
+    for (size_t i = 0, nobjs = d_query.size(); i < nobjs; i++)
+    {
+      if (d_query[i].isBetter(d_lastValues[i], d_incumbent[i]))
+      {
+        d_incumbent[i] = d_lastValues[i];
+        improved = true;
+      }
+    }
+  }
+  else if (d_mode == modes::OptimizationMode::PARETO)
+  {
+    bool strict = false;
+    bool weak = true;
+    for (size_t i = 0, nobjs = d_query.size(); i < nobjs && weak; i++)
+    {
+      if (d_query[i].isBetter(d_lastValues[i], d_incumbent[i]))
+      {
+        strict = true;
+      }
+      else if (d_lastValues[i] != d_incumbent[i])
+      {
+        weak = false;
+      }
+    }
+    improved = strict && weak;
+  }
+  else
+  {
+    for (size_t i = 0, nobjs = d_query.size(); i < nobjs; i++)
+    {
+      if (d_lastValues[i] != d_incumbent[i])
+      {
+        improved = d_query[i].isBetter(d_lastValues[i], d_incumbent[i]);
+        break;
+      }
+    }
+  }
+  if (!improved)
+  {
+    return;
+  }
+  if (d_mode != modes::OptimizationMode::BOX)
+  {
+    d_incumbent = d_lastValues;
+  }
+  Trace("smt-opt") << "OptimizationSolver: incumbent " << d_incumbent
+                   << std::endl;
+  if (options().decision.optPhase)
+  {
+    // Solution-guided search: the next checks start from the incumbent and
+    // only deviate from it where the new bounds require.
+    d_parent->d_smtSolver->getPropEngine()->preferModelPhases();
+  }
+  if (d_callback && !d_callback(d_incumbent))
+  {
+    Trace("smt-opt") << "OptimizationSolver: interrupted by callback"
+                     << std::endl;
+    d_interrupted = true;
+  }
+}
+
+void OptimizationSolver::updateBound(size_t i, const Node& bound)
+{
+  Node& current = d_dualBounds[i];
+  // a tighter bound is a worse value of the objective
+  if (!current.isNull() && !d_query[i].isBetter(current, bound))
+  {
+    return;
+  }
+  current = bound;
+  Trace("smt-opt") << "OptimizationSolver: bounds " << d_dualBounds
+                   << std::endl;
+  if (d_boundCallback && !d_boundCallback(d_dualBounds))
+  {
+    Trace("smt-opt") << "OptimizationSolver: interrupted by bound callback"
+                     << std::endl;
+    d_interrupted = true;
+  }
+}
+
+Node OptimizationSolver::getValue(const Node& t) const
+{
+  return d_parent->getValue(t);
+}
+
+theory::arith::TheoryArith* OptimizationSolver::getTheoryArith() const
+{
+  TheoryEngine* te = d_parent->d_smtSolver->getTheoryEngine();
+  Assert(te != nullptr);
+  return static_cast<theory::arith::TheoryArith*>(
+      te->theoryOf(theory::THEORY_ARITH));
+}
+
+}  // namespace smt
+}  // namespace cvc5::internal
@@ -0,0 +1,399 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * The solver for optimization queries.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__SMT__OPTIMIZATION_SOLVER_H
+#define CVC5__SMT__OPTIMIZATION_SOLVER_H
+
+#include <cvc5/cvc5_types.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "context/cdlist.h"
+#include "context/cdo.h"
+#include "expr/node.h"
+#include "smt/env_obj.h"
+#include "util/integer.h"
+#include "util/result.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+
+class SolverEngine;
+
+namespace theory {
+namespace arith {
+class TheoryArith;
+}
+}  // namespace theory
+
+namespace smt {
+
+/**
+ * An objective of an optimization query. This consists of a target term, the
+ * direction in which it is optimized and, for bit-vector targets, whether
+ * the target is compared as a signed or unsigned value.
+ *
+ * A MaxSMT objective minimizes the penalty of the soft constraints with a
+ * given id, i.e., the sum of the weights of the violated soft constraints.
+ */
+class OptimizationObjective
+{
+ public:
+  OptimizationObjective(Node target,
+                        modes::ObjectiveType type,
+                        bool bvSigned = false);
+  /** Make the MaxSMT objective for soft id softId with the given penalty */
+  OptimizationObjective(Node target, const std::string& softId);
+  /** Get the term to optimize */
+  Node getTarget() const { return d_target; }
+  /** Get the direction in which we optimize */
+  modes::ObjectiveType getType() const { return d_type; }
+  /** Is the target a bit-vector that is compared as a signed value? */
+  bool bvSigned() const { return d_bvSigned; }
+  /** Is this a MaxSMT objective? */
+  bool isSoft() const { return d_isSoft; }
+  /** Get the id of the soft constraints of this MaxSMT objective */
+  const std::string& getSoftId() const { return d_softId; }
+  /**
+   * Make the formula stating that the target is strictly better than value,
+   * e.g. (< target value) when minimizing an integer target.
+   */
+  Node mkStrictImprovement(NodeManager* nm, const Node& value) const;
+  /**
+   * Make the formula stating that the target is at least as good as value,
+   * e.g. (<= target value) when minimizing an integer target.
+   */
+  Node mkWeakImprovement(NodeManager* nm, const Node& value) const;
+  /**
+   * Is the constant a a strictly better value for the target than the
+   * constant b? Returns false if a or b is not a constant.
+   */
+  bool isBetter(const Node& a, const Node& b) const;
+
+ private:
+  /** Make the comparison (op a b), where op is strict if strict is true */
+  Node mkLess(NodeManager* nm, const Node& a, const Node& b, bool strict) const;
+  /** The target term */
+  Node d_target;
+  /** The optimization direction */
+  modes::ObjectiveType d_type;
+  /** Whether bit-vector targets are compared as signed values */
+  bool d_bvSigned;
+  /** Whether this is a MaxSMT objective */
+  bool d_isSoft;
+  /** The id of the soft constraints, if this is a MaxSMT objective */
+  std::string d_softId;
+};
+
+/** A soft constraint, i.e., a formula that is violated at a penalty */
+class SoftConstraint
+{
+ public:
+  SoftConstraint(Node formula, const Integer& weight, size_t objective);
+  /** The formula */
+  Node d_formula;
+  /** The penalty incurred if d_formula does not hold */
+  Integer d_weight;
+  /** The index of the MaxSMT objective this soft constraint belongs to */
+  size_t d_objective;
+};
+
+/**
+ * A solver for optimization queries.
+ *
+ * This class is responsible for responding to optimization queries over the
+ * objectives added via addObjective. It runs incrementally in the SolverEngine
+ * it belongs to, rather than in a subsolver: the assertions of the parent are
+ * preprocessed and sent to the SAT solver once, after which each improvement
+ * step only adds the (preprocessed) bound on the objective. Hence, the SAT
+ * state, including learned clauses, is kept alive across improvement steps.
+ *
+ * For arithmetic objectives, the search for an optimum is a linear search
+ * that is guided by the model values of the objective: each model yields a
+ * candidate value v, after which we ask whether an assignment strictly better
+ * than v exists. For bit-vector objectives, we instead fix the bits of the
+ * objective one at a time, starting with the most significant bit, using
+ * checks under assumptions. This avoids introducing a comparator circuit for
+ * each candidate value. All bounds are
+ * asserted in a dedicated user context that is popped once the query is
+ * finished, so that an optimization query does not change the assertions of
+ * the parent.
+ *
+ * For linear arithmetic objectives, the search is guided by the arithmetic
+ * solver, which optimizes the objective by pivoting on its tableau whenever it
+ * finds a satisfying assignment. Hence, each model already attains the optimum
+ * of its branch, and each improvement step moves to a new branch. If a real
+ * objective has an infimum (or supremum) that is not attained, or if the
+ * arithmetic solver finds that the objective is unbounded, we return
+ * "unknown" with the incumbent as the objective values.
+ *
+ * Multiple objectives are optimized according to the mode of the query:
+ * - In lexicographic mode, the objectives are optimized in the order in which
+ * they were added, where each objective is fixed to its optimal value before
+ * the next one is optimized.
+ * - In box mode, each objective is optimized independently. The assertions
+ * are checked once, and each objective is optimized from this shared
+ * checkpoint in a user context of its own.
+ * - In Pareto mode, each query returns a new Pareto-optimal point, using the
+ * guided improvement algorithm: starting from a model, we search for a model
+ * that dominates it until no such model exists. The points found so far are
+ * excluded from subsequent queries, as long as the assertions and objectives
+ * do not change.
+ *
+ * Soft constraints with the same id form a MaxSMT objective, which is
+ * optimized by the core-guided OLL algorithm with stratification if unsat
+ * assumptions are enabled, and by a linear search on the penalty otherwise.
+ *
+ * The search is anytime: we keep track of the best values found so far (the
+ * incumbent), which are reported to a callback whenever they improve. If the
+ * search is stopped before the optimum is proven, e.g. because the time limit
+ * of the query is reached or because the callback asks to stop, the result is
+ * "unknown" and the incumbent is returned as the objective values.
+ *
+ * Dually, each check that shows that no model improves on a value yields a
+ * bound on the optimum of an objective, i.e., a value that no model is
+ * better than. These bounds are reported to a second callback whenever they
+ * tighten, so that the gap to the incumbent is known while the search runs.
+ * They come from the last, unsat, check of a linear search, from the cores
+ * of the OLL algorithm and from the bits of a bit-vector objective that
+ * cannot take their preferred value.
+ *
+ * Each improvement of the incumbent also sets the preferred phases of the SAT
+ * solver to the values in its model (see option --opt-phase). The SAT solver
+ * applies them to its own decisions and to the literals suggested by the
+ * decision engine, whose polarity is not required (see
+ * TheoryProxy::getNextDecisionRequest). Hence, the decisions of the next
+ * check follow the incumbent until the new bounds force a deviation.
+ */
+class OptimizationSolver : protected EnvObj
+{
+ public:
+  OptimizationSolver(Env& env, SolverEngine* parent);
+  ~OptimizationSolver();
+
+  /**
+   * Add an objective in the current user context. The objective is removed
+   * when the user context in which it was added is popped.
+   *
+   * @param target The term to optimize, which must be of arithmetic or
+   * bit-vector type.
+   * @param type Whether to minimize or maximize target.
+   * @param bvSigned Whether target is compared as a signed value, if it is a
+   * bit-vector.
+   */
+  void addObjective(const Node& target,
+                    modes::ObjectiveType type,
+                    bool bvSigned = false);
+  /**
+   * Add a soft constraint in the current user context. The soft constraints
+   * with the same id form a single objective, which is added when the first
+   * of them is added.
+   *
+   * @param formula The soft constraint.
+   * @param weight The penalty incurred if formula does not hold, which must
+   * be positive.
+   * @param id The id of the soft constraint.
+   */
+  void assertSoft(const Node& formula,
+                  const Integer& weight,
+                  const std::string& id);
+  /**
+   * Check satisfiability of the assertions of the parent and optimize the
+   * current objectives.
+   *
+   * If this method returns "sat", then the parent SolverEngine has a model in
+   * which all objectives have their optimal value, which can be queried via
+   * the usual model queries. If this method returns "unsat", then the
+   * assertions are unsatisfiable. Otherwise, it returns "unknown", e.g. if
+   * the resource limit was exhausted before an optimum was found, if the
+   * optimum of a real objective is not attained, or if an objective is
+   * unbounded.
+   *
+   * In Pareto mode, "unsat" means that there are no further Pareto-optimal
+   * points.
+   *
+   * If there are no objectives, this is equivalent to a check-sat call.
+   *
+   * @param mode The mode for combining multiple objectives.
+   * @param callback If non-null, this is called with the values of the
+   * objectives whenever the incumbent improves, while the parent has a model
+   * with these values. The search is stopped if it returns false.
+   * @param bounds If non-null, this is called before each improvement step of
+   * a linear search and may return values of the objectives that are
+   * attained by a model found elsewhere, e.g. by another solver working on
+   * the same query. If such a value is better than the incumbent, the next
+   * step searches for a model that is at least as good as it. Values that
+   * turn out not to be attained are ignored.
+   * @param boundCallback If non-null, this is called with the bounds on the
+   * optima of the objectives whenever one of them tightens, where the bound
+   * of an objective is null if none is known yet. In lexicographic mode, the
+   * bound of an objective only holds in models in which the objectives
+   * before it have their optimal values. No bounds are reported in Pareto
+   * mode. The search is stopped if it returns false.
+   */
+  Result checkOpt(
+      modes::OptimizationMode mode,
+      const std::function<bool(const std::vector<Node>&)>& callback = nullptr,
+      const std::function<std::vector<Node>()>& bounds = nullptr,
+      const std::function<bool(const std::vector<Node>&)>& boundCallback =
+          nullptr);
+  /**
+   * Get the values of the objectives computed by the last call to checkOpt,
+   * in the order in which the objectives were added. If the last call to
+   * checkOpt returned "sat", these are the optimal values. If it returned
+   * "unknown", these are the best values found before the search stopped,
+   * which are not known to be optimal, or empty if no model was found.
+   * Otherwise, this is empty.
+   */
+  const std::vector<Node>& getObjectiveValues() const;
+
+ private:
+  /** Optimize the objectives lexicographically */
+  Result checkLexicographic();
+  /** Optimize each objective independently */
+  Result checkBox();
+  /** Compute the next Pareto-optimal point */
+  Result checkPareto();
+  /**
+   * Check satisfiability of the parent under the given assumptions. If the
+   * result is "sat", the values of the objectives in the model are stored in
+   * d_lastValues.
+   */
+  Result checkSat(const std::vector<Node>& assumptions);
+  /**
+   * Update the incumbent with the values in d_lastValues, and notify the
+   * callback if it improved. In lexicographic mode, the values improve the
+   * incumbent if they are lexicographically better. In box mode, each
+   * objective improves independently. In Pareto mode, the values improve the
+   * incumbent if they dominate it.
+   */
+  void updateIncumbent();
+  /**
+   * Update the bound on the optimum of the i-th objective, i.e., a value that
+   * no model is better than, and notify the bound callback if it tightened.
+   */
+  void updateBound(size_t i, const Node& bound);
+  /** Get the value of t in the current model of the parent */
+  Node getValue(const Node& t) const;
+  /** Get the arithmetic theory solver of the parent */
+  theory::arith::TheoryArith* getTheoryArith() const;
+  /**
+   * Optimize the i-th objective, given that the parent currently has a model
+   * and d_lastValues stores the values of the objectives in a model of the
+   * current assertions. Stores the best value found in best and the result of
+   * the last check in r.
+   *
+   * @return true if best is optimal.
+   */
+  bool optimizeObjective(size_t i, Node& best, Result& r);
+  /** Optimize the i-th objective, which is arithmetic, by a linear search */
+  bool optimizeLinear(size_t i, Node& best, Result& r);
+  /**
+   * Get the value of the i-th objective given by d_bounds, if it is better
+   * than best and is not better than or equal to rejected, which is a value
+   * that is known not to be attained. Returns null otherwise. External values
+   * are only used for objectives that are optimized independently of the
+   * others, i.e. the first objective in lexicographic mode and all
+   * objectives in box mode.
+   */
+  Node getExternalBound(size_t i, const Node& best, const Node& rejected);
+  /**
+   * Optimize the i-th objective, which is a bit-vector, by fixing its bits
+   * from the most significant to the least significant one. Each bit is fixed
+   * to its preferred value if this is consistent with the bits fixed before,
+   * which is checked by a single satisfiability check under assumptions, and
+   * to the other value otherwise. Hence, this requires at most one check per
+   * bit.
+   */
+  bool optimizeBitVector(size_t i, Node& best, Result& r);
+  /**
+   * Optimize the i-th objective, which is a MaxSMT objective, using the OLL
+   * algorithm. Each check assumes the soft constraints (or cardinality
+   * constraints introduced later) whose weight is at least a threshold. If
+   * the check is unsat, the unsat assumptions form a core, whose minimal
+   * weight w is a lower bound on the penalty. Its assumptions are relaxed by
+   * w, and a cardinality constraint stating that at most one of them is
+   * violated is added with weight w. If the check is sat, the threshold is
+   * lowered, until all assumptions are satisfied by a model, which is
+   * optimal.
+   */
+  bool optimizeSoft(size_t i, Node& best, Result& r);
+  /** The parent SolverEngine */
+  SolverEngine* d_parent;
+  /** The objectives, which are user-context dependent */
+  context::CDList<OptimizationObjective> d_objectives;
+  /** The soft constraints, which are user-context dependent */
+  context::CDList<SoftConstraint> d_soft;
+  /**
+   * The objectives of the current query, where the target of each MaxSMT
+   * objective is the penalty of its soft constraints.
+   */
+  std::vector<OptimizationObjective> d_query;
+  /** The values computed by the last call to checkOpt */
+  std::vector<Node> d_values;
+  /** The values of the objectives in the last model */
+  std::vector<Node> d_lastValues;
+  /** The mode of the current query */
+  modes::OptimizationMode d_mode;
+  /** The callback of the current query, if any */
+  std::function<bool(const std::vector<Node>&)> d_callback;
+  /** The provider of external bounds of the current query, if any */
+  std::function<std::vector<Node>()> d_bounds;
+  /** The best values found by the current query */
+  std::vector<Node> d_incumbent;
+  /** The callback for the bounds of the current query, if any */
+  std::function<bool(const std::vector<Node>&)> d_boundCallback;
+  /** The bounds on the optima found by the current query, or null */
+  std::vector<Node> d_dualBounds;
+  /** Whether the callback asked to stop the current query */
+  bool d_interrupted;
+  /**
+   * The formulas excluding the Pareto points found so far, each of which
+   * states that some objective is strictly better than in that point.
+   */
+  std::vector<Node> d_paretoBlock;
+  /**
+   * Whether d_paretoBlock is valid, which is reset when the user context in
+   * which it was last valid is popped.
+   */
+  context::CDO<bool> d_paretoValid;
+  /** The number of assertions when d_paretoBlock was last valid */
+  size_t d_paretoAssertions;
+  /**
+   * The number of objectives and soft constraints when d_paretoBlock was last
+   * valid
+   */
+  size_t d_paretoObjectives;
+  /** Number of calls to checkOpt */
+  IntStat d_numQueries;
+  /** Number of satisfiability checks made during optimization */
+  IntStat d_numChecks;
+  /** Number of improvements of an objective value */
+  IntStat d_numImprovements;
+  /** Number of cores found when optimizing soft constraints */
+  IntStat d_numCores;
+  /** Number of improvements due to external bounds */
+  IntStat d_numExternal;
+  /** Time spent in checkOpt */
+  TimerStat d_optTime;
+  /** Time spent in checkOpt until the first model of each query was found */
+  TimerStat d_firstModelTime;
+};
+
+}  // namespace smt
+}  // namespace cvc5::internal
+
+#endif /* CVC5__SMT__OPTIMIZATION_SOLVER_H */
@@ -1142,6 +1142,12 @@ bool SetDefaults::incompatibleWithProofs(Options& opts,
     reason << "deep restarts";
     return true;
   }
+  if (isFullPf && opts.arith.gomoryCuts)
+  {
+    // Gomory cuts are sent as lemmas without proofs
+    reason << "gomory-cuts";
+    return true;
+  }
   // specific to SAT solver
   if (opts.prop.satSolver == options::SatSolverMode::CADICAL)
   {
@@ -56,6 +56,7 @@
 #include "smt/model.h"
 #include "smt/model_blocker.h"
 #include "smt/model_core_builder.h"
+#include "smt/optimization_solver.h"
 #include "smt/preprocessor.h"
 #include "smt/proof_manager.h"
 #include "smt/quant_elim_solver.h"
@@ -115,6 +116,7 @@ SolverEngine::SolverEngine(NodeManager* nm, const Options* optr)
       d_abductSolver(nullptr),
       d_interpolSolver(nullptr),
       d_quantElimSolver(nullptr),
+      d_optSolver(nullptr),
       d_userLogicSet(false),
       d_safeOptsSetRegularOption(false),
       d_safeOptsSetRegularOptionToDefault(false),
@@ -134,6 +136,8 @@ SolverEngine::SolverEngine(NodeManager* nm, const Options* optr)
   // make the quantifier elimination solver
   d_quantElimSolver.reset(
       new QuantElimSolver(*d_env.get(), *d_smtSolver, d_ctxManager.get()));
+  // make the optimization solver
+  d_optSolver.reset(new OptimizationSolver(*d_env.get(), this));
 }
 
 bool SolverEngine::isFullyInited() const { return d_state->isFullyInited(); }
@@ -275,6 +279,7 @@ SolverEngine::~SolverEngine()
     d_abductSolver.reset(nullptr);
     d_interpolSolver.reset(nullptr);
     d_quantElimSolver.reset(nullptr);
+    d_optSolver.reset(nullptr);
     d_sygusSolver.reset(nullptr);
     d_smtDriver.reset(nullptr);
     d_smtSolver.reset(nullptr);
@@ -819,6 +824,8 @@ Result SolverEngine::checkSatInternal(const std::vector<Node>& assumptions)
                << endl;
   // notify our state of the check-sat result
   d_state->notifyCheckSatResult(r);
+  d_stats->d_nodeBytesPerNode =
+      d_env->getNodeManager()->getBytesPerNodeValue();
 
   // Check that SAT results generate a model correctly.
   if (d_env->getOptions().smt.checkModels)
@@ -924,6 +931,41 @@ std::vector<Node> SolverEngine::getUnsatAssumptions(void)
   return res;
 }
 
+void SolverEngine::addObjective(const Node& target,
+                                modes::ObjectiveType type,
+                                bool bvSigned)
+{
+  beginCall();
+  ensureWellFormedTerm(target, "addObjective");
+  d_optSolver->addObjective(target, type, bvSigned);
+}
+
+void SolverEngine::assertSoft(const Node& formula,
+                              const Integer& weight,
+                              const std::string& id)
+{
+  beginCall();
+  ensureWellFormedTerm(formula, "assertSoft");
+  d_optSolver->assertSoft(formula, weight, id);
+}
+
+Result SolverEngine::optimize(
+    modes::OptimizationMode mode,
+    const std::function<bool(const std::vector<Node>&)>& callback,
+    const std::function<std::vector<Node>()>& bounds,
+    const std::function<bool(const std::vector<Node>&)>& boundCallback)
+{
+  beginCall(true);
+  Result res = d_optSolver->checkOpt(mode, callback, bounds, boundCallback);
+  endCall();
+  return res;
+}
+
+std::vector<Node> SolverEngine::getObjectiveValues() const
+{
+  return d_optSolver->getObjectiveValues();
+}
+
 void SolverEngine::assertFormula(const Node& formula)
 {
   beginCall();
@@ -20,6 +20,7 @@
 
 #include <cvc5/cvc5_export.h>
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -47,6 +48,7 @@ class TypeNode;
 class ProofNode;
 
 class Env;
+class Integer;
 class NodeManager;
 class UnsatCore;
 class StatisticsRegistry;
@@ -71,6 +73,7 @@ class AbductionSolver;
 class InterpolationSolver;
 class QuantElimSolver;
 class FindSynthSolver;
+class OptimizationSolver;
 
 struct SolverEngineStatistics;
 class PfManager;
@@ -90,6 +93,7 @@ class QuantifiersEngine;
 class CVC5_EXPORT SolverEngine
 {
   friend class cvc5::Solver;
+  friend class smt::OptimizationSolver;
 
   /* .......................................................................  */
  public:
@@ -364,6 +368,61 @@ class CVC5_EXPORT SolverEngine
    */
   std::vector<Node> getUnsatAssumptions(void);
 
+  /*------------------------ optimization commands  -------------------------*/
+
+  /**
+   * Add an objective to be optimized by subsequent calls to optimize. The
+   * objective is removed when the current user context is popped.
+   *
+   * @param target The term to optimize, which must have integer or bit-vector
+   * type.
+   * @param type Whether to minimize or maximize target.
+   * @param bvSigned Whether target is compared as a signed value, if it is a
+   * bit-vector.
+   */
+  void addObjective(const Node& target,
+                    modes::ObjectiveType type,
+                    bool bvSigned = false);
+  /**
+   * Add a soft constraint to be satisfied by subsequent calls to optimize, if
+   * possible. For details, see Solver::assertSoft.
+   *
+   * @param formula The soft constraint.
+   * @param weight The penalty incurred if formula does not hold.
+   * @param id The id of the soft constraint.
+   */
+  void assertSoft(const Node& formula,
+                  const Integer& weight,
+                  const std::string& id);
+  /**
+   * Check satisfiability and optimize the current objectives. For details,
+   * see Solver::optimize.
+   *
+   * @param mode The mode for combining multiple objectives.
+   * @param callback If non-null, this is called with the best values of the
+   * objectives found so far whenever they improve. The search is stopped if
+   * it returns false.
+   * @param bounds If non-null, this is polled for values of the objectives
+   * found elsewhere, which the search tries to catch up with.
+   * @param boundCallback If non-null, this is called with the bounds on the
+   * optima of the objectives whenever they tighten. The search is stopped if
+   * it returns false.
+   * @return The result of the optimization query. If this is "sat", then the
+   * current model assigns all objectives their optimal value.
+   */
+  Result optimize(
+      modes::OptimizationMode mode,
+      const std::function<bool(const std::vector<Node>&)>& callback = nullptr,
+      const std::function<std::vector<Node>()>& bounds = nullptr,
+      const std::function<bool(const std::vector<Node>&)>& boundCallback =
+          nullptr);
+  /**
+   * Get the values of the objectives computed by the last call to optimize,
+   * in the order in which the objectives were added. These are the best
+   * values found so far if the last call returned "unknown".
+   */
+  std::vector<Node> getObjectiveValues() const;
+
   /*---------------------------- sygus commands  ---------------------------*/
 
   /**
@@ -1118,6 +1177,8 @@ class CVC5_EXPORT SolverEngine
   std::unique_ptr<smt::InterpolationSolver> d_interpolSolver;
   /** The solver for quantifier elimination queries */
   std::unique_ptr<smt::QuantElimSolver> d_quantElimSolver;
+  /** The solver for optimization queries */
+  std::unique_ptr<smt::OptimizationSolver> d_optSolver;
 
   /**
    * The logic set by the user. The actual logic, which may extend the user's
@@ -30,7 +30,8 @@ SolverEngineStatistics::SolverEngineStatistics(StatisticsRegistry& sr,
       d_solveTime(sr.registerTimer(name + "solveTime")),
       d_pushPopTime(sr.registerTimer(name + "pushPopTime")),
       d_processAssertionsTime(sr.registerTimer(name + "processAssertionsTime")),
-      d_simplifiedToFalse(sr.registerInt(name + "simplifiedToFalse"))
+      d_simplifiedToFalse(sr.registerInt(name + "simplifiedToFalse")),
+      d_nodeBytesPerNode(sr.registerValue<double>(name + "nodeBytesPerNode"))
 {
 }
 
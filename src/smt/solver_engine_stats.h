@@ -49,6 +49,11 @@ struct SolverEngineStatistics
 
   /** Has something simplified to false? */
   IntStat d_simplifiedToFalse;
+  /**
+   * Bytes reserved per node value of the node manager, updated after each
+   * satisfiability check
+   */
+  ValueStat<double> d_nodeBytesPerNode;
 }; /* struct SolverEngineStatistics */
 
 }  // namespace smt
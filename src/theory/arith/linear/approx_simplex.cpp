@@ -21,6 +21,8 @@
 
 #include <cfloat>
 #include <cmath>
+#include <limits>
+#include <memory>
 #include <unordered_set>
 
 #include "base/cvc5config.h"
@@ -28,13 +30,13 @@
 #include "proof/eager_proof_generator.h"
 #include "theory/arith/linear/constraint.h"
 #include "theory/arith/linear/cut_log.h"
+#include "theory/arith/linear/float_simplex.h"
 #include "theory/arith/linear/matrix.h"
 #include "theory/arith/linear/normal_form.h"
+#include "theory/arith/linear/partial_model.h"
 #include "util/statistics_registry.h"
 
 #ifdef CVC5_USE_GLPK
-#include "theory/arith/linear/partial_model.h"
-
 extern "C" {
 #include <glpk.h>
 } /* extern "C" */
@@ -3137,6 +3139,199 @@ void ApproxGLPK::tryCut(int nid, CutInfo& cut)
 /* End GPLK implementation. */
 #endif /*#ifdef CVC5_USE_GLPK */
 
+/* Begin native implementation. */
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+/**
+ * Solves the real relaxation with the double precision FloatSimplex. This
+ * only finds a candidate basis, which is verified and repaired by the exact
+ * simplex, see AttemptSolutionSDP. Integer solving, branching and cuts are
+ * not supported.
+ */
+class ApproxFloat : public ApproximateSimplex
+{
+ public:
+  ApproxFloat(const ArithVariables& vars, ApproximateStatistics& s);
+
+  void setBranchingDepth(int) override {}
+  ArithVar getBranchVar(const NodeLog&) const override
+  {
+    return ARITHVAR_SENTINEL;
+  }
+  std::optional<Rational> estimateWithCFE(double d) const override
+  {
+    return Rational::fromDouble(d);
+  }
+  std::optional<Rational> estimateWithCFE(double d,
+                                          const Integer&) const override
+  {
+    return Rational::fromDouble(d);
+  }
+  void tryCut(int, CutInfo&) override {}
+  std::vector<const CutInfo*> getValidCuts(const NodeLog&) override
+  {
+    return {};
+  }
+  void setPivotLimit(int pl) override { d_pivotLimit = pl; }
+  /** Only feasibility is searched for, there is no objective. */
+  ArithRatPairVec heuristicOptCoeffs() const override { return {}; }
+  void setOptCoeffs(const ArithRatPairVec&) override {}
+  void setBranchOnVariableLimit(int) override {}
+  LinResult solveRelaxation() override;
+  MipResult solveMIP(bool) override { return MipUnknown; }
+  Solution extractMIP() const override { Unreachable(); }
+  Solution extractRelaxation() const override;
+
+ private:
+  /** Used to approximate strict bounds, as in ApproxGLPK */
+  static constexpr double SMALL_FIXED_DELTA = .000000001;
+  /**
+   * The maximal number of rows. The factorization of the basis needs a dense
+   * scratch matrix of this size squared.
+   */
+  static constexpr size_t MAX_ROWS = 2000;
+
+  const ArithVariables& d_vars;
+  ApproximateStatistics& d_stats;
+  /** The index of each variable in d_simplex */
+  DenseMap<size_t> d_index;
+  /** The number of rows, i.e. auxiliary variables */
+  size_t d_numRows;
+  std::unique_ptr<FloatSimplex> d_simplex;
+  int d_pivotLimit;
+  bool d_solved;
+};
+
+ApproxFloat::ApproxFloat(const ArithVariables& vars, ApproximateStatistics& s)
+    : d_vars(vars),
+      d_stats(s),
+      d_numRows(0),
+      d_pivotLimit(std::numeric_limits<int>::max()),
+      d_solved(false)
+{
+  size_t numCols = 0;
+  for (ArithVariables::var_iterator vi = d_vars.var_begin(),
+                                    vi_end = d_vars.var_end();
+       vi != vi_end;
+       ++vi)
+  {
+    if (d_vars.isAuxiliary(*vi))
+    {
+      ++d_numRows;
+    }
+    else
+    {
+      d_index.set(*vi, numCols++);
+    }
+  }
+  d_simplex = std::make_unique<FloatSimplex>(numCols);
+  if (d_numRows > MAX_ROWS)
+  {
+    return;
+  }
+
+  std::vector<std::pair<size_t, double>> entries;
+  for (ArithVariables::var_iterator vi = d_vars.var_begin(),
+                                    vi_end = d_vars.var_end();
+       vi != vi_end;
+       ++vi)
+  {
+    ArithVar v = *vi;
+    if (!d_vars.isAuxiliary(v))
+    {
+      continue;
+    }
+    entries.clear();
+    Polynomial p = Polynomial::parsePolynomial(d_vars.asNode(v));
+    for (Polynomial::iterator j = p.begin(), end = p.end(); j != end; ++j)
+    {
+      const Monomial& mono = *j;
+      Node n = mono.getVarList().getNode();
+      Assert(d_vars.hasArithVar(n));
+      entries.emplace_back(d_index[d_vars.asArithVar(n)],
+                           mono.getConstant().getValue().getDouble());
+    }
+    d_index.set(v, d_simplex->addRow(entries));
+  }
+
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  for (ArithVariables::var_iterator vi = d_vars.var_begin(),
+                                    vi_end = d_vars.var_end();
+       vi != vi_end;
+       ++vi)
+  {
+    ArithVar v = *vi;
+    double lb = d_vars.hasLowerBound(v)
+                    ? d_vars.getLowerBound(v).approx(SMALL_FIXED_DELTA)
+                    : -inf;
+    double ub = d_vars.hasUpperBound(v)
+                    ? d_vars.getUpperBound(v).approx(SMALL_FIXED_DELTA)
+                    : inf;
+    d_simplex->setBounds(d_index[v], lb, ub);
+  }
+}
+
+LinResult ApproxFloat::solveRelaxation()
+{
+  Assert(!d_solved);
+  if (d_numRows > MAX_ROWS)
+  {
+    return LinUnknown;
+  }
+  FloatSimplex::Result res = d_simplex->solve(std::max(d_pivotLimit, 0));
+  d_stats.d_floatPivots += d_simplex->getPivots();
+  d_stats.d_floatFactorizations += d_simplex->getFactorizations();
+  Trace("approx") << "float simplex " << static_cast<int>(res) << " after "
+                  << d_simplex->getPivots() << " pivots" << std::endl;
+  switch (res)
+  {
+    case FloatSimplex::Result::FEASIBLE:
+      d_solved = true;
+      return LinFeasible;
+    case FloatSimplex::Result::INFEASIBLE:
+      d_solved = true;
+      return LinInfeasible;
+    case FloatSimplex::Result::LIMIT: return LinExhausted;
+    default: return LinUnknown;
+  }
+}
+
+ApproximateSimplex::Solution ApproxFloat::extractRelaxation() const
+{
+  Assert(d_solved);
+  Solution sol;
+  for (ArithVariables::var_iterator vi = d_vars.var_begin(),
+                                    vi_end = d_vars.var_end();
+       vi != vi_end;
+       ++vi)
+  {
+    ArithVar v = *vi;
+    // non-basic variables take exact values, the values of the basic
+    // variables follow from them
+    switch (d_simplex->getStatus(d_index[v]))
+    {
+      case FloatSimplex::VarStatus::BASIC: sol.newBasis.add(v); break;
+      case FloatSimplex::VarStatus::AT_LOWER:
+        sol.newValues.set(v, d_vars.getLowerBound(v));
+        break;
+      case FloatSimplex::VarStatus::AT_UPPER:
+        sol.newValues.set(v, d_vars.getUpperBound(v));
+        break;
+      case FloatSimplex::VarStatus::FREE:
+        sol.newValues.set(v, DeltaRational());
+        break;
+    }
+  }
+  return sol;
+}
+
+}  // namespace arith::linear
+}  // namespace theory
+}  // namespace cvc5::internal
+/* End native implementation. */
+
 /* Begin GPLK/NOGLPK Glue code. */
 namespace cvc5::internal {
 namespace theory {
@@ -3148,7 +3343,7 @@ ApproximateSimplex* ApproximateSimplex::mkApproximateSimplexSolver(
 #ifdef CVC5_USE_GLPK
   return new ApproxGLPK(vars, l, s);
 #else
-  Unimplemented() << "Approximate simplex solver requires GLPK";
+  return new ApproxFloat(vars, s);
 #endif
 }
 
@@ -3161,6 +3356,8 @@ bool ApproximateSimplex::enabled()
 #endif
 }
 
+bool ApproximateSimplex::relaxationEnabled() { return true; }
+
 ApproximateStatistics::ApproximateStatistics(StatisticsRegistry& sr)
     : d_branchMaxDepth(sr.registerInt("z::approx::branchMaxDepth")),
       d_branchesMaxOnAVar(sr.registerInt("z::approx::branchesMaxOnAVar")),
@@ -3168,7 +3365,9 @@ ApproximateStatistics::ApproximateStatistics(StatisticsRegistry& sr)
           sr.registerTimer("z::approx::gaussianElimConstruct::time")),
       d_gaussianElimConstruct(
           sr.registerInt("z::approx::gaussianElimConstruct::calls")),
-      d_averageGuesses(sr.registerAverage("z::approx::averageGuesses"))
+      d_averageGuesses(sr.registerAverage("z::approx::averageGuesses")),
+      d_floatPivots(sr.registerInt("z::approx::float::pivots")),
+      d_floatFactorizations(sr.registerInt("z::approx::float::factorizations"))
 {
 }
 
@@ -60,6 +60,10 @@ class ApproximateStatistics {
   TimerStat d_gaussianElimConstructTime;
   IntStat d_gaussianElimConstruct;
   AverageStat d_averageGuesses;
+
+  /* Pivots and factorizations of the double precision simplex */
+  IntStat d_floatPivots;
+  IntStat d_floatFactorizations;
 };
 
 
@@ -70,11 +74,18 @@ class CutInfo;
 
 class ApproximateSimplex{
  public:
-  /** Is GLPK enabled? */
+  /** Is GLPK enabled? Integer solving, branching and cuts require it. */
   static bool enabled();
 
   /**
-   * If GLPK is enabled, creates a GPLK-based approximating solver.
+   * Can the real relaxation be solved approximately? This is always the
+   * case, without GLPK a native double precision simplex is used.
+   */
+  static bool relaxationEnabled();
+
+  /**
+   * If GLPK is enabled, creates a GPLK-based approximating solver. Otherwise,
+   * creates a solver that only supports the real relaxation.
    */
   static ApproximateSimplex* mkApproximateSimplexSolver(
       const ArithVariables& vars, TreeLog& l, ApproximateStatistics& s);
@@ -0,0 +1,547 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A double precision revised simplex for finding feasible bases.
+ */
+
+#include "theory/arith/linear/float_simplex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "base/check.h"
+#include "base/output.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+namespace {
+
+constexpr uint32_t NO_POSITION = std::numeric_limits<uint32_t>::max();
+constexpr size_t NO_VAR = std::numeric_limits<size_t>::max();
+
+/** The tolerance for a value compared to bound, relative to its magnitude */
+double scaledTol(double tol, double bound)
+{
+  return tol * std::max(1.0, std::fabs(bound));
+}
+
+}  // namespace
+
+FloatSimplex::FloatSimplex(size_t n)
+    : d_n(n),
+      d_cols(n),
+      d_lb(n, -std::numeric_limits<double>::infinity()),
+      d_ub(n, std::numeric_limits<double>::infinity()),
+      d_value(n, 0.0),
+      d_status(n, VarStatus::FREE),
+      d_pivots(0),
+      d_factorizations(0)
+{
+}
+
+size_t FloatSimplex::addRow(
+    const std::vector<std::pair<size_t, double>>& entries)
+{
+  uint32_t row = static_cast<uint32_t>(numRows());
+  SparseVec& r = d_rows.emplace_back();
+  for (const std::pair<size_t, double>& e : entries)
+  {
+    Assert(e.first < d_n);
+    if (e.second != 0)
+    {
+      r.emplace_back(static_cast<uint32_t>(e.first), e.second);
+      d_cols[e.first].emplace_back(row, e.second);
+    }
+  }
+  d_lb.push_back(-std::numeric_limits<double>::infinity());
+  d_ub.push_back(std::numeric_limits<double>::infinity());
+  d_value.push_back(0.0);
+  d_status.push_back(VarStatus::BASIC);
+  return d_n + row;
+}
+
+void FloatSimplex::setBounds(size_t var, double lb, double ub)
+{
+  Assert(var < getNumVars());
+  d_lb[var] = lb;
+  d_ub[var] = ub;
+}
+
+void FloatSimplex::addColumn(size_t var,
+                             double mult,
+                             std::vector<double>& dense) const
+{
+  if (isLogical(var))
+  {
+    // the column of a logical variable is -e_i
+    dense[var - d_n] -= mult;
+    return;
+  }
+  for (const std::pair<uint32_t, double>& e : d_cols[var])
+  {
+    dense[e.first] += mult * e.second;
+  }
+}
+
+double FloatSimplex::dotColumn(size_t var, const std::vector<double>& y) const
+{
+  if (isLogical(var))
+  {
+    return -y[var - d_n];
+  }
+  double sum = 0;
+  for (const std::pair<uint32_t, double>& e : d_cols[var])
+  {
+    sum += e.second * y[e.first];
+  }
+  return sum;
+}
+
+bool FloatSimplex::factorize()
+{
+  ++d_factorizations;
+  d_etas.clear();
+  size_t m = numRows();
+  // The basis is mostly sparse. It is eliminated densely, but only the
+  // nonzeros of the pivot row are used in the row operations.
+  std::vector<double> dense(m * m, 0.0);
+  std::vector<double> column(m);
+  for (size_t k = 0; k < m; ++k)
+  {
+    std::fill(column.begin(), column.end(), 0.0);
+    addColumn(d_basis[k], 1.0, column);
+    for (size_t i = 0; i < m; ++i)
+    {
+      dense[i * m + k] = column[i];
+    }
+  }
+  d_perm.resize(m);
+  for (size_t i = 0; i < m; ++i)
+  {
+    d_perm[i] = static_cast<uint32_t>(i);
+  }
+  std::vector<size_t> nonzeros;
+  for (size_t k = 0; k < m; ++k)
+  {
+    size_t p = k;
+    for (size_t i = k + 1; i < m; ++i)
+    {
+      if (std::fabs(dense[i * m + k]) > std::fabs(dense[p * m + k]))
+      {
+        p = i;
+      }
+    }
+    double pivot = dense[p * m + k];
+    if (std::fabs(pivot) < PIVOT_TOL)
+    {
+      Trace("float-simplex") << "singular basis at " << k << std::endl;
+      return false;
+    }
+    if (p != k)
+    {
+      std::swap_ranges(dense.begin() + p * m,
+                       dense.begin() + (p + 1) * m,
+                       dense.begin() + k * m);
+      std::swap(d_perm[p], d_perm[k]);
+    }
+    nonzeros.clear();
+    for (size_t j = k + 1; j < m; ++j)
+    {
+      if (dense[k * m + j] != 0)
+      {
+        nonzeros.push_back(j);
+      }
+    }
+    for (size_t i = k + 1; i < m; ++i)
+    {
+      double& f = dense[i * m + k];
+      if (f == 0)
+      {
+        continue;
+      }
+      f /= pivot;
+      for (size_t j : nonzeros)
+      {
+        dense[i * m + j] -= f * dense[k * m + j];
+      }
+    }
+  }
+  d_lcols.assign(m, SparseVec());
+  d_ucols.assign(m, SparseVec());
+  d_udiag.resize(m);
+  for (size_t i = 0; i < m; ++i)
+  {
+    for (size_t j = 0; j < m; ++j)
+    {
+      double v = dense[i * m + j];
+      if (i == j)
+      {
+        d_udiag[j] = v;
+      }
+      else if (v != 0)
+      {
+        (i > j ? d_lcols : d_ucols)[j].emplace_back(i, v);
+      }
+    }
+  }
+  return true;
+}
+
+void FloatSimplex::ftran(std::vector<double>& a) const
+{
+  size_t m = numRows();
+  std::vector<double> b(m);
+  for (size_t i = 0; i < m; ++i)
+  {
+    b[i] = a[d_perm[i]];
+  }
+  for (size_t j = 0; j < m; ++j)
+  {
+    if (b[j] != 0)
+    {
+      for (const std::pair<uint32_t, double>& l : d_lcols[j])
+      {
+        b[l.first] -= l.second * b[j];
+      }
+    }
+  }
+  for (size_t j = m; j-- > 0;)
+  {
+    if (b[j] != 0)
+    {
+      b[j] /= d_udiag[j];
+      for (const std::pair<uint32_t, double>& u : d_ucols[j])
+      {
+        b[u.first] -= u.second * b[j];
+      }
+    }
+  }
+  for (const Eta& eta : d_etas)
+  {
+    double xr = b[eta.d_pos];
+    if (xr != 0)
+    {
+      b[eta.d_pos] = eta.d_pivot * xr;
+      for (const std::pair<uint32_t, double>& e : eta.d_entries)
+      {
+        b[e.first] += e.second * xr;
+      }
+    }
+  }
+  a.swap(b);
+}
+
+void FloatSimplex::btran(std::vector<double>& c) const
+{
+  size_t m = numRows();
+  for (auto it = d_etas.rbegin(), end = d_etas.rend(); it != end; ++it)
+  {
+    double sum = it->d_pivot * c[it->d_pos];
+    for (const std::pair<uint32_t, double>& e : it->d_entries)
+    {
+      sum += e.second * c[e.first];
+    }
+    c[it->d_pos] = sum;
+  }
+  // U^T z = c
+  for (size_t j = 0; j < m; ++j)
+  {
+    double sum = c[j];
+    for (const std::pair<uint32_t, double>& u : d_ucols[j])
+    {
+      sum -= u.second * c[u.first];
+    }
+    c[j] = sum / d_udiag[j];
+  }
+  // L^T w = z
+  for (size_t j = m; j-- > 0;)
+  {
+    double sum = c[j];
+    for (const std::pair<uint32_t, double>& l : d_lcols[j])
+    {
+      sum -= l.second * c[l.first];
+    }
+    c[j] = sum;
+  }
+  std::vector<double> y(m);
+  for (size_t i = 0; i < m; ++i)
+  {
+    y[d_perm[i]] = c[i];
+  }
+  c.swap(y);
+}
+
+void FloatSimplex::pushEta(uint32_t pos, const std::vector<double>& alpha)
+{
+  Eta& eta = d_etas.emplace_back();
+  eta.d_pos = pos;
+  eta.d_pivot = 1.0 / alpha[pos];
+  for (size_t i = 0, m = alpha.size(); i < m; ++i)
+  {
+    if (i != pos && alpha[i] != 0)
+    {
+      eta.d_entries.emplace_back(i, -alpha[i] * eta.d_pivot);
+    }
+  }
+}
+
+void FloatSimplex::computeBasicValues()
+{
+  // B x_B = -N x_N
+  std::vector<double> rhs(numRows(), 0.0);
+  for (size_t var = 0, N = getNumVars(); var < N; ++var)
+  {
+    if (d_status[var] != VarStatus::BASIC && d_value[var] != 0)
+    {
+      addColumn(var, -d_value[var], rhs);
+    }
+  }
+  ftran(rhs);
+  for (size_t i = 0, m = numRows(); i < m; ++i)
+  {
+    d_value[d_basis[i]] = rhs[i];
+  }
+}
+
+void FloatSimplex::setNonbasic(size_t var)
+{
+  if (std::isfinite(d_lb[var]))
+  {
+    d_status[var] = VarStatus::AT_LOWER;
+    d_value[var] = d_lb[var];
+  }
+  else if (std::isfinite(d_ub[var]))
+  {
+    d_status[var] = VarStatus::AT_UPPER;
+    d_value[var] = d_ub[var];
+  }
+  else
+  {
+    d_status[var] = VarStatus::FREE;
+    d_value[var] = 0;
+  }
+}
+
+bool FloatSimplex::computeCosts(std::vector<double>& costs) const
+{
+  bool infeasible = false;
+  for (size_t i = 0, m = numRows(); i < m; ++i)
+  {
+    size_t b = d_basis[i];
+    double x = d_value[b];
+    costs[i] = 0;
+    if (x < d_lb[b] - scaledTol(PRIMAL_TOL, d_lb[b]))
+    {
+      costs[i] = -1;
+      infeasible = true;
+    }
+    else if (x > d_ub[b] + scaledTol(PRIMAL_TOL, d_ub[b]))
+    {
+      costs[i] = 1;
+      infeasible = true;
+    }
+  }
+  return infeasible;
+}
+
+FloatSimplex::Result FloatSimplex::solve(uint64_t pivotLimit)
+{
+  d_pivots = 0;
+  d_factorizations = 0;
+  size_t m = numRows();
+  size_t N = getNumVars();
+
+  // start from the basis of the logical variables
+  d_basis.resize(m);
+  for (size_t var = 0; var < d_n; ++var)
+  {
+    setNonbasic(var);
+  }
+  for (size_t i = 0; i < m; ++i)
+  {
+    d_basis[i] = d_n + i;
+    d_status[d_n + i] = VarStatus::BASIC;
+  }
+  if (!factorize())
+  {
+    return Result::FAILED;
+  }
+  computeBasicValues();
+
+  std::vector<double> costs(m);
+  std::vector<double> y;
+  std::vector<double> alpha;
+  size_t degenerate = 0;
+  for (uint64_t iteration = 0;; ++iteration)
+  {
+    if (!computeCosts(costs))
+    {
+      return Result::FEASIBLE;
+    }
+    if (iteration >= pivotLimit)
+    {
+      return Result::LIMIT;
+    }
+    bool bland = degenerate >= DEGENERATE_LIMIT;
+
+    // pricing: the reduced cost of x_j in the sum of infeasibilities is
+    // -y^T a_j, where B^T y = costs
+    y = costs;
+    btran(y);
+    size_t entering = NO_VAR;
+    double dir = 0;
+    double best = 0;
+    for (size_t var = 0; var < N; ++var)
+    {
+      if (d_status[var] == VarStatus::BASIC)
+      {
+        continue;
+      }
+      double d = -dotColumn(var, y);
+      double vdir = 0;
+      if (d < -DUAL_TOL && d_value[var] < d_ub[var])
+      {
+        vdir = 1;
+      }
+      else if (d > DUAL_TOL && d_value[var] > d_lb[var])
+      {
+        vdir = -1;
+      }
+      if (vdir == 0)
+      {
+        continue;
+      }
+      if (bland)
+      {
+        entering = var;
+        dir = vdir;
+        break;
+      }
+      if (std::fabs(d) > best)
+      {
+        best = std::fabs(d);
+        entering = var;
+        dir = vdir;
+      }
+    }
+    if (entering == NO_VAR)
+    {
+      // the sum of infeasibilities is minimal
+      return Result::INFEASIBLE;
+    }
+
+    // ratio test: x_B changes by -alpha * dir * t
+    alpha.assign(m, 0.0);
+    addColumn(entering, 1.0, alpha);
+    ftran(alpha);
+    double step = d_ub[entering] - d_lb[entering];
+    uint32_t leaving = NO_POSITION;
+    bool leavesAtUpper = false;
+    for (size_t i = 0; i < m; ++i)
+    {
+      if (std::fabs(alpha[i]) < PIVOT_TOL)
+      {
+        continue;
+      }
+      double rate = -alpha[i] * dir;
+      size_t b = d_basis[i];
+      double x = d_value[b];
+      double t;
+      bool atUpper;
+      if (rate < 0)
+      {
+        if (x > d_ub[b] + scaledTol(PRIMAL_TOL, d_ub[b]))
+        {
+          t = (x - d_ub[b]) / -rate;
+          atUpper = true;
+        }
+        else if (x >= d_lb[b] - scaledTol(PRIMAL_TOL, d_lb[b]))
+        {
+          t = std::max(0.0, x - d_lb[b]) / -rate;
+          atUpper = false;
+        }
+        else
+        {
+          continue;
+        }
+      }
+      else
+      {
+        if (x < d_lb[b] - scaledTol(PRIMAL_TOL, d_lb[b]))
+        {
+          t = (d_lb[b] - x) / rate;
+          atUpper = false;
+        }
+        else if (x <= d_ub[b] + scaledTol(PRIMAL_TOL, d_ub[b]))
+        {
+          t = std::max(0.0, d_ub[b] - x) / rate;
+          atUpper = true;
+        }
+        else
+        {
+          continue;
+        }
+      }
+      bool better = t < step;
+      if (!better && t == step && leaving != NO_POSITION)
+      {
+        better = bland ? b < d_basis[leaving]
+                       : std::fabs(alpha[i]) > std::fabs(alpha[leaving]);
+      }
+      if (better)
+      {
+        step = t;
+        leaving = static_cast<uint32_t>(i);
+        leavesAtUpper = atUpper;
+      }
+    }
+    if (!std::isfinite(step))
+    {
+      // the sum of infeasibilities is bounded, so this is a numerical issue
+      Trace("float-simplex") << "unbounded step on " << entering << std::endl;
+      return Result::FAILED;
+    }
+
+    d_value[entering] += dir * step;
+    for (size_t i = 0; i < m; ++i)
+    {
+      d_value[d_basis[i]] -= alpha[i] * dir * step;
+    }
+    degenerate = step == 0 ? degenerate + 1 : 0;
+    if (leaving == NO_POSITION)
+    {
+      // the entering variable moves to its other bound
+      d_status[entering] = dir > 0 ? VarStatus::AT_UPPER : VarStatus::AT_LOWER;
+      d_value[entering] = dir > 0 ? d_ub[entering] : d_lb[entering];
+      continue;
+    }
+    size_t b = d_basis[leaving];
+    d_status[b] = leavesAtUpper ? VarStatus::AT_UPPER : VarStatus::AT_LOWER;
+    d_value[b] = leavesAtUpper ? d_ub[b] : d_lb[b];
+    d_basis[leaving] = entering;
+    d_status[entering] = VarStatus::BASIC;
+    pushEta(leaving, alpha);
+    ++d_pivots;
+    if (d_etas.size() >= REFACTOR_PERIOD)
+    {
+      if (!factorize())
+      {
+        return Result::FAILED;
+      }
+      computeBasicValues();
+    }
+  }
+}
+
+}  // namespace arith::linear
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -0,0 +1,185 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A double precision revised simplex for finding feasible bases.
+ */
+
+#include "cvc5_private.h"
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+/**
+ * A bounded revised simplex over doubles that searches for a basis in which
+ * all variables are within their bounds.
+ *
+ * The problem has structural variables 0..n-1 and one logical variable per
+ * row, numbered n..n+m-1, which is defined as the sum of the row:
+ *   x_{n+i} = sum_j a_ij x_j
+ * Every variable may have a lower and an upper bound. Initially, the logical
+ * variables are basic and the structural variables are at one of their
+ * bounds.
+ *
+ * The search minimizes the sum of infeasibilities of the basic variables
+ * (a composite phase one). The basis is kept as a sparse LU factorization
+ * with an eta file of product form updates, which is refactored
+ * periodically.
+ *
+ * The result is only approximate. It is meant to be a starting point for
+ * the exact simplex, which verifies it and repairs it with exact pivots.
+ */
+class FloatSimplex
+{
+ public:
+  enum class Result
+  {
+    /* All variables are within their bounds up to the tolerance */
+    FEASIBLE,
+    /* The sum of infeasibilities is minimal and not zero */
+    INFEASIBLE,
+    /* The pivot limit was reached */
+    LIMIT,
+    /* A numerical failure, e.g., a singular basis */
+    FAILED
+  };
+
+  enum class VarStatus
+  {
+    BASIC,
+    AT_LOWER,
+    AT_UPPER,
+    /* Non-basic without bounds, its value is 0 */
+    FREE
+  };
+
+  /** Creates a problem with n structural variables and no rows */
+  FloatSimplex(size_t n);
+
+  /**
+   * Adds a row over the structural variables, returns its logical variable.
+   * The columns of the entries must be distinct.
+   */
+  size_t addRow(const std::vector<std::pair<size_t, double>>& entries);
+
+  /** Sets the bounds of a variable, infinite values mean no bound */
+  void setBounds(size_t var, double lb, double ub);
+
+  /**
+   * Runs the simplex with at most pivotLimit iterations, which are pivots
+   * or moves of a non-basic variable to its other bound.
+   */
+  Result solve(uint64_t pivotLimit);
+
+  /** The number of variables, structural and logical */
+  size_t getNumVars() const { return d_lb.size(); }
+  /** The status of var after solve() */
+  VarStatus getStatus(size_t var) const { return d_status[var]; }
+  /** The value of var after solve() */
+  double getValue(size_t var) const { return d_value[var]; }
+  /** The number of pivots of the last call to solve() */
+  uint64_t getPivots() const { return d_pivots; }
+  /** The number of factorizations of the last call to solve() */
+  uint64_t getFactorizations() const { return d_factorizations; }
+
+ private:
+  /** A sparse vector as (index, value) pairs */
+  using SparseVec = std::vector<std::pair<uint32_t, double>>;
+  /** An elementary matrix of a basis update, see pushEta() */
+  struct Eta
+  {
+    /* The position of the basis that was replaced */
+    uint32_t d_pos;
+    /* 1/alpha_r */
+    double d_pivot;
+    /* -alpha_i/alpha_r for i != r */
+    SparseVec d_entries;
+  };
+
+  /** The number of updates after which the basis is refactored */
+  static constexpr size_t REFACTOR_PERIOD = 64;
+  /** The tolerance on bounds */
+  static constexpr double PRIMAL_TOL = 1e-7;
+  /** The tolerance on reduced costs */
+  static constexpr double DUAL_TOL = 1e-7;
+  /** The smallest absolute value of a pivot */
+  static constexpr double PIVOT_TOL = 1e-9;
+  /**
+   * The number of consecutive degenerate pivots after which Bland's rule is
+   * used to avoid cycling
+   */
+  static constexpr size_t DEGENERATE_LIMIT = 50;
+
+  /** The number of rows */
+  size_t numRows() const { return d_rows.size(); }
+  /** Is var a logical variable? */
+  bool isLogical(size_t var) const { return var >= d_n; }
+  /** Adds mult times the column of var to dense */
+  void addColumn(size_t var, double mult, std::vector<double>& dense) const;
+  /** The dot product of the column of var with the dense vector y */
+  double dotColumn(size_t var, const std::vector<double>& y) const;
+
+  /** Computes the LU factorization of the basis, false if it is singular */
+  bool factorize();
+  /** Solves B x = a in place */
+  void ftran(std::vector<double>& a) const;
+  /** Solves B^T y = c in place */
+  void btran(std::vector<double>& c) const;
+  /** Records the replacement of the basic variable at pos given alpha */
+  void pushEta(uint32_t pos, const std::vector<double>& alpha);
+  /** Recomputes the values of the basic variables from the non-basic ones */
+  void computeBasicValues();
+
+  /** Puts the non-basic var at a bound, or 0 if it has none */
+  void setNonbasic(size_t var);
+  /** The infeasibility costs of the basic variables, false if all are 0 */
+  bool computeCosts(std::vector<double>& costs) const;
+
+  /** The number of structural variables */
+  size_t d_n;
+  /** The rows over the structural variables */
+  std::vector<SparseVec> d_rows;
+  /** The columns of the structural variables */
+  std::vector<SparseVec> d_cols;
+
+  /** The bounds of the variables */
+  std::vector<double> d_lb;
+  std::vector<double> d_ub;
+  /** The current values */
+  std::vector<double> d_value;
+  /** The current status */
+  std::vector<VarStatus> d_status;
+  /** The basic variable at each position of the basis */
+  std::vector<size_t> d_basis;
+
+  /** The row permutation of the factorization: P a = a[d_perm[i]] */
+  std::vector<uint32_t> d_perm;
+  /** The columns of L below the diagonal, L has a unit diagonal */
+  std::vector<SparseVec> d_lcols;
+  /** The columns of U above the diagonal */
+  std::vector<SparseVec> d_ucols;
+  /** The diagonal of U */
+  std::vector<double> d_udiag;
+  /** The updates since the last factorization */
+  std::vector<Eta> d_etas;
+
+  /** Statistics of the last call to solve() */
+  uint64_t d_pivots;
+  uint64_t d_factorizations;
+};
+
+}  // namespace arith::linear
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -0,0 +1,342 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Gomory mixed-integer cuts derived from the exact simplex tableau.
+ */
+
+#include "theory/arith/linear/gomory_cuts.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "base/output.h"
+#include "expr/node_manager.h"
+#include "options/arith_options.h"
+#include "smt/env.h"
+#include "theory/arith/linear/constraint.h"
+#include "theory/arith/linear/partial_model.h"
+#include "theory/arith/linear/tableau.h"
+
+using namespace std;
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+/** The largest multiplier of a row that is tried by mkCut() */
+static constexpr uint32_t MAX_ROW_SCALE = 4;
+
+GomoryCuts::GomoryCuts(Env& env,
+                       const ArithVariables& vars,
+                       const Tableau& tableau)
+    : EnvObj(env),
+      d_vars(vars),
+      d_tableau(tableau),
+      d_statistics(statisticsRegistry())
+{
+}
+
+GomoryCuts::Statistics::Statistics(StatisticsRegistry& sr)
+    : d_separations(sr.registerInt("theory::arith::gomory::separations")),
+      d_generated(sr.registerInt("theory::arith::gomory::generated")),
+      d_rejected(sr.registerInt("theory::arith::gomory::rejected")),
+      d_emitted(sr.registerInt("theory::arith::gomory::emitted")),
+      d_aged(sr.registerInt("theory::arith::gomory::aged")),
+      d_separationTimer(
+          sr.registerTimer("theory::arith::gomory::separationTimer"))
+{
+}
+
+size_t GomoryCuts::separate(size_t max)
+{
+  TimerStat::CodeTimer codeTimer(d_statistics.d_separationTimer);
+  ++(d_statistics.d_separations);
+
+  // the distance of the fractional part of the candidates to 1/2
+  std::vector<std::pair<Rational, ArithVar>> candidates;
+  Rational half(1, 2);
+  for (Tableau::BasicIterator i = d_tableau.beginBasic(),
+                              end = d_tableau.endBasic();
+       i != end;
+       ++i)
+  {
+    ArithVar basic = *i;
+    const DeltaRational& a = d_vars.getAssignment(basic);
+    if (!d_vars.isInteger(basic) || !a.infinitesimalIsZero()
+        || a.getNoninfinitesimalPart().isIntegral())
+    {
+      continue;
+    }
+    Rational dist = (a.getNoninfinitesimalPart().floor_frac() - half).abs();
+    candidates.emplace_back(dist, basic);
+  }
+  std::sort(candidates.begin(), candidates.end());
+
+  size_t added = 0;
+  for (size_t i = 0, n = std::min(max, candidates.size()); i < n; ++i)
+  {
+    Cut cut;
+    if (!mkCut(candidates[i].second, cut))
+    {
+      ++(d_statistics.d_rejected);
+      continue;
+    }
+    if (!d_lemmas.insert(cut.d_lemma).second)
+    {
+      continue;
+    }
+    Trace("arith::gomory") << "gomory cut from " << candidates[i].second
+                           << ": " << cut.d_lemma << std::endl;
+    d_pool.push_back(std::move(cut));
+    ++(d_statistics.d_generated);
+    ++added;
+  }
+  return added;
+}
+
+double GomoryCuts::mir(const std::vector<std::pair<ArithVar, Rational>>& row,
+                       const Rational& beta,
+                       const std::vector<bool>& integral,
+                       const Rational& scale,
+                       std::vector<Rational>& g) const
+{
+  // The row scale * x_b - sum_j scale * a_j y_j = scale * beta has the
+  // integer variable scale * x_b, the GMI is computed on it.
+  Rational f0 = (beta * scale).floor_frac();
+  if (f0.isZero())
+  {
+    return 0;
+  }
+  Rational oneMinusF0 = Rational(1) - f0;
+  double norm = 0;
+  g.clear();
+  for (size_t j = 0, n = row.size(); j < n; ++j)
+  {
+    Rational alpha = -(row[j].second * scale);
+    Rational gj;
+    if (integral[j])
+    {
+      Rational fj = alpha.floor_frac();
+      gj = fj <= f0 ? fj / f0 : (Rational(1) - fj) / oneMinusF0;
+    }
+    else
+    {
+      gj = alpha.sgn() >= 0 ? alpha / f0 : -alpha / oneMinusF0;
+    }
+    double d = gj.getDouble();
+    norm += d * d;
+    g.push_back(gj);
+  }
+  if (norm == 0)
+  {
+    // the bounds alone are in conflict with the integrality of x_b
+    return std::numeric_limits<double>::infinity();
+  }
+  return 1 / std::sqrt(norm);
+}
+
+bool GomoryCuts::mkCut(ArithVar basic, Cut& cut)
+{
+  Assert(d_tableau.isBasic(basic));
+  Rational beta = d_vars.getAssignment(basic).getNoninfinitesimalPart();
+
+  // x_b = beta + sum_j a_j y_j where y_j = x_j - l_j or y_j = u_j - x_j
+  std::vector<std::pair<ArithVar, Rational>> row;
+  std::vector<bool> integral;
+  std::vector<bool> atUpper;
+  ConstraintCPVec exp;
+  for (Tableau::RowIterator i = d_tableau.basicRowIterator(basic); !i.atEnd();
+       ++i)
+  {
+    ArithVar x = (*i).getColVar();
+    if (x == basic)
+    {
+      continue;
+    }
+    const Rational& c = (*i).getCoefficient();
+    ConstraintP bound;
+    bool upper = false;
+    if (d_vars.hasLowerBound(x) && d_vars.cmpAssignmentLowerBound(x) == 0)
+    {
+      bound = d_vars.getLowerBoundConstraint(x);
+    }
+    else if (d_vars.hasUpperBound(x) && d_vars.cmpAssignmentUpperBound(x) == 0)
+    {
+      bound = d_vars.getUpperBoundConstraint(x);
+      upper = true;
+    }
+    else
+    {
+      // not at a bound, the row cannot be used
+      return false;
+    }
+    const DeltaRational& b = bound->getValue();
+    if (!b.infinitesimalIsZero())
+    {
+      return false;
+    }
+    row.emplace_back(x, upper ? -c : c);
+    integral.push_back(d_vars.isInteger(x)
+                       && b.getNoninfinitesimalPart().isIntegral());
+    atUpper.push_back(upper);
+    exp.push_back(bound);
+  }
+
+  // try the multiples of the row and keep the most efficacious cut
+  std::vector<Rational> g, best;
+  double bestEfficacy = 0;
+  for (uint32_t k = 1; k <= MAX_ROW_SCALE; ++k)
+  {
+    double e = mir(row, beta, integral, Rational(k), g);
+    if (e > bestEfficacy)
+    {
+      bestEfficacy = e;
+      best.swap(g);
+    }
+  }
+  if (bestEfficacy == 0)
+  {
+    return false;
+  }
+
+  // sum_j g_j y_j >= 1 in terms of the x_j
+  uint32_t cap = options().arith.lemmaRejectCutSize;
+  NodeManager* nm = nodeManager();
+  std::vector<Node> children;
+  cut.d_lhs.clear();
+  cut.d_rhs = Rational(1);
+  cut.d_age = 0;
+  for (size_t j = 0, n = row.size(); j < n; ++j)
+  {
+    if (best[j].isZero())
+    {
+      continue;
+    }
+    ArithVar x = row[j].first;
+    const Rational& b =
+        (atUpper[j] ? d_vars.getUpperBound(x) : d_vars.getLowerBound(x))
+            .getNoninfinitesimalPart();
+    Rational q = atUpper[j] ? -best[j] : best[j];
+    cut.d_rhs += q * b;
+    if (q.complexity() > cap || !d_vars.hasNode(x))
+    {
+      return false;
+    }
+    Node xNode = d_vars.asNode(x);
+    children.push_back(nm->mkNode(Kind::MULT, nm->mkConstReal(q), xNode));
+    cut.d_lhs.emplace_back(xNode, q);
+  }
+  if (cut.d_rhs.complexity() > cap)
+  {
+    return false;
+  }
+  Node sum;
+  if (children.empty())
+  {
+    sum = nm->mkConstReal(Rational(0));
+  }
+  else
+  {
+    sum = children.size() == 1 ? children[0] : nm->mkNode(Kind::ADD, children);
+  }
+  Node lit = rewrite(nm->mkNode(Kind::GEQ, sum, nm->mkConstReal(cut.d_rhs)));
+  if (lit.isConst() && lit.getConst<bool>())
+  {
+    return false;
+  }
+  Node antecedent = Constraint::externalExplainByAssertions(nm, exp);
+  cut.d_lemma = antecedent.impNode(lit);
+  return true;
+}
+
+double GomoryCuts::efficacy(const Cut& c, bool& stale) const
+{
+  DeltaRational value;
+  double norm = 0;
+  for (const std::pair<Node, Rational>& term : c.d_lhs)
+  {
+    if (!d_vars.hasArithVar(term.first))
+    {
+      stale = true;
+      return -1;
+    }
+    ArithVar x = d_vars.asArithVar(term.first);
+    value = value + d_vars.getAssignment(x) * term.second;
+    double d = term.second.getDouble();
+    norm += d * d;
+  }
+  if (value >= DeltaRational(c.d_rhs))
+  {
+    return -1;
+  }
+  if (norm == 0)
+  {
+    return std::numeric_limits<double>::infinity();
+  }
+  // only violated by the infinitesimal part if this is 0
+  double violation = (c.d_rhs - value.getNoninfinitesimalPart()).getDouble();
+  return std::max(violation, 0.0) / std::sqrt(norm);
+}
+
+std::vector<TrustNode> GomoryCuts::getCuts(size_t n)
+{
+  std::vector<std::pair<double, size_t>> violated;
+  std::vector<bool> stale(d_pool.size(), false);
+  for (size_t i = 0, size = d_pool.size(); i < size; ++i)
+  {
+    bool s = false;
+    double e = efficacy(d_pool[i], s);
+    stale[i] = s;
+    if (e >= 0)
+    {
+      violated.emplace_back(-e, i);
+    }
+  }
+  std::stable_sort(violated.begin(), violated.end());
+
+  std::vector<TrustNode> lemmas;
+  std::vector<bool> emitted(d_pool.size(), false);
+  for (size_t i = 0, m = std::min(n, violated.size()); i < m; ++i)
+  {
+    size_t pos = violated[i].second;
+    emitted[pos] = true;
+    lemmas.push_back(TrustNode::mkTrustLemma(d_pool[pos].d_lemma, nullptr));
+    ++(d_statistics.d_emitted);
+  }
+
+  // age the cuts that stay in the pool
+  uint64_t maxAge = options().arith.cutPoolMaxAge;
+  size_t kept = 0;
+  for (size_t i = 0, size = d_pool.size(); i < size; ++i)
+  {
+    if (emitted[i])
+    {
+      continue;
+    }
+    if (stale[i] || ++d_pool[i].d_age > maxAge)
+    {
+      // the cut may be derived again later
+      d_lemmas.erase(d_pool[i].d_lemma);
+      ++(d_statistics.d_aged);
+      continue;
+    }
+    if (kept != i)
+    {
+      d_pool[kept] = std::move(d_pool[i]);
+    }
+    ++kept;
+  }
+  d_pool.resize(kept);
+  return lemmas;
+}
+
+}  // namespace arith::linear
+}  // namespace theory
+}  // namespace cvc5::internal
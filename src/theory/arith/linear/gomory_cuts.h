@@ -0,0 +1,148 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Gomory mixed-integer cuts derived from the exact simplex tableau.
+ */
+
+#include "cvc5_private.h"
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "expr/node.h"
+#include "proof/trust_node.h"
+#include "smt/env_obj.h"
+#include "theory/arith/linear/arithvar.h"
+#include "theory/arith/linear/constraint_forward.h"
+#include "util/rational.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+class ArithVariables;
+class Tableau;
+
+/**
+ * Generates Gomory mixed-integer (GMI) cuts from the rows of the tableau and
+ * manages a pool of them.
+ *
+ * Let x_b be an integer basic variable with a fractional assignment whose
+ * row is x_b = sum_j c_j x_j. If every non-basic x_j is at one of its
+ * bounds, substituting y_j = x_j - l_j or y_j = u_j - x_j gives
+ *   x_b = beta + sum_j a_j y_j, with y_j >= 0,
+ * from which the mixed-integer rounding (MIR) of the row derives a cut
+ * sum_j g_j y_j >= 1 that is violated by the current assignment (y = 0).
+ * The row is also tried multiplied by small integers, which gives different
+ * cuts, and the most efficacious one is kept. Everything is computed with
+ * rationals, so the cuts are exact. A cut is emitted as the lemma
+ *   (and bounds) => cut
+ * where bounds are the bound constraints of the non-basic variables.
+ *
+ * Cuts that are not emitted right away stay in the pool and are retried in
+ * later rounds as long as they are violated by the assignment at that
+ * point. They age every round and are dropped once they are too old.
+ */
+class GomoryCuts : protected EnvObj
+{
+ public:
+  GomoryCuts(Env& env, const ArithVariables& vars, const Tableau& tableau);
+
+  /**
+   * Derives cuts from the rows of the tableau whose basic variable is an
+   * integer with a fractional assignment and adds them to the pool. At most
+   * max rows are used, preferring those with the most fractional assignment.
+   * Returns the number of cuts added.
+   */
+  size_t separate(size_t max);
+
+  /**
+   * Returns the lemmas of at most n cuts of the pool that are violated by the
+   * current assignment, in the order of decreasing efficacy. The returned
+   * cuts leave the pool, the others age by one round.
+   */
+  std::vector<TrustNode> getCuts(size_t n);
+
+  /** The number of cuts in the pool */
+  size_t getPoolSize() const { return d_pool.size(); }
+
+ private:
+  /** A cut sum_i d_lhs[i].second * d_lhs[i].first >= d_rhs */
+  struct Cut
+  {
+    std::vector<std::pair<Node, Rational>> d_lhs;
+    Rational d_rhs;
+    /** The lemma (and bounds) => cut */
+    Node d_lemma;
+    /** The number of rounds the cut has been in the pool */
+    uint64_t d_age;
+  };
+
+  /**
+   * Computes the MIR of the row of basic multiplied by scale. On success,
+   * stores the coefficients g_j in g and returns the efficacy of the cut at
+   * y = 0, i.e., 1 / ||g||. Returns 0 if there is no cut.
+   */
+  double mir(const std::vector<std::pair<ArithVar, Rational>>& row,
+             const Rational& beta,
+             const std::vector<bool>& integral,
+             const Rational& scale,
+             std::vector<Rational>& g) const;
+
+  /**
+   * Builds a cut from the row of basic. Returns false if the row is not
+   * eligible or if the cut is too complex.
+   */
+  bool mkCut(ArithVar basic, Cut& cut);
+
+  /**
+   * The efficacy of c at the current assignment: its violation divided by
+   * the norm of its coefficients. Returns a negative number if c is not
+   * violated, and sets stale if c refers to a term without a variable.
+   */
+  double efficacy(const Cut& c, bool& stale) const;
+
+  /** The assignment and the bounds */
+  const ArithVariables& d_vars;
+  /** The tableau of the simplex */
+  const Tableau& d_tableau;
+
+  /** The cuts that have not been emitted */
+  std::vector<Cut> d_pool;
+  /** The lemmas of the cuts in the pool and of the emitted cuts */
+  std::unordered_set<Node> d_lemmas;
+
+  class Statistics
+  {
+   public:
+    Statistics(StatisticsRegistry& sr);
+    /** Number of calls to separate() */
+    IntStat d_separations;
+    /** Number of cuts added to the pool */
+    IntStat d_generated;
+    /** Number of rows for which no cut was derived */
+    IntStat d_rejected;
+    /** Number of cuts that were emitted */
+    IntStat d_emitted;
+    /** Number of cuts dropped from the pool without being emitted */
+    IntStat d_aged;
+    /** Time spent deriving cuts */
+    TimerStat d_separationTimer;
+  };
+  Statistics d_statistics;
+};
+
+}  // namespace arith::linear
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -89,6 +89,18 @@ ArithCongruenceManager* LinearSolver::getCongruenceManager()
 {
   return d_internal.getCongruenceManager();
 }
+void LinearSolver::setObjective(TNode target, bool minimize)
+{
+  d_internal.setObjective(target, minimize);
+}
+bool LinearSolver::getObjectiveBound(Rational& value, bool& strict) const
+{
+  return d_internal.getObjectiveBound(value, strict);
+}
+bool LinearSolver::isObjectiveUnbounded() const
+{
+  return d_internal.isObjectiveUnbounded();
+}
 
 bool LinearSolver::outputTrustedLemma(TrustNode lemma, InferenceId id)
 {
@@ -107,6 +107,12 @@ class LinearSolver : protected EnvObj
 
   /** get the congruence manager, if we are using one */
   ArithCongruenceManager* getCongruenceManager();
+  /** Set the objective of the current optimization query */
+  void setObjective(TNode target, bool minimize);
+  /** Get the optimum of the objective computed by the last full check */
+  bool getObjectiveBound(Rational& value, bool& strict) const;
+  /** Whether the last full check found the objective to be unbounded */
+  bool isObjectiveUnbounded() const;
 
   //======================
   bool outputTrustedLemma(TrustNode lemma, InferenceId id);
@@ -206,6 +206,8 @@ public:
 
   uint32_t size() const{ return d_size; }
   uint32_t capacity() const{ return d_entries.capacity(); }
+  uint32_t numFreed() const{ return d_freedEntries.size(); }
+  void reserve(uint32_t n){ d_entries.reserve(n); }
 
 
 private:
@@ -384,11 +386,18 @@ protected:
   typedef std::vector< ColumnVectorT > ColumnTable;
   ColumnTable d_columns;
 
-  /* The merge buffer is used to store a row in order to optimize row addition. */
-  typedef std::pair<EntryID, bool> PosUsedPair;
+  /* The merge buffer is used to store a row in order to optimize row addition.
+   * It maps the columns of the row to their position in d_packedBuffer. */
+  typedef std::pair<uint32_t, bool> PosUsedPair;
   typedef DenseMap< PosUsedPair > RowToPosUsedPairMap;
   RowToPosUsedPairMap d_mergeBuffer;
 
+  /* The entries of the row in the merge buffer, packed in row order.
+   * Adding the buffer to a row reads the coefficients from here instead of
+   * following the links of the row through d_entries. */
+  typedef std::pair<ArithVar, T> PackedEntry;
+  std::vector<PackedEntry> d_packedBuffer;
+
   /* The row that is in the merge buffer. */
   RowIndex d_rowInMergeBuffer;
 
@@ -407,6 +416,7 @@ public:
   : d_rows(),
     d_columns(),
     d_mergeBuffer(),
+    d_packedBuffer(),
     d_rowInMergeBuffer(ROW_INDEX_SENTINEL),
     d_entriesInUse(0),
     d_entries(),
@@ -417,6 +427,7 @@ public:
   : d_rows(),
     d_columns(),
     d_mergeBuffer(),
+    d_packedBuffer(),
     d_rowInMergeBuffer(ROW_INDEX_SENTINEL),
     d_entriesInUse(0),
     d_entries(),
@@ -427,6 +438,7 @@ public:
   : d_rows(),
     d_columns(),
     d_mergeBuffer(m.d_mergeBuffer),
+    d_packedBuffer(m.d_packedBuffer),
     d_rowInMergeBuffer(m.d_rowInMergeBuffer),
     d_entriesInUse(m.d_entriesInUse),
     d_entries(m.d_entries),
@@ -446,6 +458,7 @@ public:
 
   Matrix& operator=(const Matrix& m){
     d_mergeBuffer = (m.d_mergeBuffer);
+    d_packedBuffer = (m.d_packedBuffer);
     d_rowInMergeBuffer = (m.d_rowInMergeBuffer);
     d_entriesInUse = (m.d_entriesInUse);
     d_entries = (m.d_entries);
@@ -591,12 +604,14 @@ public:
     Assert(d_mergeBuffer.empty());
     Assert(d_rowInMergeBuffer == ROW_INDEX_SENTINEL);
 
+    Assert(d_packedBuffer.empty());
+
     RowIterator i = getRow(rid).begin(), i_end = getRow(rid).end();
     for(; i != i_end; ++i){
-      EntryID id = i.getID();
       const MatrixEntry<T>& entry = *i;
       ArithVar colVar = entry.getColVar();
-      d_mergeBuffer.set(colVar, std::make_pair(id, false));
+      d_mergeBuffer.set(colVar, std::make_pair(d_packedBuffer.size(), false));
+      d_packedBuffer.emplace_back(colVar, entry.getCoefficient());
     }
 
     d_rowInMergeBuffer = rid;
@@ -607,6 +622,7 @@ public:
 
     d_rowInMergeBuffer = ROW_INDEX_SENTINEL;
     d_mergeBuffer.purge();
+    d_packedBuffer.clear();
   }
 
   /* to *= mult */
@@ -659,13 +675,13 @@ public:
       ++i;
 
       if(d_mergeBuffer.isKey(colVar)){
-        EntryID bufferEntry = d_mergeBuffer[colVar].first;
-        Assert(!d_mergeBuffer[colVar].second);
-        d_mergeBuffer.get(colVar).second = true;
+        PosUsedPair& pos = d_mergeBuffer.get(colVar);
+        Assert(!pos.second);
+        pos.second = true;
 
-        const Entry& other = d_entries.get(bufferEntry);
+        const T& other = d_packedBuffer[pos.first].second;
         T& coeff = entry.getCoefficient();
-        coeff += mult * other.getCoefficient();
+        coeff += mult * other;
 
         if(coeff.sgn() == 0){
           removeEntry(id);
@@ -673,19 +689,12 @@ public:
       }
     }
 
-    i = getRow(d_rowInMergeBuffer).begin();
-    i_end = getRow(d_rowInMergeBuffer).end();
-
-    for(; i != i_end; ++i){
-      const Entry& entry = *i;
-      ArithVar colVar = entry.getColVar();
-
-      if(d_mergeBuffer[colVar].second){
-        d_mergeBuffer.get(colVar).second = false;
+    for(const PackedEntry& p : d_packedBuffer){
+      PosUsedPair& pos = d_mergeBuffer.get(p.first);
+      if(pos.second){
+        pos.second = false;
       }else{
-        Assert(!(d_mergeBuffer[colVar]).second);
-        T newCoeff =  mult * entry.getCoefficient();
-        addEntry(to, colVar, newCoeff);
+        addEntry(to, p.first, mult * p.second);
       }
     }
 
@@ -718,14 +727,14 @@ public:
       ++i;
 
       if(d_mergeBuffer.isKey(colVar)){
-        EntryID bufferEntry = d_mergeBuffer[colVar].first;
-        Assert(!d_mergeBuffer[colVar].second);
-        d_mergeBuffer.get(colVar).second = true;
+        PosUsedPair& pos = d_mergeBuffer.get(colVar);
+        Assert(!pos.second);
+        pos.second = true;
 
-        const Entry& other = d_entries.get(bufferEntry);
+        const T& other = d_packedBuffer[pos.first].second;
         T& coeff = entry.getCoefficient();
         int coeffOldSgn = coeff.sgn();
-        coeff += mult * other.getCoefficient();
+        coeff += mult * other;
         int coeffNewSgn = coeff.sgn();
 
         if(coeffOldSgn != coeffNewSgn){
@@ -738,21 +747,16 @@ public:
       }
     }
 
-    i = getRow(d_rowInMergeBuffer).begin();
-    i_end = getRow(d_rowInMergeBuffer).end();
-
-    for(; i != i_end; ++i){
-      const Entry& entry = *i;
-      ArithVar colVar = entry.getColVar();
-
-      if(d_mergeBuffer[colVar].second){
-        d_mergeBuffer.get(colVar).second = false;
+    for(const PackedEntry& p : d_packedBuffer){
+      PosUsedPair& pos = d_mergeBuffer.get(p.first);
+      if(pos.second){
+        pos.second = false;
       }else{
-        Assert(!(d_mergeBuffer[colVar]).second);
-        T newCoeff =  mult * entry.getCoefficient();
-        addEntry(to, colVar, newCoeff);
+        T newCoeff = mult * p.second;
+        int newSgn = newCoeff.sgn();
+        addEntry(to, p.first, newCoeff);
 
-        cb.update(to, colVar, 0,  newCoeff.sgn());
+        cb.update(to, p.first, 0, newSgn);
       }
     }
 
@@ -867,6 +871,45 @@ public:
     return d_entries.capacity();
   }
 
+  /**
+   * Moves the entries so that the entries of each row are consecutive in
+   * memory, in row order, and drops the freed entries. Row and column
+   * iteration orders are unchanged, but all EntryIDs are invalidated.
+   * This may not be called while a row is in the merge buffer.
+   */
+  void compactEntries(){
+    Assert(d_rowInMergeBuffer == ROW_INDEX_SENTINEL);
+
+    std::vector<EntryID> newIds(d_entries.size() + d_entries.numFreed(),
+                                ENTRYID_SENTINEL);
+    MatrixEntryVector<T> packed;
+    packed.reserve(d_entriesInUse);
+    for(const RowVectorT& row : d_rows){
+      for(RowIterator i = row.begin(), i_end = row.end(); i != i_end; ++i){
+        EntryID newId = packed.newEntry();
+        newIds[i.getID()] = newId;
+        packed.get(newId) = std::move(d_entries.get(i.getID()));
+      }
+    }
+    auto remap = [&newIds](EntryID id) {
+      return id == ENTRYID_SENTINEL ? id : newIds[id];
+    };
+    for(EntryID id = 0, N = packed.size(); id < N; ++id){
+      Entry& entry = packed.get(id);
+      entry.setNextRowEntryID(remap(entry.getNextRowEntryID()));
+      entry.setPrevRowEntryID(remap(entry.getPrevRowEntryID()));
+      entry.setNextColEntryID(remap(entry.getNextColEntryID()));
+      entry.setPrevColEntryID(remap(entry.getPrevColEntryID()));
+    }
+    d_entries = std::move(packed);
+    for(RowVectorT& row : d_rows){
+      row = RowVectorT(remap(row.getHead()), row.getSize(), &d_entries);
+    }
+    for(ColumnVectorT& col : d_columns){
+      col = ColumnVectorT(remap(col.getHead()), col.getSize(), &d_entries);
+    }
+  }
+
   void manipulateRowEntry(RowIndex row, ArithVar col, const T& c, CoefficientChangeCallback& cb){
     int coeffOldSgn;
     int coeffNewSgn;
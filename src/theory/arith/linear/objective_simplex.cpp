@@ -0,0 +1,220 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A primal simplex procedure for optimizing an objective over the tableau.
+ */
+#include "theory/arith/linear/objective_simplex.h"
+
+#include "base/output.h"
+#include "theory/arith/linear/constraint.h"
+#include "theory/arith/linear/error_set.h"
+#include "theory/arith/linear/linear_equality.h"
+#include "theory/arith/linear/tableau.h"
+#include "util/statistics_registry.h"
+
+using namespace std;
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+ObjectiveSimplex::ObjectiveSimplex(Env& env,
+                                   LinearEqualityModule& linEq,
+                                   ErrorSet& errors,
+                                   RaiseConflict conflictChannel,
+                                   TempVarMalloc tvmalloc)
+    : SimplexDecisionProcedure(env, linEq, errors, conflictChannel, tvmalloc),
+      d_statistics(statisticsRegistry())
+{
+}
+
+ObjectiveSimplex::Statistics::Statistics(StatisticsRegistry& sr)
+    : d_optimizeTime(sr.registerTimer("theory::arith::objective::time")),
+      d_optimizePivots(sr.registerInt("theory::arith::objective::pivots")),
+      d_optimizeUpdates(sr.registerInt("theory::arith::objective::updates")),
+      d_optimal(sr.registerInt("theory::arith::objective::optimal")),
+      d_unbounded(sr.registerInt("theory::arith::objective::unbounded")),
+      d_interrupted(sr.registerInt("theory::arith::objective::interrupted"))
+{
+}
+
+ObjectiveSimplex::Status ObjectiveSimplex::optimize(ArithVar obj,
+                                                    bool minimize,
+                                                    int64_t pivotLimit)
+{
+  TimerStat::CodeTimer codeTimer(d_statistics.d_optimizeTime);
+  Trace("arith::objective") << "optimize " << obj << " "
+                            << (minimize ? "min" : "max") << " from "
+                            << d_variables.getAssignment(obj) << endl;
+  d_pivots = 0;
+  d_explanation.clear();
+  // the direction in which the objective improves
+  int dir = minimize ? -1 : 1;
+  while (true)
+  {
+    if (pivotLimit >= 0 && d_pivots >= pivotLimit)
+    {
+      Trace("arith::objective") << "interrupted at "
+                                << d_variables.getAssignment(obj) << endl;
+      ++d_statistics.d_interrupted;
+      return Status::INTERRUPTED;
+    }
+    ArithVar entering;
+    int enteringDir;
+    if (d_tableau.isBasic(obj))
+    {
+      entering = selectEntering(obj, dir, enteringDir);
+    }
+    else
+    {
+      entering = canMove(obj, dir) ? obj : ARITHVAR_SENTINEL;
+      enteringDir = dir;
+    }
+    if (entering == ARITHVAR_SENTINEL)
+    {
+      return finishOptimal(obj, minimize);
+    }
+
+    DeltaRational value;
+    ArithVar leaving = ratioTest(entering, enteringDir, value);
+    if (leaving == ARITHVAR_SENTINEL)
+    {
+      Trace("arith::objective") << "unbounded along " << entering << endl;
+      ++d_statistics.d_unbounded;
+      return Status::UNBOUNDED;
+    }
+    if (leaving == entering)
+    {
+      // the entering variable reaches its own bound before any basic variable
+      // does, hence no pivot is required
+      d_linEq.update(entering, value);
+      ++d_statistics.d_optimizeUpdates;
+    }
+    else
+    {
+      d_linEq.pivotAndUpdate(leaving, entering, value);
+      ++d_pivots;
+      ++d_statistics.d_optimizePivots;
+    }
+    Assert(d_variables.assignmentIsConsistent(entering));
+    Assert(leaving == entering || d_variables.assignmentIsConsistent(leaving));
+  }
+}
+
+bool ObjectiveSimplex::canMove(ArithVar x, int dir) const
+{
+  return dir > 0 ? d_variables.strictlyBelowUpperBound(x)
+                 : d_variables.strictlyAboveLowerBound(x);
+}
+
+ArithVar ObjectiveSimplex::selectEntering(ArithVar obj,
+                                          int dir,
+                                          int& enteringDir) const
+{
+  ArithVar entering = ARITHVAR_SENTINEL;
+  for (Tableau::RowIterator iter = d_tableau.basicRowIterator(obj);
+       !iter.atEnd();
+       ++iter)
+  {
+    const Tableau::Entry& entry = *iter;
+    ArithVar x = entry.getColVar();
+    if (x == obj || (entering != ARITHVAR_SENTINEL && x > entering))
+    {
+      continue;
+    }
+    // obj improves if x moves in the direction of the sign of its coefficient
+    int xDir = entry.getCoefficient().sgn() * dir;
+    if (canMove(x, xDir))
+    {
+      entering = x;
+      enteringDir = xDir;
+    }
+  }
+  return entering;
+}
+
+ArithVar ObjectiveSimplex::ratioTest(ArithVar x,
+                                     int dir,
+                                     DeltaRational& value) const
+{
+  Assert(!d_tableau.isBasic(x));
+  ArithVar leaving = ARITHVAR_SENTINEL;
+  DeltaRational minAmount;
+  // the bound of x itself
+  if (dir > 0 ? d_variables.hasUpperBound(x) : d_variables.hasLowerBound(x))
+  {
+    value = dir > 0 ? d_variables.getUpperBound(x)
+                    : d_variables.getLowerBound(x);
+    minAmount = (value - d_variables.getAssignment(x)).abs();
+    leaving = x;
+  }
+  // the bounds of the basic variables in the column of x
+  Tableau::ColIterator colIter = d_tableau.colIterator(x);
+  for (; !colIter.atEnd(); ++colIter)
+  {
+    const Tableau::Entry& entry = *colIter;
+    Assert(entry.getColVar() == x);
+    ArithVar b = d_tableau.rowIndexToBasic(entry.getRowIndex());
+    const Rational& a_bx = entry.getCoefficient();
+    int bDir = a_bx.sgn() * dir;
+    if (bDir > 0 ? !d_variables.hasUpperBound(b)
+                 : !d_variables.hasLowerBound(b))
+    {
+      continue;
+    }
+    const DeltaRational& bound = bDir > 0 ? d_variables.getUpperBound(b)
+                                          : d_variables.getLowerBound(b);
+    DeltaRational amount =
+        (bound - d_variables.getAssignment(b)).abs() / a_bx.abs();
+    int cmp = leaving == ARITHVAR_SENTINEL ? -1 : amount.cmp(minAmount);
+    if (cmp < 0 || (cmp == 0 && b < leaving))
+    {
+      leaving = b;
+      minAmount = amount;
+      value = bound;
+    }
+  }
+  return leaving;
+}
+
+ObjectiveSimplex::Status ObjectiveSimplex::finishOptimal(ArithVar obj,
+                                                         bool minimize)
+{
+  int dir = minimize ? -1 : 1;
+  d_optimum = d_variables.getAssignment(obj);
+  if (d_tableau.isBasic(obj))
+  {
+    // Every non-basic variable in the row of obj is at the bound that
+    // prevents obj from improving. These bounds imply the optimum.
+    for (Tableau::RowIterator iter = d_tableau.basicRowIterator(obj);
+         !iter.atEnd();
+         ++iter)
+    {
+      const Tableau::Entry& entry = *iter;
+      ArithVar x = entry.getColVar();
+      if (x == obj)
+      {
+        continue;
+      }
+      int xDir = entry.getCoefficient().sgn() * dir;
+      ConstraintP c = xDir > 0 ? d_variables.getUpperBoundConstraint(x)
+                               : d_variables.getLowerBoundConstraint(x);
+      Assert(c != NullConstraint);
+      d_explanation.push_back(c);
+    }
+  }
+  Trace("arith::objective") << "optimal " << obj << " = " << d_optimum
+                            << " after " << d_pivots << " pivots" << endl;
+  ++d_statistics.d_optimal;
+  return Status::OPTIMAL;
+}
+
+}  // namespace arith::linear
+}  // namespace theory
+}  // namespace cvc5::internal
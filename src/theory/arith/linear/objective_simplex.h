@@ -0,0 +1,136 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A primal simplex procedure for optimizing an objective over the tableau.
+ *
+ * Unlike the other simplex procedures, this procedure starts from an
+ * assignment that is consistent with all bounds and keeps it consistent. It
+ * moves the assignment towards the optimum of a single variable, the
+ * objective, by pivoting on the tableau that was already computed by the
+ * search for a feasible assignment.
+ *
+ * The entering and leaving variables are selected using Bland's rule, which
+ * guarantees termination in the presence of degenerate pivots.
+ *
+ * If an optimum is found and the objective is basic, its row
+ *   x_o = sum_j a_j x_j
+ * has every non-basic x_j at the bound that prevents x_o from improving.
+ * These bounds imply the optimal value of x_o, which can be turned into a
+ * lemma by the caller.
+ */
+
+#include "cvc5_private.h"
+
+#pragma once
+
+#include "theory/arith/delta_rational.h"
+#include "theory/arith/linear/constraint_forward.h"
+#include "theory/arith/linear/simplex.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+class ObjectiveSimplex : public SimplexDecisionProcedure
+{
+ public:
+  /** The result of optimizing an objective. */
+  enum class Status
+  {
+    /** The objective has reached its optimal value. */
+    OPTIMAL,
+    /** The objective can be improved without bound. */
+    UNBOUNDED,
+    /** The pivot limit was reached before the optimum was found. */
+    INTERRUPTED
+  };
+
+  ObjectiveSimplex(Env& env,
+                   LinearEqualityModule& linEq,
+                   ErrorSet& errors,
+                   RaiseConflict conflictChannel,
+                   TempVarMalloc tvmalloc);
+
+  /**
+   * Minimize (if minimize is true) or maximize the variable obj, starting
+   * from the current assignment, which must be consistent with all bounds.
+   * The assignment remains consistent with all bounds.
+   *
+   * @param obj The objective variable.
+   * @param minimize Whether to minimize or maximize obj.
+   * @param pivotLimit The maximal number of pivots, or -1 if unlimited.
+   * @return The status of the objective.
+   */
+  Status optimize(ArithVar obj, bool minimize, int64_t pivotLimit);
+
+  /**
+   * Get the bound constraints proving the optimum found by the last call to
+   * optimize, which returned OPTIMAL. This is empty if the objective is at
+   * one of its own bounds, in which case the optimum is already asserted.
+   */
+  const ConstraintCPVec& getExplanation() const { return d_explanation; }
+
+  /** Get the optimal value found by the last call to optimize */
+  const DeltaRational& getOptimum() const { return d_optimum; }
+
+  Result::Status findModel(bool exactResult) override { Unreachable(); }
+
+ private:
+  /**
+   * Returns true if the non-basic variable x can be moved in the direction
+   * dir (which is 1 for increasing and -1 for decreasing) without violating
+   * its bound.
+   */
+  bool canMove(ArithVar x, int dir) const;
+  /**
+   * Selects the non-basic variable that enters the basis to improve the
+   * basic objective obj, which improves in direction dir. Returns
+   * ARITHVAR_SENTINEL if no variable in the row of obj can improve it, in
+   * which case obj is optimal. Stores the direction of the entering
+   * variable in enteringDir.
+   */
+  ArithVar selectEntering(ArithVar obj, int dir, int& enteringDir) const;
+  /**
+   * Performs the ratio test for moving the non-basic variable x in direction
+   * dir. Returns the variable whose bound is hit first, which is x itself if
+   * its own bound is hit first, or ARITHVAR_SENTINEL if no bound is ever hit.
+   * Ties are broken towards the smallest variable. Stores the new value of
+   * the returned variable in value.
+   */
+  ArithVar ratioTest(ArithVar x, int dir, DeltaRational& value) const;
+  /**
+   * Computes the explanation and the optimum for the objective obj, which is
+   * optimal. Returns the status.
+   */
+  Status finishOptimal(ArithVar obj, bool minimize);
+
+  /** The explanation of the last optimum */
+  ConstraintCPVec d_explanation;
+  /** The last optimum */
+  DeltaRational d_optimum;
+
+  /** These fields are designed to be accessible to TheoryArith methods. */
+  class Statistics
+  {
+   public:
+    TimerStat d_optimizeTime;
+    IntStat d_optimizePivots;
+    IntStat d_optimizeUpdates;
+    IntStat d_optimal;
+    IntStat d_unbounded;
+    IntStat d_interrupted;
+
+    Statistics(StatisticsRegistry& sr);
+  } d_statistics;
+}; /* class ObjectiveSimplex */
+
+}  // namespace arith::linear
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -39,24 +39,33 @@ void Tableau::pivot(ArithVar oldBasic, ArithVar newBasic, CoefficientChangeCallb
 
   loadRowIntoBuffer(ridx);
 
-  ColIterator colIter = colIterator(newBasic);
-  while(!colIter.atEnd()){
-    EntryID id = colIter.getID();
-    Entry& entry = d_entries.get(id);
-
-    ++colIter; //needs to be incremented before the variable is removed
-    if(entry.getRowIndex() == ridx){ continue; }
+  // Collect the rows to update before updating any of them, so that the
+  // column is walked once instead of interleaving with the row additions.
+  Assert(d_pivotUpdates.empty());
+  for(ColIterator colIter = colIterator(newBasic); !colIter.atEnd(); ++colIter){
+    const Entry& entry = *colIter;
+    if(entry.getRowIndex() != ridx){
+      d_pivotUpdates.emplace_back(entry.getRowIndex(), entry.getCoefficient());
+    }
+  }
 
-    RowIndex to = entry.getRowIndex();
-    Rational coeff = entry.getCoefficient();
+  for(const std::pair<RowIndex, Rational>& update : d_pivotUpdates){
+    RowIndex to = update.first;
     if(cb.canUseRow(to)){
-      rowPlusBufferTimesConstant(to, coeff, cb);
+      rowPlusBufferTimesConstant(to, update.second, cb);
     }else{
-      rowPlusBufferTimesConstant(to, coeff);
+      rowPlusBufferTimesConstant(to, update.second);
     }
   }
+  d_pivotUpdates.clear();
   clearBuffer();
 
+  if (d_compactPeriod > 0 && ++d_pivotsSinceCompact >= d_compactPeriod)
+  {
+    d_pivotsSinceCompact = 0;
+    compactEntries();
+  }
+
   //Clear the column for used for this variable
 
   Assert(d_mergeBuffer.empty());
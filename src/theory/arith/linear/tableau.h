@@ -51,7 +51,12 @@ private:
 
 public:
 
-  Tableau() : Matrix<Rational>(Rational(0)) {}
+  Tableau()
+      : Matrix<Rational>(Rational(0)),
+        d_compactPeriod(0),
+        d_pivotsSinceCompact(0)
+  {
+  }
 
   typedef Matrix<Rational>::ColIterator ColIterator;
   typedef Matrix<Rational>::RowIterator RowIterator;
@@ -152,10 +157,24 @@ public:
 
   void printBasicRow(ArithVar basic, std::ostream& out);
 
+  /**
+   * Sets the number of pivots after which the entries are compacted into
+   * row-major order, see Matrix::compactEntries(). 0 disables compaction.
+   */
+  void setCompactPeriod(uint64_t period) { d_compactPeriod = period; }
+
 private:
   /* Changes the basic variable on the row for basicOld to basicNew. */
   void rowPivot(ArithVar basicOld, ArithVar basicNew, CoefficientChangeCallback& cb);
 
+  /* The rows updated by the current pivot with the multipliers. */
+  std::vector<std::pair<RowIndex, Rational>> d_pivotUpdates;
+
+  /* The number of pivots between two compactions, or 0. */
+  uint64_t d_compactPeriod;
+  /* The number of pivots since the last compaction. */
+  uint64_t d_pivotsSinceCompact;
+
 };/* class Tableau */
 
 }  // namespace arith
@@ -129,6 +129,7 @@ TheoryArithPrivate::TheoryArithPrivate(Env& env,
               d_rowTracking,
               BasicVarModelUpdateCallBack(*this)),
       d_diosolver(env),
+      d_gomoryCuts(env, d_partialModel, d_tableau),
       d_restartsCounter(0),
       d_tableauSizeHasBeenModified(false),
       d_tableauResetDensity(1.6),
@@ -151,6 +152,12 @@ TheoryArithPrivate::TheoryArithPrivate(Env& env,
           env, d_linEq, d_errorSet, RaiseConflict(*this), TempVarMalloc(*this)),
       d_attemptSolSimplex(
           env, d_linEq, d_errorSet, RaiseConflict(*this), TempVarMalloc(*this)),
+      d_objectiveSimplex(
+          env, d_linEq, d_errorSet, RaiseConflict(*this), TempVarMalloc(*this)),
+      d_objectiveMinimize(true),
+      d_hasObjectiveBound(false),
+      d_objectiveBoundStrict(false),
+      d_objectiveUnbounded(false),
       d_pass1SDP(NULL),
       d_otherSDP(NULL),
       d_lastContextIntegerAttempted(context(), -1),
@@ -176,6 +183,7 @@ TheoryArithPrivate::TheoryArithPrivate(Env& env,
       d_previousStatus(Result::UNKNOWN),
       d_statistics(statisticsRegistry(), "theory::arith::")
 {
+  d_tableau.setCompactPeriod(options().arith.arithTableauCompactPeriod);
 }
 
 TheoryArithPrivate::~TheoryArithPrivate(){
@@ -267,6 +275,8 @@ TheoryArithPrivate::Statistics::Statistics(StatisticsRegistry& reg,
       d_boundComputationTime(reg.registerTimer(name + "bound::time")),
       d_boundComputations(reg.registerInt(name + "bound::boundComputations")),
       d_boundPropagations(reg.registerInt(name + "bound::boundPropagations")),
+      d_objectivePropagations(
+          reg.registerInt(name + "objective::propagations")),
       d_unknownChecks(reg.registerInt(name + "status::unknowns")),
       d_maxUnknownsInARow(reg.registerInt(name + "status::maxUnknownsInARow")),
       d_avgUnknownsInARow(
@@ -2962,13 +2972,14 @@ bool TheoryArithPrivate::solveRealRelaxation(Theory::Effort effortLevel){
 
   SimplexDecisionProcedure& simplex = selectSimplex(true);
 
-  bool useApprox = options().arith.useApprox && ApproximateSimplex::enabled()
+  bool useApprox = options().arith.useApprox
+                   && ApproximateSimplex::relaxationEnabled()
                    && getSolveIntegerResource();
 
   Trace("TheoryArithPrivate::solveRealRelaxation")
       << "solveRealRelaxation() approx"
       << " " << options().arith.useApprox << " "
-      << ApproximateSimplex::enabled() << " " << useApprox << " "
+      << ApproximateSimplex::relaxationEnabled() << " " << useApprox << " "
       << safeToCallApprox() << endl;
 
   bool noPivotLimitPass1 = noPivotLimit && !useApprox;
@@ -2981,7 +2992,7 @@ bool TheoryArithPrivate::solveRealRelaxation(Theory::Effort effortLevel){
   {
     // pass2: fancy-final
     static constexpr int32_t relaxationLimit = 10000;
-    Assert(ApproximateSimplex::enabled());
+    Assert(ApproximateSimplex::relaxationEnabled());
 
     TreeLog& tl = getTreeLog();
     ApproximateStatistics& stats = getApproxStats();
@@ -3378,6 +3389,24 @@ bool TheoryArithPrivate::postCheck(Theory::Effort effortLevel)
   if(!emmittedConflictOrSplit && Theory::fullEffort(effortLevel)){
     ++d_fullCheckCounter;
   }
+  if (!emmittedConflictOrSplit && Theory::fullEffort(effortLevel))
+  {
+    d_hasObjectiveBound = false;
+    d_objectiveUnbounded = false;
+    if (!d_objective.isNull() && options().arith.arithObjective)
+    {
+      // The lemmas sent here are handled as splits, i.e., the passes below
+      // are skipped in this check.
+      if (options().arith.arithObjectiveProp)
+      {
+        emmittedConflictOrSplit = propagateObjectiveBounds();
+      }
+      if (optimizeObjective())
+      {
+        emmittedConflictOrSplit = true;
+      }
+    }
+  }
   if(!emmittedConflictOrSplit && Theory::fullEffort(effortLevel)){
     emmittedConflictOrSplit = splitDisequalities();
   }
@@ -3438,6 +3467,28 @@ bool TheoryArithPrivate::postCheck(Theory::Effort effortLevel)
       }
     }
 
+    // The cuts do not replace branching, which guarantees progress when the
+    // cuts stall.
+    bool emittedGomoryCuts = false;
+    if (!emmittedConflictOrSplit && options().arith.gomoryCuts)
+    {
+      size_t perRound = options().arith.gomoryCutsPerRound;
+      d_gomoryCuts.separate(2 * perRound);
+      std::vector<TrustNode> cuts = d_gomoryCuts.getCuts(perRound);
+      if (!cuts.empty())
+      {
+        d_cutCount = d_cutCount + 1;
+      }
+      for (const TrustNode& cut : cuts)
+      {
+        Trace("arith::lemma") << "gomory cut " << cut << endl;
+        if (outputTrustedLemma(cut, InferenceId::ARITH_GOMORY_CUT))
+        {
+          emittedGomoryCuts = true;
+        }
+      }
+    }
+
     if(!emmittedConflictOrSplit) {
       std::vector<TrustNode> possibleLemmas = roundRobinBranch();
       if (!possibleLemmas.empty())
@@ -3454,6 +3505,7 @@ bool TheoryArithPrivate::postCheck(Theory::Effort effortLevel)
         }
       }
     }
+    emmittedConflictOrSplit = emmittedConflictOrSplit || emittedGomoryCuts;
 
     if (options().arith.maxCutsInContext <= d_cutCount)
     {
@@ -3562,6 +3614,279 @@ std::vector<TrustNode> TheoryArithPrivate::roundRobinBranch()
   }
 }
 
+void TheoryArithPrivate::setObjective(TNode target, bool minimize)
+{
+  Trace("arith::objective") << "set objective " << target << " "
+                            << (minimize ? "min" : "max") << endl;
+  d_objective = target;
+  d_objectiveMinimize = minimize;
+  d_hasObjectiveBound = false;
+  d_objectiveUnbounded = false;
+}
+
+bool TheoryArithPrivate::getObjectiveBound(Rational& value,
+                                           bool& strict) const
+{
+  if (!d_hasObjectiveBound)
+  {
+    return false;
+  }
+  value = d_objectiveBound;
+  strict = d_objectiveBoundStrict;
+  return true;
+}
+
+bool TheoryArithPrivate::getObjectiveVariable(ArithVar& v,
+                                              Node& nvp,
+                                              Rational& scale,
+                                              Rational& offset)
+{
+  Assert(!d_objective.isNull());
+  Node target = rewrite(d_objective);
+  if (!Polynomial::isMember(target))
+  {
+    return false;
+  }
+  Polynomial p = Polynomial::parsePolynomial(target);
+  if (p.isConstant())
+  {
+    return false;
+  }
+  // The objective is (+ offset vp), and vp is a multiple of the polynomial
+  // nvp that the tableau uses for bounds on vp.
+  NodeManager* nm = nodeManager();
+  offset = Rational(0);
+  Polynomial vp = p;
+  if (p.containsConstant())
+  {
+    offset = p.getHead().getConstant().getValue();
+    vp = p.getTail();
+  }
+  Comparison cmp = Comparison::mkComparison(
+      nm, Kind::GEQ, vp, Polynomial::mkZero(nm));
+  Polynomial pnvp = cmp.normalizedVariablePart();
+  nvp = pnvp.getNode();
+  if (!d_partialModel.hasArithVar(nvp))
+  {
+    // no bound on the objective was registered yet
+    return false;
+  }
+  v = d_partialModel.asArithVar(nvp);
+  scale = vp.getHead().getConstant().getValue()
+          / pnvp.getHead().getConstant().getValue();
+  return true;
+}
+
+bool TheoryArithPrivate::optimizeObjective()
+{
+  Assert(d_qflraStatus == Result::SAT);
+  ArithVar v;
+  Node nvp;
+  Rational scale, offset;
+  if (!getObjectiveVariable(v, nvp, scale, offset))
+  {
+    return false;
+  }
+  NodeManager* nm = nodeManager();
+  bool minimize = (d_objectiveMinimize == (scale.sgn() > 0));
+
+  bool wasIntegral = hasIntegerModel();
+  d_partialModel.stopQueueingBoundCounts();
+  UpdateTrackingCallback utcb(&d_linEq);
+  d_partialModel.processBoundsQueue(utcb);
+  d_linEq.startTrackingBoundCounts();
+  ObjectiveSimplex::Status status = d_objectiveSimplex.optimize(
+      v, minimize, options().arith.arithObjectivePivots);
+  d_linEq.stopTrackingBoundCounts();
+  d_partialModel.startQueueingBoundCounts();
+  for (uint32_t i = 0, npivots = d_objectiveSimplex.getPivots(); i < npivots;
+       ++i)
+  {
+    d_containing.spendResource(Resource::ArithPivotStep);
+  }
+
+  // Optimizing the relaxation may have made integer variables fractional, in
+  // which case we prefer the integer model we had. The lemma below is valid
+  // regardless.
+  bool keep = !wasIntegral || hasIntegerModel();
+  if (keep)
+  {
+    d_partialModel.commitAssignmentChanges();
+  }
+  else
+  {
+    d_partialModel.revertAssignmentChanges();
+  }
+  if (status == ObjectiveSimplex::Status::UNBOUNDED)
+  {
+    // The ray found by the simplex satisfies the bounds of this branch, hence
+    // the caller must not search for improvements one model at a time.
+    d_objectiveUnbounded = true;
+    Trace("arith::objective") << "objective is unbounded" << endl;
+    return false;
+  }
+  if (status != ObjectiveSimplex::Status::OPTIMAL)
+  {
+    return false;
+  }
+
+  const DeltaRational& opt = d_objectiveSimplex.getOptimum();
+  bool strict = (opt.infinitesimalSgn() != 0);
+  if (keep)
+  {
+    // the optimum is attained by the current assignment
+    d_hasObjectiveBound = true;
+    d_objectiveBound = opt.getNoninfinitesimalPart() * scale + offset;
+    d_objectiveBoundStrict = strict;
+    Trace("arith::objective") << "objective bound " << d_objectiveBound
+                              << (strict ? " (strict)" : "") << endl;
+  }
+
+  const ConstraintCPVec& exp = d_objectiveSimplex.getExplanation();
+  if (exp.empty())
+  {
+    // the optimum is a bound on the objective that is already asserted
+    return false;
+  }
+  Kind k;
+  if (minimize)
+  {
+    k = strict ? Kind::GT : Kind::GEQ;
+  }
+  else
+  {
+    k = strict ? Kind::LT : Kind::LEQ;
+  }
+  Polynomial c = Polynomial::mkPolynomial(
+      Constant::mkConstant(nm, opt.getNoninfinitesimalPart()));
+  Node bound =
+      Comparison::mkComparison(nm, k, Polynomial::parsePolynomial(nvp), c)
+          .getNode();
+  Node lemma = nm->mkNode(
+      Kind::IMPLIES, Constraint::externalExplainByAssertions(nm, exp), bound);
+  Trace("arith::lemma") << "objective bound lemma " << lemma << endl;
+  return outputLemma(lemma, InferenceId::ARITH_OBJECTIVE_BOUND);
+}
+
+bool TheoryArithPrivate::propagateObjectiveBounds()
+{
+  ArithVar v;
+  Node nvp;
+  Rational scale, offset;
+  if (!getObjectiveVariable(v, nvp, scale, offset)
+      || nvp.getKind() != Kind::ADD)
+  {
+    return false;
+  }
+  // The bound on v in the direction in which the objective improves is the
+  // bound that the optimization solver asserts for the incumbent, i.e. an
+  // upper bound if v is minimized.
+  bool up = (d_objectiveMinimize == (scale.sgn() > 0));
+  if (up ? !d_partialModel.hasUpperBound(v) : !d_partialModel.hasLowerBound(v))
+  {
+    return false;
+  }
+  ConstraintP vc = up ? d_partialModel.getUpperBoundConstraint(v)
+                      : d_partialModel.getLowerBoundConstraint(v);
+  const DeltaRational& vb = up ? d_partialModel.getUpperBound(v)
+                               : d_partialModel.getLowerBound(v);
+  std::vector<Rational> coeffs;
+  std::vector<ArithVar> vars;
+  asVectors(Polynomial::parsePolynomial(nvp), coeffs, vars);
+  // v = sum_j c_j x_j, hence, if v is bounded above by vb, each summand
+  // c_i x_i is bounded above by vb minus the least values of the other
+  // summands, which are given by their bounds. The dual holds if v is bounded
+  // below. We compute the sum of these extreme values, where at most one
+  // summand may be unbounded, in which case only it can be bounded.
+  DeltaRational rest;
+  size_t unbounded = vars.size();
+  std::vector<ConstraintP> bounds(vars.size(), NullConstraint);
+  for (size_t j = 0, nvars = vars.size(); j < nvars; j++)
+  {
+    bool lower = (coeffs[j].sgn() > 0) == up;
+    if (lower ? !d_partialModel.hasLowerBound(vars[j])
+              : !d_partialModel.hasUpperBound(vars[j]))
+    {
+      if (unbounded < nvars)
+      {
+        return false;
+      }
+      unbounded = j;
+      continue;
+    }
+    bounds[j] = lower ? d_partialModel.getLowerBoundConstraint(vars[j])
+                      : d_partialModel.getUpperBoundConstraint(vars[j]);
+    rest = rest
+           + (lower ? d_partialModel.getLowerBound(vars[j])
+                    : d_partialModel.getUpperBound(vars[j]))
+                 * coeffs[j];
+  }
+  NodeManager* nm = nodeManager();
+  bool sentLemma = false;
+  for (size_t i = 0, nvars = vars.size(); i < nvars; i++)
+  {
+    if (unbounded < nvars && unbounded != i)
+    {
+      continue;
+    }
+    ArithVar x = vars[i];
+    DeltaRational others = bounds[i] == NullConstraint
+                               ? rest
+                               : rest - bounds[i]->getValue() * coeffs[i];
+    DeltaRational value = (vb - others) / coeffs[i];
+    // whether value is an upper bound on x
+    bool xUp = (coeffs[i].sgn() > 0) == up;
+    if (xUp ? (d_partialModel.hasUpperBound(x)
+               && d_partialModel.getUpperBound(x) <= value)
+            : (d_partialModel.hasLowerBound(x)
+               && d_partialModel.getLowerBound(x) >= value))
+    {
+      // the bound on x is already at least as tight
+      continue;
+    }
+    Node xn = d_partialModel.asNode(x);
+    const Rational& c = value.getNoninfinitesimalPart();
+    bool strict = xUp ? value.infinitesimalSgn() < 0
+                      : value.infinitesimalSgn() > 0;
+    Node bound;
+    if (xn.getType().isInteger())
+    {
+      // round to the tightest integer bound
+      Integer ic = xUp ? c.floor() : c.ceiling();
+      if (strict && c.isIntegral())
+      {
+        ic = xUp ? ic - 1 : ic + 1;
+      }
+      bound = nm->mkNode(xUp ? Kind::LEQ : Kind::GEQ, xn, nm->mkConstInt(ic));
+    }
+    else
+    {
+      Kind k = xUp ? (strict ? Kind::LT : Kind::LEQ)
+                   : (strict ? Kind::GT : Kind::GEQ);
+      bound = nm->mkNode(k, xn, nm->mkConstReal(c));
+    }
+    ConstraintCPVec exp;
+    exp.push_back(vc);
+    for (size_t j = 0; j < nvars; j++)
+    {
+      if (j != i)
+      {
+        exp.push_back(bounds[j]);
+      }
+    }
+    Node lemma = nm->mkNode(
+        Kind::IMPLIES, Constraint::externalExplainByAssertions(nm, exp), bound);
+    Trace("arith::objective") << "objective propagation lemma " << lemma
+                              << endl;
+    if (outputLemma(lemma, InferenceId::ARITH_OBJECTIVE_PROP))
+    {
+      ++d_statistics.d_objectivePropagations;
+      sentLemma = true;
+    }
+  }
+  return sentLemma;
+}
+
 bool TheoryArithPrivate::splitDisequalities(){
   bool splitSomething = false;
 
@@ -41,10 +41,12 @@
 #include "theory/arith/linear/dual_simplex.h"
 #include "theory/arith/linear/error_set.h"
 #include "theory/arith/linear/fc_simplex.h"
+#include "theory/arith/linear/gomory_cuts.h"
 #include "theory/arith/linear/infer_bounds.h"
 #include "theory/arith/linear/linear_equality.h"
 #include "theory/arith/linear/matrix.h"
 #include "theory/arith/linear/normal_form.h"
+#include "theory/arith/linear/objective_simplex.h"
 #include "theory/arith/linear/partial_model.h"
 #include "theory/arith/linear/soi_simplex.h"
 #include "theory/theory.h"
@@ -307,6 +309,9 @@ private:
    */
   DioSolver d_diosolver;
 
+  /** Gomory cuts derived from the tableau, see --gomory-cuts. */
+  GomoryCuts d_gomoryCuts;
+
   /** Counts the number of notifyRestart() calls to the theory. */
   uint32_t d_restartsCounter;
 
@@ -391,6 +396,24 @@ private:
   FCSimplexDecisionProcedure d_fcSimplex;
   SumOfInfeasibilitiesSPD d_soiSimplex;
   AttemptSolutionSDP d_attemptSolSimplex;
+  /** The primal simplex for optimizing the objective. */
+  ObjectiveSimplex d_objectiveSimplex;
+
+  /** The objective of the current optimization query, if any. */
+  Node d_objective;
+  /** Whether d_objective is minimized. */
+  bool d_objectiveMinimize;
+  /** Whether the last full effort check computed an optimum of d_objective. */
+  bool d_hasObjectiveBound;
+  /** The optimum of d_objective computed by the last full effort check. */
+  Rational d_objectiveBound;
+  /** Whether d_objectiveBound is a strict bound. */
+  bool d_objectiveBoundStrict;
+  /**
+   * Whether the last full effort check found d_objective to be unbounded in
+   * the current branch.
+   */
+  bool d_objectiveUnbounded;
 
   bool solveRealRelaxation(Theory::Effort effortLevel);
 
@@ -513,6 +536,31 @@ private:
   /** get the congruence manager, if we are using one */
   ArithCongruenceManager* getCongruenceManager();
 
+  /**
+   * Set the objective of the current optimization query to target, which is
+   * minimized if minimize is true and maximized otherwise. If target is null,
+   * the objective is cleared.
+   *
+   * When an objective is set, each full effort check that finds a satisfying
+   * assignment moves it towards the optimum of the objective by pivoting on
+   * the tableau, see optimizeObjective.
+   */
+  void setObjective(TNode target, bool minimize);
+  /**
+   * Get the optimum of the objective computed by the last full effort check.
+   * Returns false if no optimum was computed, or if the current assignment
+   * does not attain it. Otherwise, value is the optimum of the objective in
+   * the current branch, which is attained by the current assignment up to an
+   * infinitesimal if strict is true.
+   */
+  bool getObjectiveBound(Rational& value, bool& strict) const;
+  /**
+   * Returns true if the last full effort check found that the objective
+   * improves without bound along a ray of the tableau, starting from the
+   * current satisfying assignment.
+   */
+  bool isObjectiveUnbounded() const { return d_objectiveUnbounded; }
+
  private:
   /** The constant zero. */
   DeltaRational d_DELTA_ZERO;
@@ -533,6 +581,44 @@ private:
    */
   bool splitDisequalities();
 
+  /**
+   * Optimizes the objective over the tableau, starting from the current
+   * satisfying assignment. If the optimum is implied by bounds other than the
+   * bounds on the objective itself, this sends the lemma
+   *   (=> bounds (>= objective optimum))
+   * (or its dual for maximization). The optimized assignment is kept unless
+   * it breaks an integer model. If the objective is unbounded, this is
+   * recorded for isObjectiveUnbounded.
+   *
+   * Returns true if a new lemma was sent.
+   */
+  bool optimizeObjective();
+  /**
+   * Get the arithmetic variable v of the objective, which is
+   *   (+ offset (* scale nvp))
+   * where nvp is the normalized polynomial that the tableau uses for bounds
+   * on the objective. Returns false if the objective is not linear, is
+   * constant, or has no arithmetic variable yet.
+   */
+  bool getObjectiveVariable(ArithVar& v,
+                            Node& nvp,
+                            Rational& scale,
+                            Rational& offset);
+  /**
+   * Propagates the bound on the objective that the optimization solver
+   * asserts for the incumbent to the summands of the objective. If the
+   * objective is (+ c_1 x_1 ... c_n x_n) and is minimized with the bound
+   * (<= objective u), then each c_i x_i is bounded by u minus the least
+   * values of the other summands, given by their bounds. For each x_i whose
+   * bound is tightened, this sends the lemma
+   *   (=> (and bound_objective bounds_others) (<= x_i b_i))
+   * (or its dual), so that assignments that cannot improve on the incumbent
+   * are pruned by propagation in subsequent searches.
+   *
+   * Returns true if a new lemma was sent.
+   */
+  bool propagateObjectiveBounds();
+
   /** A Difference variable is known to be 0.*/
   void zeroDifferenceDetected(ArithVar x);
 
@@ -796,6 +882,7 @@ private:
 
     TimerStat d_boundComputationTime;
     IntStat d_boundComputations, d_boundPropagations;
+    IntStat d_objectivePropagations;
 
     IntStat d_unknownChecks;
     IntStat d_maxUnknownsInARow;
@@ -45,7 +45,9 @@ namespace nl {
 namespace coverings {
 
 CDCAC::CDCAC(Env& env, const std::vector<poly::Variable>& ordering)
-    : EnvObj(env), d_variableOrdering(ordering)
+    : EnvObj(env),
+      d_variableOrdering(ordering),
+      d_projection(options().arith.nlCovThreads)
 {
   if (d_env.isTheoryProofProducing())
   {
@@ -58,6 +60,7 @@ void CDCAC::reset()
   d_constraints.reset();
   d_assignment.clear();
   d_nextIntervalId = 1;
+  d_projection.clear();
 }
 
 void CDCAC::computeVariableOrdering()
@@ -350,21 +353,21 @@ PolyVector CDCAC::constructCharacterization(std::vector<CACInterval>& intervals)
     for (const auto& p : i.d_downPolys)
     {
       // Add all polynomial from lower levels.
-      res.add(p);
+      d_projection.add(p);
     }
     for (const auto& p : i.d_mainPolys)
     {
       Trace("cdcac::projection")
           << "Discriminant of " << p << " -> " << discriminant(p) << std::endl;
       // Add all discriminants
-      res.add(discriminant(p));
+      d_projection.addDiscriminant(p);
 
       // Add pairwise resultants
       for (const auto& q : i.d_mainPolys)
       {
         // avoid symmetric duplicates
         if (p >= q) continue;
-        res.add(resultant(p, q));
+        d_projection.addResultant(p, q);
       }
 
       for (const auto& q : requiredCoefficients(p))
@@ -372,7 +375,7 @@ PolyVector CDCAC::constructCharacterization(std::vector<CACInterval>& intervals)
         // Add all required coefficients
         Trace("cdcac::projection")
             << "Coeff of " << p << " -> " << q << std::endl;
-        res.add(q);
+        d_projection.add(q);
       }
       for (const auto& q : i.d_lowerPolys)
       {
@@ -381,7 +384,7 @@ PolyVector CDCAC::constructCharacterization(std::vector<CACInterval>& intervals)
         if (!hasRootBelow(q, get_lower(i.d_interval))) continue;
         Trace("cdcac::projection") << "Resultant of " << p << " and " << q
                                    << " -> " << resultant(p, q) << std::endl;
-        res.add(resultant(p, q));
+        d_projection.addResultant(p, q);
       }
       for (const auto& q : i.d_upperPolys)
       {
@@ -390,7 +393,7 @@ PolyVector CDCAC::constructCharacterization(std::vector<CACInterval>& intervals)
         if (!hasRootAbove(q, get_upper(i.d_interval))) continue;
         Trace("cdcac::projection") << "Resultant of " << p << " and " << q
                                    << " -> " << resultant(p, q) << std::endl;
-        res.add(resultant(p, q));
+        d_projection.addResultant(p, q);
       }
     }
   }
@@ -404,11 +407,14 @@ PolyVector CDCAC::constructCharacterization(std::vector<CACInterval>& intervals)
       {
         Trace("cdcac::projection") << "Resultant of " << p << " and " << q
                                    << " -> " << resultant(p, q) << std::endl;
-        res.add(resultant(p, q));
+        d_projection.addResultant(p, q);
       }
     }
   }
 
+  // Computes the resultants and discriminants, possibly in parallel.
+  d_projection.flush(res);
+
   res.reduce();
   res.makeFinestSquareFreeBasis();
 
@@ -30,6 +30,7 @@
 #include "theory/arith/nl/coverings/cdcac_utils.h"
 #include "theory/arith/nl/coverings/constraints.h"
 #include "theory/arith/nl/coverings/lazard_evaluation.h"
+#include "theory/arith/nl/coverings/projections.h"
 #include "theory/arith/nl/coverings/proof_generator.h"
 #include "theory/arith/nl/coverings/variable_ordering.h"
 
@@ -233,6 +234,9 @@ class CDCAC : protected EnvObj
 
   /** The next interval id */
   size_t d_nextIntervalId = 1;
+
+  /** Computes the polynomials of characterizations, see --nl-cov-threads */
+  ProjectionTasks d_projection;
 };
 
 }  // namespace coverings
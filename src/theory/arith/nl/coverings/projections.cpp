@@ -17,6 +17,8 @@
 
 #ifdef CVC5_POLY_IMP
 
+#include <functional>
+
 #include "base/check.h"
 
 namespace cvc5::internal {
@@ -66,6 +68,12 @@ void PolyVector::makeFinestSquareFreeBasis()
   erase(it, end());
   reduce();
 }
+
+void PolyVector::append(const PolyVector& other)
+{
+  std::vector<poly::Polynomial>::insert(end(), other.begin(), other.end());
+}
+
 void PolyVector::pushDownPolys(PolyVector& down, poly::Variable var)
 {
   auto it =
@@ -77,7 +85,135 @@ void PolyVector::pushDownPolys(PolyVector& down, poly::Variable var)
   erase(it, end());
 }
 
+ProjectionTasks::ProjectionTasks(size_t numThreads)
+{
+  if (numThreads <= 1)
+  {
+    return;
+  }
+  const lp_polynomial_context_t* global =
+      poly::Context::get_context().get_polynomial_context();
+  for (size_t i = 0; i < numThreads; ++i)
+  {
+    d_contexts.push_back(lp_polynomial_context_new(
+        global->K, global->var_db, global->var_order));
+  }
+  d_pool.reset(new ThreadPool(numThreads));
+}
+
+ProjectionTasks::~ProjectionTasks()
+{
+  d_tasks.clear();
+  d_pool.reset();
+  for (lp_polynomial_context_t* ctx : d_contexts)
+  {
+    lp_polynomial_context_detach(ctx);
+  }
+}
+
+void ProjectionTasks::add(const poly::Polynomial& p)
+{
+  d_tasks.emplace_back(Task{Op::POLY, p, Polynomial(), {}});
+}
+
+void ProjectionTasks::addDiscriminant(const poly::Polynomial& p)
+{
+  d_tasks.emplace_back(Task{Op::DISCRIMINANT, p, Polynomial(), {}});
+}
+
+void ProjectionTasks::addResultant(const poly::Polynomial& p,
+                                   const poly::Polynomial& q)
+{
+  d_tasks.emplace_back(Task{Op::RESULTANT, p, q, {}});
+}
+
+poly::Polynomial ProjectionTasks::compute(const Task& t)
+{
+  switch (t.d_op)
+  {
+    case Op::DISCRIMINANT: return discriminant(t.d_p);
+    case Op::RESULTANT: return resultant(t.d_p, t.d_q);
+    default: return t.d_p;
+  }
+}
+
+void ProjectionTasks::flush(PolyVector& res)
+{
+  if (d_pool == nullptr || d_tasks.size() < 2)
+  {
+    for (const Task& t : d_tasks)
+    {
+      res.add(compute(t));
+    }
+  }
+  else
+  {
+    computeParallel();
+    for (const Task& t : d_tasks)
+    {
+      res.append(t.d_result);
+    }
+  }
+  d_tasks.clear();
+}
+
+void ProjectionTasks::computeParallel()
+{
+  // The tasks are assigned to the threads round-robin, such that every
+  // context is only used by one thread. The copies of the operands are
+  // moved to the contexts before the threads start.
+  size_t n = d_contexts.size();
+  for (size_t i = 0, size = d_tasks.size(); i < size; ++i)
+  {
+    lp_polynomial_context_t* ctx = d_contexts[i % n];
+    lp_polynomial_set_context(d_tasks[i].d_p.get_internal(), ctx);
+    lp_polynomial_set_context(d_tasks[i].d_q.get_internal(), ctx);
+  }
+  std::vector<std::function<void()>> jobs;
+  for (size_t k = 0; k < n; ++k)
+  {
+    jobs.emplace_back([this, k, n]() {
+      for (size_t i = k, size = d_tasks.size(); i < size; i += n)
+      {
+        d_tasks[i].d_result.add(compute(d_tasks[i]));
+      }
+    });
+  }
+  try
+  {
+    d_pool->run(jobs);
+  }
+  catch (...)
+  {
+    restoreContext();
+    throw;
+  }
+  restoreContext();
+}
+
+void ProjectionTasks::restoreContext()
+{
+  const lp_polynomial_context_t* global =
+      poly::Context::get_context().get_polynomial_context();
+  for (Task& t : d_tasks)
+  {
+    lp_polynomial_set_context(t.d_p.get_internal(), global);
+    lp_polynomial_set_context(t.d_q.get_internal(), global);
+    for (poly::Polynomial& p : t.d_result)
+    {
+      lp_polynomial_set_context(p.get_internal(), global);
+    }
+  }
+}
+
 PolyVector projectionMcCallum(const std::vector<Polynomial>& polys)
+{
+  ProjectionTasks tasks(1);
+  return projectionMcCallum(polys, tasks);
+}
+
+PolyVector projectionMcCallum(const std::vector<Polynomial>& polys,
+                              ProjectionTasks& tasks)
 {
   PolyVector res;
 
@@ -85,17 +221,18 @@ PolyVector projectionMcCallum(const std::vector<Polynomial>& polys)
   {
     for (const auto& coeff : coefficients(p))
     {
-      res.add(coeff);
+      tasks.add(coeff);
     }
-    res.add(discriminant(p));
+    tasks.addDiscriminant(p);
   }
   for (std::size_t i = 0, n = polys.size(); i < n; ++i)
   {
     for (std::size_t j = i + 1; j < n; ++j)
     {
-      res.add(resultant(polys[i], polys[j]));
+      tasks.addResultant(polys[i], polys[j]);
     }
   }
+  tasks.flush(res);
 
   res.reduce();
   return res;
@@ -22,8 +22,11 @@
 
 #include <poly/polyxx.h>
 
+#include <memory>
 #include <vector>
 
+#include "util/thread_pool.h"
+
 namespace cvc5::internal {
 namespace theory {
 namespace arith {
@@ -64,12 +67,82 @@ class PolyVector : public std::vector<poly::Polynomial>
   void makeFinestSquareFreeBasis();
   /** Push polynomials with a lower main variable to another PolyVector. */
   void pushDownPolys(PolyVector& down, poly::Variable var);
+  /** Appends the polynomials of other, which are already factorized. */
+  void append(const PolyVector& other);
+};
+
+/**
+ * Computes the polynomials of a projection, possibly on several threads.
+ *
+ * The polynomials are requested by add(), addDiscriminant() and
+ * addResultant(), and computed by flush(), which adds them to a PolyVector
+ * in the order of the requests. Hence, the result does not depend on the
+ * number of threads.
+ *
+ * The polynomial context of libpoly is not thread-safe, e.g., its reference
+ * count is not atomic. Each thread therefore has a context of its own, which
+ * shares the variables and their order with the global context. The
+ * operands of a request are copied to the context of the thread that
+ * computes it, and the results are moved back to the global context.
+ */
+class ProjectionTasks
+{
+ public:
+  /** Computes the requests on numThreads threads, sequentially if it is 1 */
+  ProjectionTasks(size_t numThreads);
+  ~ProjectionTasks();
+
+  /** Requests the polynomial p */
+  void add(const poly::Polynomial& p);
+  /** Requests the discriminant of p */
+  void addDiscriminant(const poly::Polynomial& p);
+  /** Requests the resultant of p and q */
+  void addResultant(const poly::Polynomial& p, const poly::Polynomial& q);
+  /** Computes all requests and adds the results to res */
+  void flush(PolyVector& res);
+  /** Drops the requests that are not computed yet */
+  void clear() { d_tasks.clear(); }
+
+ private:
+  enum class Op
+  {
+    POLY,
+    DISCRIMINANT,
+    RESULTANT
+  };
+  struct Task
+  {
+    Op d_op;
+    poly::Polynomial d_p;
+    poly::Polynomial d_q;
+    /** The square-free factors of the result */
+    PolyVector d_result;
+  };
+  /** Computes the result of t */
+  static poly::Polynomial compute(const Task& t);
+  /** Computes the tasks on the pool, see flush() */
+  void computeParallel();
+  /** Moves the operands and results of the tasks to the global context */
+  void restoreContext();
+
+  /** The requests that are not computed yet */
+  std::vector<Task> d_tasks;
+  /** The threads, or null if the tasks are computed sequentially */
+  std::unique_ptr<ThreadPool> d_pool;
+  /** The polynomial context of each thread */
+  std::vector<lp_polynomial_context_t*> d_contexts;
 };
 
 /**
  * Computes McCallum's projection operator.
  */
 PolyVector projectionMcCallum(const std::vector<poly::Polynomial>& polys);
+/**
+ * Computes McCallum's projection operator, the resultants and discriminants
+ * are computed by tasks.
+ */
+PolyVector projectionMcCallum(const std::vector<poly::Polynomial>& polys,
+                              ProjectionTasks& tasks);
 
 }  // namespace coverings
 }  // namespace nl
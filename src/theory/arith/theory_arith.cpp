@@ -107,6 +107,21 @@ void TheoryArith::finishInit()
   d_eqSolver->setCongruenceManager(d_internal.getCongruenceManager());
 }
 
+void TheoryArith::setObjective(TNode target, bool minimize)
+{
+  d_internal.setObjective(target, minimize);
+}
+
+bool TheoryArith::getObjectiveBound(Rational& value, bool& strict) const
+{
+  return d_internal.getObjectiveBound(value, strict);
+}
+
+bool TheoryArith::isObjectiveUnbounded() const
+{
+  return d_internal.isObjectiveUnbounded();
+}
+
 void TheoryArith::preRegisterTerm(TNode n)
 {
   // handle logic exceptions
@@ -123,6 +123,27 @@ class TheoryArith : public Theory {
     return d_im;
   }
 
+  /**
+   * Set the objective of the current optimization query, which is minimized
+   * if minimize is true and maximized otherwise. The linear solver optimizes
+   * the objective over its tableau whenever it finds a satisfying assignment
+   * at full effort. Passing the null node clears the objective.
+   */
+  void setObjective(TNode target, bool minimize);
+  /**
+   * Get the optimum of the objective computed by the linear solver in its
+   * last full effort check. Returns false if no optimum was computed.
+   * Otherwise, value is the optimum of the objective in the branch of the
+   * last check, which is attained by the current model up to an infinitesimal
+   * if strict is true.
+   */
+  bool getObjectiveBound(Rational& value, bool& strict) const;
+  /**
+   * Returns true if the linear solver found in its last full effort check
+   * that the objective improves without bound in the branch of that check.
+   */
+  bool isObjectiveUnbounded() const;
+
  private:
   /**
    * Update d_arithModelCache (if it is empty right now) and compute the termSet
@@ -58,8 +58,11 @@ const char* toString(InferenceId i)
     case InferenceId::ARITH_BB_LEMMA: return "ARITH_BB_LEMMA";
     case InferenceId::ARITH_DIO_CUT: return "ARITH_DIO_CUT";
     case InferenceId::ARITH_DIO_DECOMPOSITION: return "ARITH_DIO_DECOMPOSITION";
+    case InferenceId::ARITH_GOMORY_CUT: return "ARITH_GOMORY_CUT";
     case InferenceId::ARITH_UNATE: return "ARITH_UNATE";
     case InferenceId::ARITH_ROW_IMPL: return "ARITH_ROW_IMPL";
+    case InferenceId::ARITH_OBJECTIVE_BOUND: return "ARITH_OBJECTIVE_BOUND";
+    case InferenceId::ARITH_OBJECTIVE_PROP: return "ARITH_OBJECTIVE_PROP";
     case InferenceId::ARITH_SPLIT_FOR_NL_MODEL:
       return "ARITH_SPLIT_FOR_NL_MODEL";
     case InferenceId::ARITH_DEMAND_RESTART: return "ARITH_DEMAND_RESTART";
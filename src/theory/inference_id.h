@@ -95,10 +95,18 @@ enum class InferenceId
   ARITH_BB_LEMMA,
   ARITH_DIO_CUT,
   ARITH_DIO_DECOMPOSITION,
+  // Gomory mixed-integer cut derived from a row of the simplex tableau
+  ARITH_GOMORY_CUT,
   // unate lemma during presolve
   ARITH_UNATE,
   // row implication
   ARITH_ROW_IMPL,
+  // bound on the objective of an optimization query, derived by optimizing it
+  // over the simplex tableau
+  ARITH_OBJECTIVE_BOUND,
+  // bound on a summand of the objective of an optimization query, implied by
+  // the bound on the objective and the bounds on the other summands
+  ARITH_OBJECTIVE_PROP,
   // a split that occurs when the non-linear solver changes values of arithmetic
   // variables in a model, but those variables are inconsistent with assignments
   // from another theory
@@ -13,6 +13,7 @@
  * A multi-precision rational constant.
  */
 #include <cmath>
+#include <numeric>
 #include <sstream>
 #include <string>
 
@@ -89,11 +90,134 @@ std::optional<Rational> Rational::fromDouble(double d)
 {
   using namespace std;
   if(isfinite(d)){
-    Rational q;
-    mpq_set_d(q.d_value.get_mpq_t(), d);
-    return q;
+    mpq_class q;
+    mpq_set_d(q.get_mpq_t(), d);
+    return Rational(q);
   }
   return std::optional<Rational>();
 }
 
+namespace {
+/** The gcd of a and b, where a, b >= 0 */
+template <typename Wide>
+uint64_t gcd(Wide a, uint64_t b)
+{
+  // reduce to machine words first
+  if (b == 0)
+  {
+    return 0;
+  }
+  return std::gcd(static_cast<uint64_t>(a % b), b);
+}
+}  // namespace
+
+bool Rational::reduceSmall(Wide n, Wide d)
+{
+  Assert(d > 0);
+  uint64_t g = gcd(n < 0 ? -n : n, static_cast<uint64_t>(d));
+  if (g > 1)
+  {
+    n /= g;
+    d /= g;
+  }
+  if (!fitsSmall(n, d))
+  {
+    return false;
+  }
+  setSmall(static_cast<long>(n), static_cast<long>(d));
+  return true;
+}
+
+void Rational::setBig(const mpq_class& v)
+{
+  if (mpz_fits_slong_p(v.get_num_mpz_t())
+      && mpz_fits_slong_p(v.get_den_mpz_t()))
+  {
+    long n = mpz_get_si(v.get_num_mpz_t());
+    long d = mpz_get_si(v.get_den_mpz_t());
+    if (fitsSmall(n, d))
+    {
+      setSmall(n, d);
+      return;
+    }
+  }
+  if (d_big == nullptr)
+  {
+    d_big = new mpq_class(v);
+  }
+  else
+  {
+    *d_big = v;
+  }
+  d_num = 0;
+  d_den = 0;
+}
+
+bool Rational::addSmall(long n, long d)
+{
+  Assert(isSmall() && d > 0);
+  if (d_den == 1 && d == 1)
+  {
+    // integers
+    Wide r = static_cast<Wide>(d_num) + n;
+    if (!fitsSmall(r, 1))
+    {
+      return false;
+    }
+    setSmall(static_cast<long>(r), 1);
+    return true;
+  }
+  // Since both summands are canonical, the gcd of the numerator and the
+  // denominator of the sum divides the gcd of the denominators, see Knuth,
+  // TAOCP Vol. 2, 4.5.1
+  uint64_t g = std::gcd(static_cast<uint64_t>(d_den), static_cast<uint64_t>(d));
+  long d1 = d_den / static_cast<long>(g);
+  long d2 = d / static_cast<long>(g);
+  Wide num = static_cast<Wide>(d_num) * d2 + static_cast<Wide>(n) * d1;
+  Wide den = static_cast<Wide>(d_den) * d2;
+  if (g > 1)
+  {
+    uint64_t g2 = gcd(num < 0 ? -num : num, g);
+    if (g2 > 1)
+    {
+      num /= g2;
+      den /= g2;
+    }
+  }
+  if (num == 0)
+  {
+    den = 1;
+  }
+  if (!fitsSmall(num, den))
+  {
+    return false;
+  }
+  setSmall(static_cast<long>(num), static_cast<long>(den));
+  return true;
+}
+
+bool Rational::mulSmall(long n, long d)
+{
+  Assert(isSmall() && d > 0);
+  if (d_num == 0 || n == 0)
+  {
+    setSmall(0, 1);
+    return true;
+  }
+  // cross-reduce, the result is canonical
+  long g1 = static_cast<long>(
+      std::gcd(static_cast<uint64_t>(d_num < 0 ? -d_num : d_num),
+               static_cast<uint64_t>(d)));
+  long g2 = static_cast<long>(std::gcd(static_cast<uint64_t>(n < 0 ? -n : n),
+                                       static_cast<uint64_t>(d_den)));
+  Wide num = static_cast<Wide>(d_num / g1) * (n / g2);
+  Wide den = static_cast<Wide>(d_den / g2) * (d / g1);
+  if (!fitsSmall(num, den))
+  {
+    return false;
+  }
+  setSmall(static_cast<long>(num), static_cast<long>(den));
+  return true;
+}
+
 }  // namespace cvc5::internal
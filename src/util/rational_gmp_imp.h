@@ -20,8 +20,11 @@
 
 #include <gmp.h>
 
+#include <climits>
+#include <cstdint>
 #include <optional>
 #include <string>
+#include <type_traits>
 
 #include "util/gmp_util.h"
 #include "util/integer.h"
@@ -37,6 +40,15 @@ namespace cvc5::internal {
  * literature.) A consequence is that that the numerator and denominator may be
  * different than the values used to construct the Rational.
  *
+ * Rationals whose numerator and denominator fit into a signed long (excluding
+ * its minimum) are stored inline as a pair of machine integers, and GMP is
+ * only used for the others. Arithmetic on small rationals is computed with
+ * 128-bit intermediate results, and promotes the result to GMP if it does not
+ * fit. Where the compiler has no 128-bit integers, small rationals are
+ * restricted to 32-bit numerators and denominators, such that intermediate
+ * results fit into 64 bits. The representation is unique: a value is stored
+ * inline if and only if it fits.
+ *
  * NOTE: The correct way to create a Rational from an int is to use one of the
  * int numerator/int denominator constructors with the denominator 1.  Trying
  * to construct a Rational with a single int, e.g., Rational(0), will put you
@@ -52,7 +64,7 @@ class Rational
    * Assumes that the value is in canonical form, and thus does not
    * have to call canonicalize() on the value.
    */
-  Rational(const mpq_class& val) : d_value(val) {}
+  Rational(const mpq_class& val) : d_big(nullptr) { setBig(val); }
 
   /**
    * Creates a rational from a decimal string (e.g., <code>"1.5"</code>).
@@ -63,7 +75,7 @@ class Rational
   static Rational fromDecimal(const std::string& dec);
 
   /** Constructs a rational with the value 0/1. */
-  Rational() : d_value(0) { d_value.canonicalize(); }
+  Rational() : d_num(0), d_den(1), d_big(nullptr) {}
 
   /**
    * Constructs a Rational from a C string in a given base (defaults to 10).
@@ -72,95 +84,130 @@ class Rational
    * For more information about what is a valid rational string,
    * see GMP's documentation for mpq_set_str().
    */
-  explicit Rational(const char* s, unsigned base = 10) : d_value(s, base)
+  explicit Rational(const char* s, unsigned base = 10) : d_big(nullptr)
   {
-    d_value.canonicalize();
+    mpq_class v(s, base);
+    v.canonicalize();
+    setBig(v);
   }
-  Rational(const std::string& s, unsigned base = 10) : d_value(s, base)
+  Rational(const std::string& s, unsigned base = 10) : d_big(nullptr)
   {
-    d_value.canonicalize();
+    mpq_class v(s, base);
+    v.canonicalize();
+    setBig(v);
   }
 
   /**
    * Creates a Rational from another Rational, q, by performing a deep copy.
    */
-  Rational(const Rational& q) : d_value(q.d_value) { d_value.canonicalize(); }
+  Rational(const Rational& q) : d_num(q.d_num), d_den(q.d_den), d_big(nullptr)
+  {
+    if (!q.isSmall())
+    {
+      d_big = new mpq_class(*q.d_big);
+    }
+  }
+  Rational(Rational&& q) : d_num(q.d_num), d_den(q.d_den), d_big(q.d_big)
+  {
+    q.d_big = nullptr;
+    q.d_num = 0;
+    q.d_den = 1;
+  }
 
   /**
    * Constructs a canonical Rational from a numerator.
    */
-  Rational(signed int n) : d_value(n, 1) { d_value.canonicalize(); }
-  Rational(unsigned int n) : d_value(n, 1) { d_value.canonicalize(); }
-  Rational(signed long int n) : d_value(n, 1) { d_value.canonicalize(); }
-  Rational(unsigned long int n) : d_value(n, 1) { d_value.canonicalize(); }
+  Rational(signed int n) : d_big(nullptr) { setSmallOrBig(n, 1); }
+  Rational(unsigned int n) : d_big(nullptr) { setSmallOrBig(n, 1U); }
+  Rational(signed long int n) : d_big(nullptr) { setSmallOrBig(n, 1L); }
+  Rational(unsigned long int n) : d_big(nullptr) { setSmallOrBig(n, 1UL); }
 
 #ifdef CVC5_NEED_INT64_T_OVERLOADS
   // to avoid truncation, we convert the input value to an mpz and then build
   // the mpq.
-  Rational(int64_t n) : d_value(construct_mpz(n), 1) { d_value.canonicalize(); }
-  Rational(uint64_t n) : d_value(construct_mpz(n), 1)
+  Rational(int64_t n) : d_big(nullptr)
   {
-    d_value.canonicalize();
+    setBig(mpq_class(construct_mpz(n), 1));
+  }
+  Rational(uint64_t n) : d_big(nullptr)
+  {
+    setBig(mpq_class(construct_mpz(n), 1));
   }
 #endif /* CVC5_NEED_INT64_T_OVERLOADS */
 
   /**
    * Constructs a canonical Rational from a numerator and denominator.
    */
-  Rational(signed int n, signed int d) : d_value(n, d)
-  {
-    d_value.canonicalize();
-  }
-  Rational(unsigned int n, unsigned int d) : d_value(n, d)
+  Rational(signed int n, signed int d) : d_big(nullptr) { setSmallOrBig(n, d); }
+  Rational(unsigned int n, unsigned int d) : d_big(nullptr)
   {
-    d_value.canonicalize();
+    setSmallOrBig(n, d);
   }
-  Rational(signed long int n, signed long int d) : d_value(n, d)
+  Rational(signed long int n, signed long int d) : d_big(nullptr)
   {
-    d_value.canonicalize();
+    setSmallOrBig(n, d);
   }
-  Rational(unsigned long int n, unsigned long int d) : d_value(n, d)
+  Rational(unsigned long int n, unsigned long int d) : d_big(nullptr)
   {
-    d_value.canonicalize();
+    setSmallOrBig(n, d);
   }
 
 #ifdef CVC5_NEED_INT64_T_OVERLOADS
   // to avoid truncation, we convert the input value to an mpz and then build
   // the mpq.
-  Rational(int64_t n, int64_t d) : d_value(construct_mpz(n), construct_mpz(d))
+  Rational(int64_t n, int64_t d) : d_big(nullptr)
   {
-    d_value.canonicalize();
+    mpq_class v(construct_mpz(n), construct_mpz(d));
+    v.canonicalize();
+    setBig(v);
   }
-  Rational(uint64_t n, uint64_t d) : d_value(construct_mpz(n), construct_mpz(d))
+  Rational(uint64_t n, uint64_t d) : d_big(nullptr)
   {
-    d_value.canonicalize();
+    mpq_class v(construct_mpz(n), construct_mpz(d));
+    v.canonicalize();
+    setBig(v);
   }
 #endif /* CVC5_NEED_INT64_T_OVERLOADS */
 
-  Rational(const Integer& n, const Integer& d)
-      : d_value(n.get_mpz(), d.get_mpz())
+  Rational(const Integer& n, const Integer& d) : d_big(nullptr)
+  {
+    mpq_class v(n.get_mpz(), d.get_mpz());
+    v.canonicalize();
+    setBig(v);
+  }
+  Rational(const Integer& n) : d_big(nullptr)
   {
-    d_value.canonicalize();
+    setBig(mpq_class(n.get_mpz()));
   }
-  Rational(const Integer& n) : d_value(n.get_mpz()) { d_value.canonicalize(); }
-  ~Rational() {}
+  ~Rational() { delete d_big; }
 
   /**
-   * Returns a copy of d_value to enable public access of GMP data.
+   * Returns the value as a GMP rational to enable public access of GMP data.
+   * Note that this makes a deep copy of the value.
    */
-  const mpq_class& getValue() const { return d_value; }
+  mpq_class getValue() const
+  {
+    mpq_class tmp;
+    return toMpq(tmp);
+  }
 
   /**
    * Returns the value of numerator of the Rational.
    * Note that this makes a deep copy of the numerator.
    */
-  Integer getNumerator() const { return Integer(d_value.get_num()); }
+  Integer getNumerator() const
+  {
+    return isSmall() ? Integer(d_num) : Integer(d_big->get_num());
+  }
 
   /**
    * Returns the value of denominator of the Rational.
    * Note that this makes a deep copy of the denominator.
    */
-  Integer getDenominator() const { return Integer(d_value.get_den()); }
+  Integer getDenominator() const
+  {
+    return isSmall() ? Integer(d_den) : Integer(d_big->get_den());
+  }
 
   static std::optional<Rational> fromDouble(double d);
 
@@ -169,30 +216,62 @@ class Rational
    * approximate: truncation may occur, overflow may result in
    * infinity, and underflow may result in zero.
    */
-  double getDouble() const { return d_value.get_d(); }
+  double getDouble() const
+  {
+    // integers up to 2^53 are converted exactly, as by GMP
+    constexpr int64_t exact = int64_t{1} << 53;
+    if (d_den == 1 && d_num < exact && d_num > -exact)
+    {
+      return static_cast<double>(d_num);
+    }
+    mpq_class tmp;
+    return toMpq(tmp).get_d();
+  }
 
   Rational inverse() const
   {
+    if (isSmall() && d_num != 0)
+    {
+      Rational res;
+      res.d_num = d_num > 0 ? d_den : -d_den;
+      res.d_den = d_num > 0 ? d_num : -d_num;
+      return res;
+    }
     return Rational(getDenominator(), getNumerator());
   }
 
   int cmp(const Rational& x) const
   {
+    if (isSmall() && x.isSmall())
+    {
+      if (d_den == x.d_den)
+      {
+        return d_num < x.d_num ? -1 : (d_num > x.d_num ? 1 : 0);
+      }
+      Wide l = static_cast<Wide>(d_num) * x.d_den;
+      Wide r = static_cast<Wide>(x.d_num) * d_den;
+      return l < r ? -1 : (l > r ? 1 : 0);
+    }
     // Don't use mpq_class's cmp() function.
     // The name ends up conflicting with this function.
-    return mpq_cmp(d_value.get_mpq_t(), x.d_value.get_mpq_t());
+    mpq_class tmp, xtmp;
+    return mpq_cmp(toMpq(tmp).get_mpq_t(), x.toMpq(xtmp).get_mpq_t());
   }
 
-  int sgn() const { return mpq_sgn(d_value.get_mpq_t()); }
+  int sgn() const
+  {
+    if (isSmall())
+    {
+      return d_num > 0 ? 1 : (d_num < 0 ? -1 : 0);
+    }
+    return mpq_sgn(d_big->get_mpq_t());
+  }
 
   bool isZero() const { return sgn() == 0; }
 
-  bool isOne() const { return mpq_cmp_si(d_value.get_mpq_t(), 1, 1) == 0; }
+  bool isOne() const { return d_num == 1 && d_den == 1; }
 
-  bool isNegativeOne() const
-  {
-    return mpq_cmp_si(d_value.get_mpq_t(), -1, 1) == 0;
-  }
+  bool isNegativeOne() const { return d_num == -1 && d_den == 1; }
 
   Rational abs() const
   {
@@ -208,15 +287,25 @@ class Rational
 
   Integer floor() const
   {
+    if (isSmall())
+    {
+      int64_t q = d_num / d_den;
+      return Integer(d_num % d_den < 0 ? q - 1 : q);
+    }
     mpz_class q;
-    mpz_fdiv_q(q.get_mpz_t(), d_value.get_num_mpz_t(), d_value.get_den_mpz_t());
+    mpz_fdiv_q(q.get_mpz_t(), d_big->get_num_mpz_t(), d_big->get_den_mpz_t());
     return Integer(q);
   }
 
   Integer ceiling() const
   {
+    if (isSmall())
+    {
+      int64_t q = d_num / d_den;
+      return Integer(d_num % d_den > 0 ? q + 1 : q);
+    }
     mpz_class q;
-    mpz_cdiv_q(q.get_mpz_t(), d_value.get_num_mpz_t(), d_value.get_den_mpz_t());
+    mpz_cdiv_q(q.get_mpz_t(), d_big->get_num_mpz_t(), d_big->get_den_mpz_t());
     return Integer(q);
   }
 
@@ -225,69 +314,150 @@ class Rational
   Rational& operator=(const Rational& x)
   {
     if (this == &x) return *this;
-    d_value = x.d_value;
+    if (x.isSmall())
+    {
+      setSmall(x.d_num, x.d_den);
+    }
+    else
+    {
+      setBig(*x.d_big);
+    }
+    return *this;
+  }
+  Rational& operator=(Rational&& x)
+  {
+    if (this == &x) return *this;
+    delete d_big;
+    d_num = x.d_num;
+    d_den = x.d_den;
+    d_big = x.d_big;
+    x.d_big = nullptr;
+    x.d_num = 0;
+    x.d_den = 1;
     return *this;
   }
 
-  Rational operator-() const { return Rational(-(d_value)); }
+  Rational operator-() const
+  {
+    if (isSmall())
+    {
+      Rational res;
+      res.d_num = -d_num;
+      res.d_den = d_den;
+      return res;
+    }
+    return Rational(-*d_big);
+  }
 
-  bool operator==(const Rational& y) const { return d_value == y.d_value; }
+  bool operator==(const Rational& y) const
+  {
+    if (isSmall() || y.isSmall())
+    {
+      // the representation is unique
+      return d_num == y.d_num && d_den == y.d_den;
+    }
+    return *d_big == *y.d_big;
+  }
 
-  bool operator!=(const Rational& y) const { return d_value != y.d_value; }
+  bool operator!=(const Rational& y) const { return !(*this == y); }
 
-  bool operator<(const Rational& y) const { return d_value < y.d_value; }
+  bool operator<(const Rational& y) const { return cmp(y) < 0; }
 
-  bool operator<=(const Rational& y) const { return d_value <= y.d_value; }
+  bool operator<=(const Rational& y) const { return cmp(y) <= 0; }
 
-  bool operator>(const Rational& y) const { return d_value > y.d_value; }
+  bool operator>(const Rational& y) const { return cmp(y) > 0; }
 
-  bool operator>=(const Rational& y) const { return d_value >= y.d_value; }
+  bool operator>=(const Rational& y) const { return cmp(y) >= 0; }
 
   Rational operator+(const Rational& y) const
   {
-    return Rational(d_value + y.d_value);
+    Rational res(*this);
+    res += y;
+    return res;
   }
   Rational operator-(const Rational& y) const
   {
-    return Rational(d_value - y.d_value);
+    Rational res(*this);
+    res -= y;
+    return res;
   }
 
   Rational operator*(const Rational& y) const
   {
-    return Rational(d_value * y.d_value);
+    Rational res(*this);
+    res *= y;
+    return res;
   }
   Rational operator/(const Rational& y) const
   {
-    return Rational(d_value / y.d_value);
+    Rational res(*this);
+    res /= y;
+    return res;
   }
 
   Rational& operator+=(const Rational& y)
   {
-    d_value += y.d_value;
+    if (!(isSmall() && y.isSmall() && addSmall(y.d_num, y.d_den)))
+    {
+      mpq_class tmp, ytmp;
+      setBig(toMpq(tmp) + y.toMpq(ytmp));
+    }
     return (*this);
   }
   Rational& operator-=(const Rational& y)
   {
-    d_value -= y.d_value;
+    // the numerator of a small rational can be negated
+    if (!(isSmall() && y.isSmall() && addSmall(-y.d_num, y.d_den)))
+    {
+      mpq_class tmp, ytmp;
+      setBig(toMpq(tmp) - y.toMpq(ytmp));
+    }
     return (*this);
   }
 
   Rational& operator*=(const Rational& y)
   {
-    d_value *= y.d_value;
+    if (!(isSmall() && y.isSmall() && mulSmall(y.d_num, y.d_den)))
+    {
+      mpq_class tmp, ytmp;
+      setBig(toMpq(tmp) * y.toMpq(ytmp));
+    }
     return (*this);
   }
 
   Rational& operator/=(const Rational& y)
   {
-    d_value /= y.d_value;
+    // division by zero is left to GMP
+    if (!(isSmall() && y.isSmall() && y.d_num != 0
+          && mulSmall(y.d_num > 0 ? y.d_den : -y.d_den,
+                      y.d_num > 0 ? y.d_num : -y.d_num)))
+    {
+      mpq_class tmp, ytmp;
+      setBig(toMpq(tmp) / y.toMpq(ytmp));
+    }
     return (*this);
   }
 
-  bool isIntegral() const { return mpz_cmp_ui(d_value.get_den_mpz_t(), 1) == 0; }
+  bool isIntegral() const
+  {
+    if (isSmall())
+    {
+      return d_den == 1;
+    }
+    return mpz_cmp_ui(d_big->get_den_mpz_t(), 1) == 0;
+  }
 
   /** Returns a string representing the rational in the given base. */
-  std::string toString(int base = 10) const { return d_value.get_str(base); }
+  std::string toString(int base = 10) const
+  {
+    if (isSmall() && base == 10)
+    {
+      std::string res = std::to_string(d_num);
+      return d_den == 1 ? res : res + "/" + std::to_string(d_den);
+    }
+    mpq_class tmp;
+    return toMpq(tmp).get_str(base);
+  }
 
   /**
    * Computes the hash of the rational from hashes of the numerator and the
@@ -295,8 +465,18 @@ class Rational
    */
   size_t hash() const
   {
-    size_t numeratorHash = gmpz_hash(d_value.get_num_mpz_t());
-    size_t denominatorHash = gmpz_hash(d_value.get_den_mpz_t());
+#if GMP_LIMB_BITS == 64
+    if (isSmall())
+    {
+      // the same as gmpz_hash for values of at most one limb
+      return static_cast<size_t>(d_num < 0 ? -d_num : d_num)
+             ^ static_cast<size_t>(d_den);
+    }
+#endif
+    mpq_class tmp;
+    const mpq_class& v = toMpq(tmp);
+    size_t numeratorHash = gmpz_hash(v.get_num_mpz_t());
+    size_t denominatorHash = gmpz_hash(v.get_den_mpz_t());
 
     return numeratorHash ^ denominatorHash;
   }
@@ -312,11 +492,119 @@ class Rational
   int absCmp(const Rational& q) const;
 
  private:
+#ifdef __SIZEOF_INT128__
+  /** The type of intermediate results of small arithmetic */
+  using Wide = __int128;
+  /** The bound of the numerator and denominator of small rationals */
+  static constexpr long SMALL_MAX = LONG_MAX;
+#else
+  using Wide = int64_t;
+  static constexpr long SMALL_MAX = INT32_MAX;
+#endif
+
+  /** Returns true if the value is stored inline */
+  bool isSmall() const { return d_den != 0; }
+  /** Returns true if n/d is in the range of small rationals */
+  static bool fitsSmall(Wide n, Wide d)
+  {
+    return n >= -static_cast<Wide>(SMALL_MAX) && n <= SMALL_MAX && d > 0
+           && d <= SMALL_MAX;
+  }
+  /** Returns true if the integer n is in the range of small rationals */
+  template <typename T>
+  static bool fitsSmall(T n)
+  {
+    if constexpr (std::is_signed_v<T>)
+    {
+      return n >= -SMALL_MAX && n <= SMALL_MAX;
+    }
+    else
+    {
+      return n <= static_cast<unsigned long>(SMALL_MAX);
+    }
+  }
+  /**
+   * Returns the value as a GMP rational, which is d_big, or tmp set to the
+   * value for a small rational.
+   */
+  const mpq_class& toMpq(mpq_class& tmp) const
+  {
+    if (!isSmall())
+    {
+      return *d_big;
+    }
+    tmp.get_num() = d_num;
+    tmp.get_den() = d_den;
+    return tmp;
+  }
+
+  /** Set to n/d, which is canonical and fits */
+  void setSmall(long n, long d)
+  {
+    delete d_big;
+    d_big = nullptr;
+    d_num = n;
+    d_den = d;
+  }
+  /** Set to n/d, which need not be canonical */
+  template <typename T>
+  void setSmallOrBig(T n, T d)
+  {
+    if (d == 1 && fitsSmall(n))
+    {
+      setSmall(static_cast<long>(n), 1);
+      return;
+    }
+    if constexpr (std::is_signed_v<T>)
+    {
+      if (d != 0 && n != LONG_MIN && d != LONG_MIN)
+      {
+        // make the denominator positive
+        Wide wn = d < 0 ? -static_cast<Wide>(n) : n;
+        Wide wd = d < 0 ? -static_cast<Wide>(d) : d;
+        if (reduceSmall(wn, wd))
+        {
+          return;
+        }
+      }
+    }
+    else if (d != 0 && n <= static_cast<T>(LONG_MAX)
+             && d <= static_cast<T>(LONG_MAX))
+    {
+      if (reduceSmall(n, d))
+      {
+        return;
+      }
+    }
+    mpq_class v(n, d);
+    v.canonicalize();
+    setBig(v);
+  }
+  /**
+   * Set to n/d reduced by their gcd, where d > 0 and both are bounded by
+   * LONG_MAX in absolute value. Returns false without changing this if the
+   * reduced value does not fit.
+   */
+  bool reduceSmall(Wide n, Wide d);
+  /** Set to the canonical value v */
+  void setBig(const mpq_class& v);
+  /**
+   * Add n/d to this small rational, where n/d is canonical and d > 0. Returns
+   * false without changing this if the result does not fit.
+   */
+  bool addSmall(long n, long d);
   /**
-   * Stores the value of the rational is stored in a C++ GMP rational class.
-   * Using this instead of mpq_t allows for easier destruction.
+   * Multiply this small rational by n/d, where n/d is canonical and d > 0.
+   * Returns false without changing this if the result does not fit.
    */
-  mpq_class d_value;
+  bool mulSmall(long n, long d);
+
+  /** The numerator of a small rational */
+  long d_num;
+  /** The denominator of a small rational, or 0 if the value is in d_big */
+  long d_den;
+  /** The value of a rational that is not small, or nullptr */
+  mpq_class* d_big;
 
 }; /* class Rational */
 
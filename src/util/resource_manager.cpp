@@ -25,6 +25,7 @@
 #include "options/base_options.h"
 #include "options/option_exception.h"
 #include "options/options.h"
+#include "util/statistics_exporter.h"
 #include "util/statistics_registry.h"
 
 using namespace std;
@@ -178,6 +179,16 @@ ResourceManager::ResourceManager(StatisticsRegistry& stats,
       throw OptionException("Did not recognize resource type " + name);
     }
   }
+  if constexpr (configuration::isStatisticsBuild())
+  {
+    if (d_options.base.statisticsStreamFd >= 0)
+    {
+      d_exporter = std::make_unique<StatisticsExporter>(
+          stats,
+          static_cast<int>(d_options.base.statisticsStreamFd),
+          d_options.base.statisticsStreamInterval);
+    }
+  }
 }
 
 ResourceManager::~ResourceManager() {}
@@ -205,6 +216,10 @@ void ResourceManager::spendResource(uint64_t amount)
 {
   ++d_statistics->d_spendResourceCalls;
   d_cumulativeResourceUsed += amount;
+  if (d_exporter != nullptr)
+  {
+    d_exporter->poll();
+  }
 
   Trace("limit") << "ResourceManager::spendResource()" << std::endl;
   d_thisCallResourceUsed += amount;
@@ -254,6 +269,10 @@ void ResourceManager::beginCall()
   // begin call
   d_perCallTimer.set(d_options.base.perCallMillisecondLimit);
   d_thisCallResourceUsed = 0;
+  if (d_exporter != nullptr)
+  {
+    d_exporter->begin();
+  }
 
   if (d_options.base.cumulativeResourceLimit > 0)
   {
@@ -273,6 +292,10 @@ void ResourceManager::beginCall()
 
 void ResourceManager::refresh()
 {
+  if (d_exporter != nullptr)
+  {
+    d_exporter->end();
+  }
   d_cumulativeTimeUsed += d_perCallTimer.elapsed();
   d_perCallTimer.set(0);
   d_thisCallResourceUsed = 0;
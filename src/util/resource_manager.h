@@ -33,6 +33,7 @@ namespace cvc5::internal {
 
 class Listener;
 class Options;
+class StatisticsExporter;
 class StatisticsRegistry;
 
 /**
@@ -220,6 +221,8 @@ class ResourceManager
   struct Statistics;
   /** The statistics object */
   std::unique_ptr<Statistics> d_statistics;
+  /** The exporter of statistics, if --stats-stream-fd is set */
+  std::unique_ptr<StatisticsExporter> d_exporter;
 }; /* class ResourceManager */
 
 }  // namespace cvc5::internal
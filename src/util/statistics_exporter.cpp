@@ -0,0 +1,89 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Periodic export of statistics while a query is running.
+ */
+
+#include "util/statistics_exporter.h"
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <sstream>
+#include <string>
+
+namespace cvc5::internal {
+
+StatisticsExporter::StatisticsExporter(const StatisticsRegistry& reg,
+                                       int fd,
+                                       uint64_t interval)
+    : d_reg(reg),
+      d_fd(fd),
+      d_interval(interval),
+      d_running(false),
+      d_query(0),
+      d_countdown(POLL_STEP)
+{
+}
+
+void StatisticsExporter::begin()
+{
+  d_running = true;
+  ++d_query;
+  d_start = clock::now();
+  d_next = d_start + d_interval;
+  d_countdown = POLL_STEP;
+}
+
+void StatisticsExporter::end()
+{
+  if (d_running)
+  {
+    write(true);
+    d_running = false;
+  }
+}
+
+void StatisticsExporter::write(bool final)
+{
+  clock::time_point now = clock::now();
+  d_next = now + d_interval;
+  if (d_fd < 0)
+  {
+    return;
+  }
+  std::stringstream ss;
+  ss << "{\"query\":" << d_query << ",\"time\":"
+     << std::chrono::duration_cast<std::chrono::milliseconds>(now - d_start)
+            .count()
+     << ",\"final\":" << (final ? "true" : "false") << ",\"stats\":{";
+  d_reg.printJsonDelta(ss, d_snapshot);
+  ss << "}}\n";
+  std::string line = ss.str();
+  const char* data = line.data();
+  size_t size = line.size();
+  while (size > 0)
+  {
+    ssize_t n = ::write(d_fd, data, size);
+    if (n < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if (n <= 0)
+    {
+      // stop exporting, the solver should not fail because of monitoring
+      d_fd = -1;
+      return;
+    }
+    data += n;
+    size -= static_cast<size_t>(n);
+  }
+}
+
+}  // namespace cvc5::internal
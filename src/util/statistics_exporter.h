@@ -0,0 +1,97 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Periodic export of statistics while a query is running.
+ */
+
+#include "cvc5_private_library.h"
+
+#ifndef CVC5__UTIL__STATISTICS_EXPORTER_H
+#define CVC5__UTIL__STATISTICS_EXPORTER_H
+
+#include <chrono>
+#include <cstdint>
+
+#include "util/statistics_registry.h"
+
+namespace cvc5::internal {
+
+/**
+ * Writes the changes of the statistics of a registry as newline-delimited
+ * JSON to a file descriptor, periodically while a query is running. Each
+ * line is an object of the form
+ *   {"query":2,"time":1500,"final":false,"stats":{...}}
+ * where `time` is the number of milliseconds since the start of the query
+ * and `stats` holds the changes since the previous line, see
+ * `StatisticsRegistry::printJsonDelta`. The last line of a query has
+ * `final` set to true.
+ *
+ * The exporter does not use a thread of its own, since statistics are not
+ * synchronized. Instead, `poll()` is called by the solver, and only reads the
+ * clock every few calls. Hence, lines may be written later than scheduled if
+ * the solver does not call `poll()` for a while.
+ */
+class StatisticsExporter
+{
+  using clock = std::chrono::steady_clock;
+
+ public:
+  /**
+   * @param reg The registry whose statistics are exported
+   * @param fd The file descriptor to write to
+   * @param interval The number of milliseconds between two lines
+   */
+  StatisticsExporter(const StatisticsRegistry& reg, int fd, uint64_t interval);
+
+  /** Marks the start of a query */
+  void begin();
+  /** Writes a line if the interval has passed since the last one */
+  void poll()
+  {
+    if (d_running && --d_countdown == 0)
+    {
+      d_countdown = POLL_STEP;
+      if (clock::now() >= d_next)
+      {
+        write(false);
+      }
+    }
+  }
+  /** Marks the end of a query, writes the final line of the query */
+  void end();
+
+ private:
+  /** The number of calls to poll() between two readings of the clock */
+  static constexpr uint32_t POLL_STEP = 256;
+  /** Write a line, and schedule the next one */
+  void write(bool final);
+
+  /** The registry */
+  const StatisticsRegistry& d_reg;
+  /** The file descriptor, or -1 if writing to it failed */
+  int d_fd;
+  /** The interval between two lines */
+  std::chrono::milliseconds d_interval;
+  /** The values of the statistics when the last line was written */
+  StatisticsRegistry::Snapshot d_snapshot;
+  /** Whether a query is running */
+  bool d_running;
+  /** The number of queries so far */
+  uint64_t d_query;
+  /** The start of the current query */
+  clock::time_point d_start;
+  /** The time when the next line is due */
+  clock::time_point d_next;
+  /** The number of calls to poll() until the clock is read */
+  uint32_t d_countdown;
+};
+
+}  // namespace cvc5::internal
+
+#endif /* CVC5__UTIL__STATISTICS_EXPORTER_H */
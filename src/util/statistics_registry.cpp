@@ -17,16 +17,83 @@
 
 #include "util/statistics_registry.h"
 
+#include <cmath>
+
 #include "options/base_options.h"
 #include "util/statistics_public.h"
 
 namespace cvc5::internal {
 
+namespace {
+/** Print s as a JSON string */
+void printJsonString(std::ostream& os, const std::string& s)
+{
+  os << '"';
+  for (char c : s)
+  {
+    if (c == '"' || c == '\\')
+    {
+      os << '\\' << c;
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      static const char* hex = "0123456789abcdef";
+      os << "\\u00" << hex[c >> 4] << hex[c & 0xf];
+    }
+    else
+    {
+      os << c;
+    }
+  }
+  os << '"';
+}
+
+/**
+ * Get the value of a statistic for printJsonDelta, where timers are exported
+ * as integers.
+ */
+StatExportData getJsonValue(const StatisticBaseValue& value)
+{
+  if (auto* timer = dynamic_cast<const StatisticTimerValue*>(&value))
+  {
+    return static_cast<int64_t>(timer->get());
+  }
+  return value.getViewer();
+}
+
+/** Measure the cost of reading the clock of timers in nanoseconds */
+double measureClockCost()
+{
+  constexpr size_t n = 1000;
+  auto start = StatisticTimerValue::clock::now();
+  for (size_t i = 0; i < n; ++i)
+  {
+    StatisticTimerValue::clock::now();
+  }
+  auto end = StatisticTimerValue::clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / n;
+}
+}  // namespace
+
 StatisticsRegistry::StatisticsRegistry(bool internal,
                                        bool all,
-                                       bool registerPublic)
-    : d_internal(internal), d_all(all)
+                                       bool registerPublic,
+                                       uint64_t timerSampling,
+                                       bool reportOverhead)
+    : d_internal(internal), d_all(all), d_timerSampling(timerSampling)
 {
+  Assert(timerSampling > 0);
+  if constexpr (configuration::isStatisticsBuild())
+  {
+    if (reportOverhead)
+    {
+      auto overhead = std::make_unique<StatisticOverheadValue>();
+      overhead->d_internal = false;
+      overhead->d_clockCost = measureClockCost();
+      d_overhead = overhead.get();
+      d_stats.emplace("statistics::timerOverhead", std::move(overhead));
+    }
+  }
   if (registerPublic)
   {
     registerPublicStatistics(*this);
@@ -45,7 +112,21 @@ IntStat StatisticsRegistry::registerInt(const std::string& name, bool internal)
 TimerStat StatisticsRegistry::registerTimer(const std::string& name,
                                             bool internal)
 {
-  return registerStat<TimerStat>(name, internal);
+  size_t size = d_stats.size();
+  TimerStat res = registerStat<TimerStat>(name, internal);
+  if constexpr (configuration::isStatisticsBuild())
+  {
+    if (d_stats.size() > size)
+    {
+      // a new timer
+      res.d_data->d_sampling = d_timerSampling;
+      if (d_overhead != nullptr)
+      {
+        d_overhead->d_timers.push_back(res.d_data);
+      }
+    }
+  }
+  return res;
 }
 
 void StatisticsRegistry::storeSnapshot()
@@ -155,4 +236,88 @@ std::ostream& operator<<(std::ostream& os, const StatisticsRegistry& sr)
   return os;
 }
 
+void StatisticsRegistry::printJsonDelta(std::ostream& os,
+                                        Snapshot& snapshot) const
+{
+  if constexpr (configuration::isStatisticsBuild())
+  {
+    bool first = true;
+    auto printName = [&os, &first](const std::string& name) {
+      os << (first ? "" : ",");
+      first = false;
+      printJsonString(os, name);
+      os << ":";
+    };
+    for (const auto& s : d_stats)
+    {
+      StatExportData cur = getJsonValue(*s.second);
+      auto oldit = snapshot.find(s.first);
+      if (oldit == snapshot.end())
+      {
+        if (s.second->isDefault())
+        {
+          continue;
+        }
+        oldit = snapshot.emplace(s.first, StatExportData()).first;
+      }
+      else if (oldit->second == cur)
+      {
+        continue;
+      }
+      StatExportData& old = oldit->second;
+      if (auto* i = std::get_if<int64_t>(&cur))
+      {
+        int64_t* o = std::get_if<int64_t>(&old);
+        printName(s.first);
+        os << *i - (o == nullptr ? 0 : *o);
+      }
+      else if (auto* d = std::get_if<double>(&cur))
+      {
+        printName(s.first);
+        if (std::isfinite(*d))
+        {
+          os << *d;
+        }
+        else
+        {
+          // JSON has no representation of infinity and NaN
+          os << "null";
+        }
+      }
+      else if (auto* str = std::get_if<std::string>(&cur))
+      {
+        printName(s.first);
+        printJsonString(os, *str);
+      }
+      else
+      {
+        using Map = std::map<std::string, uint64_t>;
+        const Map& m = std::get<Map>(cur);
+        const Map* o = std::get_if<Map>(&old);
+        printName(s.first);
+        os << "{";
+        bool firstEntry = true;
+        for (const auto& [key, count] : m)
+        {
+          uint64_t prev = 0;
+          if (o != nullptr)
+          {
+            auto it = o->find(key);
+            prev = it == o->end() ? 0 : it->second;
+          }
+          if (count != prev)
+          {
+            os << (firstEntry ? "" : ",");
+            firstEntry = false;
+            printJsonString(os, key);
+            os << ":" << count - prev;
+          }
+        }
+        os << "}";
+      }
+      old = std::move(cur);
+    }
+  }
+}
+
 }  // namespace cvc5::internal
@@ -45,7 +45,10 @@
  * TimerStat uses std::chrono to collect timing information. It is
  * implemented as BackedStat<std::chrono::duration> and provides methods
  * start() and stop(), accumulating times it was activated. It provides
- * the convenience class CodeTimer to allow for RAII-style usage.
+ * the convenience class CodeTimer to allow for RAII-style usage. To reduce the
+ * cost of reading the clock, the registry can be configured to only measure
+ * every n-th activation of a timer, from which the total time is
+ * extrapolated.
  *
  *
  * All statistic classes should protect their custom methods using
@@ -126,10 +129,17 @@ class StatisticsRegistry
    * @param all            True to also print statistics that are unchanged
    *                       (hold the default value).
    * @param registerPublic True to also register public statistics.
+   * @param timerSampling  Only every timerSampling-th activation of a timer
+   *                       is measured.
+   * @param reportOverhead True to register the statistic
+   *                       `statistics::timerOverhead`, which estimates the
+   *                       time spent on measuring timers in milliseconds.
    */
   StatisticsRegistry(bool internal = false,
                      bool all = false,
-                     bool registerPublic = true);
+                     bool registerPublic = true,
+                     uint64_t timerSampling = 1,
+                     bool reportOverhead = false);
 
   /** Register a new running average statistic for `name` */
   AverageStat registerAverage(const std::string& name, bool internal = true);
@@ -228,6 +238,16 @@ class StatisticsRegistry
    * Print all statistics as a diff to the last stored snapshot.
    */
   void printDiff(std::ostream& os) const;
+  /**
+   * Print the changes of all statistics since `snapshot` as the members of a
+   * JSON object to the given output stream, and update `snapshot` to the
+   * current values. Internal statistics are included regardless of the
+   * configuration of the registry, statistics that did not change since
+   * `snapshot` are omitted. Integers, timers (in milliseconds) and the entries
+   * of histograms are printed as differences, all other values as the new
+   * value, where doubles that are infinite or NaN are printed as null.
+   */
+  void printJsonDelta(std::ostream& os, Snapshot& snapshot) const;
 
  private:
   /**
@@ -270,6 +290,10 @@ class StatisticsRegistry
   bool d_internal = false;
   /** True to enable all statistics, even those that have default values. */
   bool d_all = false;
+  /** Only every d_timerSampling-th activation of a timer is measured. */
+  uint64_t d_timerSampling = 1;
+  /** The overhead statistic, or nullptr if it is not reported */
+  StatisticOverheadValue* d_overhead = nullptr;
 };
 
 /** Calls `sr.print(os)`. */
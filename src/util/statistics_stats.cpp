@@ -30,62 +30,9 @@ AverageStat& AverageStat::operator<<(double v)
   return *this;
 }
 
-IntStat& IntStat::operator=(int64_t val)
+IntStat::IntStat(stat_type* data)
+    : ValueStat(data), d_value(data == nullptr ? nullptr : &data->d_value)
 {
-  if constexpr (configuration::isStatisticsBuild())
-  {
-    d_data->d_value = val;
-  }
-  return *this;
-}
-
-IntStat& IntStat::operator++()
-{
-  if constexpr (configuration::isStatisticsBuild())
-  {
-    d_data->d_value++;
-  }
-  return *this;
-}
-
-IntStat& IntStat::operator++(int)
-{
-  if constexpr (configuration::isStatisticsBuild())
-  {
-    d_data->d_value++;
-  }
-  return *this;
-}
-
-IntStat& IntStat::operator+=(int64_t val)
-{
-  if constexpr (configuration::isStatisticsBuild())
-  {
-    d_data->d_value += val;
-  }
-  return *this;
-}
-
-void IntStat::maxAssign(int64_t val)
-{
-  if constexpr (configuration::isStatisticsBuild())
-  {
-    if (d_data->d_value < val)
-    {
-      d_data->d_value = val;
-    }
-  }
-}
-
-void IntStat::minAssign(int64_t val)
-{
-  if constexpr (configuration::isStatisticsBuild())
-  {
-    if (d_data->d_value > val)
-    {
-      d_data->d_value = val;
-    }
-  }
 }
 
 void TimerStat::start()
@@ -93,8 +40,14 @@ void TimerStat::start()
   if constexpr (configuration::isStatisticsBuild())
   {
     Assert(!d_data->d_running) << "timer is already running";
-    d_data->d_start = StatisticTimerValue::clock::now();
     d_data->d_running = true;
+    // only every d_sampling-th activation reads the clock
+    d_data->d_sampled = --d_data->d_countdown == 0;
+    if (d_data->d_sampled)
+    {
+      d_data->d_countdown = d_data->d_sampling;
+      d_data->d_start = StatisticTimerValue::clock::now();
+    }
   }
 }
 void TimerStat::stop()
@@ -102,7 +55,12 @@ void TimerStat::stop()
   if constexpr (configuration::isStatisticsBuild())
   {
     Assert(d_data->d_running) << "timer is not running";
-    d_data->d_duration += StatisticTimerValue::clock::now() - d_data->d_start;
+    if (d_data->d_sampled)
+    {
+      d_data->d_duration += StatisticTimerValue::clock::now() - d_data->d_start;
+      ++d_data->d_samples;
+    }
+    ++d_data->d_activations;
     d_data->d_running = false;
   }
 }
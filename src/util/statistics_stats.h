@@ -36,6 +36,7 @@ template <typename T>
 struct StatisticBackedValue;
 template <typename T>
 struct StatisticHistogramValue;
+struct StatisticIntValue;
 template <typename T>
 struct StatisticReferenceValue;
 template <typename T>
@@ -323,6 +324,9 @@ class ValueStat
  * Supports the most useful standard operators (assignment, pre- and
  * post-increment, addition assignment) and some custom ones (maximum
  * assignment, minimum assignment).
+ * The operators are defined inline, as they are used in hot loops. They
+ * access the value via a pointer that is cached at construction, which
+ * avoids the inclusion of the value types.
  */
 class IntStat : public ValueStat<int64_t>
 {
@@ -330,23 +334,71 @@ class IntStat : public ValueStat<int64_t>
   /** Allow access to private constructor */
   friend class StatisticsRegistry;
   /** Value stored for this statistic */
-  using stat_type = StatisticBackedValue<int64_t>;
+  using stat_type = StatisticIntValue;
   /** Set to given value */
-  IntStat& operator=(int64_t val);
+  IntStat& operator=(int64_t val)
+  {
+    if constexpr (configuration::isStatisticsBuild())
+    {
+      *d_value = val;
+    }
+    return *this;
+  }
   /** Pre-increment for the integer */
-  IntStat& operator++();
+  IntStat& operator++()
+  {
+    if constexpr (configuration::isStatisticsBuild())
+    {
+      ++*d_value;
+    }
+    return *this;
+  }
   /** Post-increment for the integer */
-  IntStat& operator++(int);
+  IntStat& operator++(int)
+  {
+    if constexpr (configuration::isStatisticsBuild())
+    {
+      ++*d_value;
+    }
+    return *this;
+  }
   /** Add `val` to the integer */
-  IntStat& operator+=(int64_t val);
+  IntStat& operator+=(int64_t val)
+  {
+    if constexpr (configuration::isStatisticsBuild())
+    {
+      *d_value += val;
+    }
+    return *this;
+  }
   /** Assign the maximum of the current value and `val` */
-  void maxAssign(int64_t val);
+  void maxAssign(int64_t val)
+  {
+    if constexpr (configuration::isStatisticsBuild())
+    {
+      if (*d_value < val)
+      {
+        *d_value = val;
+      }
+    }
+  }
   /** Assign the minimum of the current value and `val` */
-  void minAssign(int64_t val);
+  void minAssign(int64_t val)
+  {
+    if constexpr (configuration::isStatisticsBuild())
+    {
+      if (*d_value > val)
+      {
+        *d_value = val;
+      }
+    }
+  }
 
  private:
   /** Construct from a pointer to the internal data */
-  IntStat(stat_type* data) : ValueStat(data) {}
+  IntStat(stat_type* data);
+  /** The value of the internal data, or nullptr if there is none */
+  int64_t* d_value;
 };
 
 }  // namespace cvc5::internal
@@ -25,6 +25,7 @@
 
 #include "util/statistics_value.h"
 
+#include "base/check.h"
 #include "util/ostream_util.h"
 
 namespace cvc5::internal {
@@ -103,11 +104,43 @@ void StatisticTimerValue::printSafe(int fd) const
 uint64_t StatisticTimerValue::get() const
 {
   auto data = d_duration;
-  if (d_running)
+  uint64_t activations = d_activations;
+  uint64_t samples = d_samples;
+  if (d_running && d_sampled)
   {
     data += clock::now() - d_start;
+    ++activations;
+    ++samples;
   }
-  return static_cast<int64_t>(data / std::chrono::milliseconds(1));
+  if (samples == activations)
+  {
+    return static_cast<int64_t>(data / std::chrono::milliseconds(1));
+  }
+  // extrapolate from the measured activations, the first activation is
+  // always measured
+  Assert(samples > 0);
+  double ms = std::chrono::duration<double, std::milli>(data).count();
+  return static_cast<uint64_t>(ms * activations / samples);
+}
+
+StatExportData StatisticOverheadValue::getViewer() const { return get(); }
+
+bool StatisticOverheadValue::isDefault() const { return false; }
+
+void StatisticOverheadValue::printSafe(int fd) const
+{
+  safe_print<double>(fd, get());
+}
+
+double StatisticOverheadValue::get() const
+{
+  uint64_t samples = 0;
+  for (const StatisticTimerValue* t : d_timers)
+  {
+    samples += t->d_samples;
+  }
+  // each measured activation reads the clock twice
+  return 2 * samples * d_clockCost / 1e6;
 }
 
 }  // namespace cvc5::internal
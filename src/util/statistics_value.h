@@ -103,6 +103,16 @@ struct StatisticBackedValue : StatisticBaseValue
   T d_value;
 };
 
+/**
+ * Holds the value of an `IntStat`. Integer statistics are updated in the
+ * hottest loops of the solver, hence each of them is placed on a cache line of
+ * its own. This way, the values of solvers that run in different threads never
+ * share a cache line.
+ */
+struct alignas(64) StatisticIntValue : StatisticBackedValue<int64_t>
+{
+};
+
 /**
  * Holds the data for a histogram. We assume the type to be (convertible to)
  * integral, and we can thus use a std::vector<uint64_t> for fast storage.
@@ -362,12 +372,14 @@ struct StatisticTimerValue : StatisticBaseValue
   void printSafe(int fd) const override;
   /**
    * Returns the elapsed time in milliseconds.
-   * Make sure that we include the time of a currently running timer
+   * Make sure that we include the time of a currently running timer.
+   * If only some activations of the timer were measured, the elapsed time
+   * is extrapolated from the measured ones.
    */
   uint64_t get() const;
 
   /**
-   * The cumulative duration of the timer so far. 
+   * The cumulative duration of the measured activations of the timer so far.
    * Does not include a currently running timer, but `get()` takes care of this.
    */
   duration d_duration;
@@ -378,6 +390,37 @@ struct StatisticTimerValue : StatisticBaseValue
   time_point d_start;
   /** Whether a timer is running right now. */
   bool d_running;
+  /** Whether the currently running activation is measured. */
+  bool d_sampled = false;
+  /** Every d_sampling-th activation of the timer is measured. */
+  uint64_t d_sampling = 1;
+  /** The number of activations until the next measured one. */
+  uint64_t d_countdown = 1;
+  /** The number of completed activations. */
+  uint64_t d_activations = 0;
+  /** The number of completed activations that were measured. */
+  uint64_t d_samples = 0;
+};
+
+/**
+ * Estimates the time that was spent reading the clock for the timers of a
+ * registry, from the number of measured activations of the timers and the
+ * cost of reading the clock, which is measured once.
+ * The estimate is computed whenever the value is read.
+ */
+struct StatisticOverheadValue : StatisticBaseValue
+{
+  /** Returns the number of milliseconds */
+  StatExportData getViewer() const override;
+  bool isDefault() const override;
+  void printSafe(int fd) const override;
+  /** Returns the estimated overhead in milliseconds */
+  double get() const;
+
+  /** The timers of the registry */
+  std::vector<const StatisticTimerValue*> d_timers;
+  /** The cost of reading the clock in nanoseconds */
+  double d_clockCost = 0;
 };
 
 }  // namespace cvc5::internal
@@ -0,0 +1,105 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A pool of threads that runs batches of independent tasks.
+ */
+
+#include "util/thread_pool.h"
+
+namespace cvc5::internal {
+
+ThreadPool::ThreadPool(size_t numThreads)
+    : d_tasks(nullptr), d_next(0), d_pending(0), d_batch(0), d_stop(false)
+{
+  for (size_t i = 1; i < numThreads; ++i)
+  {
+    d_workers.emplace_back(&ThreadPool::work, this);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::unique_lock<std::mutex> lock(d_mutex);
+    d_stop = true;
+  }
+  d_start.notify_all();
+  for (std::thread& t : d_workers)
+  {
+    t.join();
+  }
+}
+
+void ThreadPool::run(const std::vector<std::function<void()>>& tasks)
+{
+  if (tasks.empty())
+  {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(d_mutex);
+  d_tasks = &tasks;
+  d_next = 0;
+  d_pending = tasks.size();
+  d_errors.assign(tasks.size(), nullptr);
+  ++d_batch;
+  d_start.notify_all();
+  runTasks(lock);
+  d_done.wait(lock, [this]() { return d_pending == 0; });
+  d_tasks = nullptr;
+  for (const std::exception_ptr& e : d_errors)
+  {
+    if (e)
+    {
+      std::rethrow_exception(e);
+    }
+  }
+}
+
+void ThreadPool::work()
+{
+  std::unique_lock<std::mutex> lock(d_mutex);
+  uint64_t seen = 0;
+  while (true)
+  {
+    d_start.wait(lock, [this, seen]() { return d_stop || d_batch != seen; });
+    if (d_stop)
+    {
+      return;
+    }
+    seen = d_batch;
+    runTasks(lock);
+  }
+}
+
+void ThreadPool::runTasks(std::unique_lock<std::mutex>& lock)
+{
+  while (d_tasks != nullptr && d_next < d_tasks->size())
+  {
+    size_t i = d_next++;
+    const std::function<void()>& task = (*d_tasks)[i];
+    lock.unlock();
+    std::exception_ptr error;
+    try
+    {
+      task();
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+    lock.lock();
+    d_errors[i] = error;
+    if (--d_pending == 0)
+    {
+      d_done.notify_all();
+    }
+  }
+}
+
+}  // namespace cvc5::internal
@@ -0,0 +1,87 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A pool of threads that runs batches of independent tasks.
+ */
+
+#include "cvc5_private_library.h"
+
+#ifndef CVC5__UTIL__THREAD_POOL_H
+#define CVC5__UTIL__THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cvc5::internal {
+
+/**
+ * A fixed set of worker threads that run batches of independent tasks.
+ *
+ * `run()` returns once every task of the batch is done, and the calling
+ * thread works on the batch as well. The tasks are expected to write their
+ * results to slots of their own, which the caller reads in the order of the
+ * tasks, so the outcome does not depend on how the tasks were scheduled.
+ *
+ * Only one batch runs at a time, `run()` must not be called from a task.
+ */
+class ThreadPool
+{
+ public:
+  /** Creates a pool that runs batches on numThreads threads in total */
+  explicit ThreadPool(size_t numThreads);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /** The number of threads, including the calling thread */
+  size_t getNumThreads() const { return d_workers.size() + 1; }
+
+  /**
+   * Runs all tasks and returns when they are done. If tasks throw, the
+   * exception of the first of them (in the order of tasks) is rethrown.
+   */
+  void run(const std::vector<std::function<void()>>& tasks);
+
+ private:
+  /** The loop of a worker thread */
+  void work();
+  /** Runs tasks of the current batch until there are none left */
+  void runTasks(std::unique_lock<std::mutex>& lock);
+
+  /** The worker threads */
+  std::vector<std::thread> d_workers;
+  /** Guards all of the following */
+  std::mutex d_mutex;
+  /** Notified when a batch starts or the pool is destroyed */
+  std::condition_variable d_start;
+  /** Notified when the last task of a batch is done */
+  std::condition_variable d_done;
+  /** The current batch */
+  const std::vector<std::function<void()>>* d_tasks;
+  /** The index of the next task to start */
+  size_t d_next;
+  /** The number of tasks that are not done */
+  size_t d_pending;
+  /** Incremented for every batch, so workers join each batch once */
+  uint64_t d_batch;
+  /** The exceptions thrown by the tasks of the current batch */
+  std::vector<std::exception_ptr> d_errors;
+  /** Set when the pool is destroyed */
+  bool d_stop;
+};
+
+}  // namespace cvc5::internal
+
+#endif /* CVC5__UTIL__THREAD_POOL_H */
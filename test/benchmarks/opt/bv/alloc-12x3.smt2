@@ -0,0 +1,36 @@
+; Allocating tasks with given demands to servers, minimizing the peak load.
+(set-logic QF_BV)
+(declare-const a0 (_ BitVec 2))
+(declare-const a1 (_ BitVec 2))
+(declare-const a2 (_ BitVec 2))
+(declare-const a3 (_ BitVec 2))
+(declare-const a4 (_ BitVec 2))
+(declare-const a5 (_ BitVec 2))
+(declare-const a6 (_ BitVec 2))
+(declare-const a7 (_ BitVec 2))
+(declare-const a8 (_ BitVec 2))
+(declare-const a9 (_ BitVec 2))
+(declare-const a10 (_ BitVec 2))
+(declare-const a11 (_ BitVec 2))
+(declare-const peak (_ BitVec 12))
+(assert (bvult a0 #b11))
+(assert (bvult a1 #b11))
+(assert (bvult a2 #b11))
+(assert (bvult a3 #b11))
+(assert (bvult a4 #b11))
+(assert (bvult a5 #b11))
+(assert (bvult a6 #b11))
+(assert (bvult a7 #b11))
+(assert (bvult a8 #b11))
+(assert (bvult a9 #b11))
+(assert (bvult a10 #b11))
+(assert (bvult a11 #b11))
+(assert (bvule (bvadd (ite (= a0 #b00) #x012 #x000) (ite (= a1 #b00) #x028 #x000) (ite (= a2 #b00) #x025 #x000) (ite (= a3 #b00) #x00b #x000) (ite (= a4 #b00) #x01a #x000) (ite (= a5 #b00) #x021 #x000) (ite (= a6 #b00) #x028 #x000) (ite (= a7 #b00) #x007 #x000) (ite (= a8 #b00) #x003 #x000) (ite (= a9 #b00) #x021 #x000) (ite (= a10 #b00) #x013 #x000) (ite (= a11 #b00) #x026 #x000)) peak))
+(assert (bvule (bvadd (ite (= a0 #b01) #x012 #x000) (ite (= a1 #b01) #x028 #x000) (ite (= a2 #b01) #x025 #x000) (ite (= a3 #b01) #x00b #x000) (ite (= a4 #b01) #x01a #x000) (ite (= a5 #b01) #x021 #x000) (ite (= a6 #b01) #x028 #x000) (ite (= a7 #b01) #x007 #x000) (ite (= a8 #b01) #x003 #x000) (ite (= a9 #b01) #x021 #x000) (ite (= a10 #b01) #x013 #x000) (ite (= a11 #b01) #x026 #x000)) peak))
+(assert (bvule (bvadd (ite (= a0 #b10) #x012 #x000) (ite (= a1 #b10) #x028 #x000) (ite (= a2 #b10) #x025 #x000) (ite (= a3 #b10) #x00b #x000) (ite (= a4 #b10) #x01a #x000) (ite (= a5 #b10) #x021 #x000) (ite (= a6 #b10) #x028 #x000) (ite (= a7 #b10) #x007 #x000) (ite (= a8 #b10) #x003 #x000) (ite (= a9 #b10) #x021 #x000) (ite (= a10 #b10) #x013 #x000) (ite (= a11 #b10) #x026 #x000)) peak))
+(assert (distinct a1 a0))
+(assert (distinct a6 a1))
+(assert (distinct a11 a9))
+(minimize peak)
+(check-opt)
+(get-value (peak))
@@ -0,0 +1,28 @@
+; Allocating tasks with given demands to servers, minimizing the peak load.
+(set-logic QF_BV)
+(declare-const a0 (_ BitVec 2))
+(declare-const a1 (_ BitVec 2))
+(declare-const a2 (_ BitVec 2))
+(declare-const a3 (_ BitVec 2))
+(declare-const a4 (_ BitVec 2))
+(declare-const a5 (_ BitVec 2))
+(declare-const a6 (_ BitVec 2))
+(declare-const a7 (_ BitVec 2))
+(declare-const a8 (_ BitVec 2))
+(declare-const a9 (_ BitVec 2))
+(declare-const a10 (_ BitVec 2))
+(declare-const a11 (_ BitVec 2))
+(declare-const a12 (_ BitVec 2))
+(declare-const a13 (_ BitVec 2))
+(declare-const a14 (_ BitVec 2))
+(declare-const a15 (_ BitVec 2))
+(declare-const peak (_ BitVec 12))
+(assert (bvule (bvadd (ite (= a0 #b00) #x012 #x000) (ite (= a1 #b00) #x016 #x000) (ite (= a2 #b00) #x009 #x000) (ite (= a3 #b00) #x01c #x000) (ite (= a4 #b00) #x021 #x000) (ite (= a5 #b00) #x00c #x000) (ite (= a6 #b00) #x008 #x000) (ite (= a7 #b00) #x007 #x000) (ite (= a8 #b00) #x004 #x000) (ite (= a9 #b00) #x01c #x000) (ite (= a10 #b00) #x026 #x000) (ite (= a11 #b00) #x015 #x000) (ite (= a12 #b00) #x006 #x000) (ite (= a13 #b00) #x011 #x000) (ite (= a14 #b00) #x024 #x000) (ite (= a15 #b00) #x025 #x000)) peak))
+(assert (bvule (bvadd (ite (= a0 #b01) #x012 #x000) (ite (= a1 #b01) #x016 #x000) (ite (= a2 #b01) #x009 #x000) (ite (= a3 #b01) #x01c #x000) (ite (= a4 #b01) #x021 #x000) (ite (= a5 #b01) #x00c #x000) (ite (= a6 #b01) #x008 #x000) (ite (= a7 #b01) #x007 #x000) (ite (= a8 #b01) #x004 #x000) (ite (= a9 #b01) #x01c #x000) (ite (= a10 #b01) #x026 #x000) (ite (= a11 #b01) #x015 #x000) (ite (= a12 #b01) #x006 #x000) (ite (= a13 #b01) #x011 #x000) (ite (= a14 #b01) #x024 #x000) (ite (= a15 #b01) #x025 #x000)) peak))
+(assert (bvule (bvadd (ite (= a0 #b10) #x012 #x000) (ite (= a1 #b10) #x016 #x000) (ite (= a2 #b10) #x009 #x000) (ite (= a3 #b10) #x01c #x000) (ite (= a4 #b10) #x021 #x000) (ite (= a5 #b10) #x00c #x000) (ite (= a6 #b10) #x008 #x000) (ite (= a7 #b10) #x007 #x000) (ite (= a8 #b10) #x004 #x000) (ite (= a9 #b10) #x01c #x000) (ite (= a10 #b10) #x026 #x000) (ite (= a11 #b10) #x015 #x000) (ite (= a12 #b10) #x006 #x000) (ite (= a13 #b10) #x011 #x000) (ite (= a14 #b10) #x024 #x000) (ite (= a15 #b10) #x025 #x000)) peak))
+(assert (bvule (bvadd (ite (= a0 #b11) #x012 #x000) (ite (= a1 #b11) #x016 #x000) (ite (= a2 #b11) #x009 #x000) (ite (= a3 #b11) #x01c #x000) (ite (= a4 #b11) #x021 #x000) (ite (= a5 #b11) #x00c #x000) (ite (= a6 #b11) #x008 #x000) (ite (= a7 #b11) #x007 #x000) (ite (= a8 #b11) #x004 #x000) (ite (= a9 #b11) #x01c #x000) (ite (= a10 #b11) #x026 #x000) (ite (= a11 #b11) #x015 #x000) (ite (= a12 #b11) #x006 #x000) (ite (= a13 #b11) #x011 #x000) (ite (= a14 #b11) #x024 #x000) (ite (= a15 #b11) #x025 #x000)) peak))
+(assert (distinct a6 a5))
+(assert (distinct a9 a4))
+(minimize peak)
+(check-opt)
+(get-value (peak))
@@ -0,0 +1,59 @@
+; Scheduling jobs of given durations without overlap, minimizing the makespan.
+(set-logic QF_LIA)
+(declare-const s0 Int)
+(declare-const s1 Int)
+(declare-const s2 Int)
+(declare-const s3 Int)
+(declare-const s4 Int)
+(declare-const s5 Int)
+(declare-const s6 Int)
+(declare-const s7 Int)
+(declare-const makespan Int)
+(assert (>= s0 0))
+(assert (>= makespan (+ s0 4)))
+(assert (>= s1 0))
+(assert (>= makespan (+ s1 3)))
+(assert (>= s2 0))
+(assert (>= makespan (+ s2 6)))
+(assert (>= s3 0))
+(assert (>= makespan (+ s3 3)))
+(assert (>= s4 0))
+(assert (>= makespan (+ s4 9)))
+(assert (>= s5 0))
+(assert (>= makespan (+ s5 9)))
+(assert (>= s6 0))
+(assert (>= makespan (+ s6 9)))
+(assert (>= s7 0))
+(assert (>= makespan (+ s7 8)))
+(assert (>= s2 (+ s0 4)))
+(assert (or (>= s1 (+ s0 4)) (>= s0 (+ s1 3))))
+(assert (or (>= s2 (+ s0 4)) (>= s0 (+ s2 6))))
+(assert (or (>= s3 (+ s0 4)) (>= s0 (+ s3 3))))
+(assert (or (>= s4 (+ s0 4)) (>= s0 (+ s4 9))))
+(assert (or (>= s5 (+ s0 4)) (>= s0 (+ s5 9))))
+(assert (or (>= s6 (+ s0 4)) (>= s0 (+ s6 9))))
+(assert (or (>= s7 (+ s0 4)) (>= s0 (+ s7 8))))
+(assert (or (>= s2 (+ s1 3)) (>= s1 (+ s2 6))))
+(assert (or (>= s3 (+ s1 3)) (>= s1 (+ s3 3))))
+(assert (or (>= s4 (+ s1 3)) (>= s1 (+ s4 9))))
+(assert (or (>= s5 (+ s1 3)) (>= s1 (+ s5 9))))
+(assert (or (>= s6 (+ s1 3)) (>= s1 (+ s6 9))))
+(assert (or (>= s7 (+ s1 3)) (>= s1 (+ s7 8))))
+(assert (or (>= s3 (+ s2 6)) (>= s2 (+ s3 3))))
+(assert (or (>= s4 (+ s2 6)) (>= s2 (+ s4 9))))
+(assert (or (>= s5 (+ s2 6)) (>= s2 (+ s5 9))))
+(assert (or (>= s6 (+ s2 6)) (>= s2 (+ s6 9))))
+(assert (or (>= s7 (+ s2 6)) (>= s2 (+ s7 8))))
+(assert (or (>= s4 (+ s3 3)) (>= s3 (+ s4 9))))
+(assert (or (>= s5 (+ s3 3)) (>= s3 (+ s5 9))))
+(assert (or (>= s6 (+ s3 3)) (>= s3 (+ s6 9))))
+(assert (or (>= s7 (+ s3 3)) (>= s3 (+ s7 8))))
+(assert (or (>= s5 (+ s4 9)) (>= s4 (+ s5 9))))
+(assert (or (>= s6 (+ s4 9)) (>= s4 (+ s6 9))))
+(assert (or (>= s7 (+ s4 9)) (>= s4 (+ s7 8))))
+(assert (or (>= s6 (+ s5 9)) (>= s5 (+ s6 9))))
+(assert (or (>= s7 (+ s5 9)) (>= s5 (+ s7 8))))
+(assert (or (>= s7 (+ s6 9)) (>= s6 (+ s7 8))))
+(minimize makespan)
+(check-opt)
+(get-value (makespan))
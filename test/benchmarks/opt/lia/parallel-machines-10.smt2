@@ -0,0 +1,101 @@
+; Scheduling jobs of given durations without overlap, minimizing the makespan.
+(set-logic QF_LIA)
+(declare-const s0 Int)
+(declare-const s1 Int)
+(declare-const s2 Int)
+(declare-const s3 Int)
+(declare-const s4 Int)
+(declare-const s5 Int)
+(declare-const s6 Int)
+(declare-const s7 Int)
+(declare-const s8 Int)
+(declare-const s9 Int)
+(declare-const m0 Int)
+(declare-const m1 Int)
+(declare-const m2 Int)
+(declare-const m3 Int)
+(declare-const m4 Int)
+(declare-const m5 Int)
+(declare-const m6 Int)
+(declare-const m7 Int)
+(declare-const m8 Int)
+(declare-const m9 Int)
+(declare-const makespan Int)
+(assert (>= s0 0))
+(assert (>= makespan (+ s0 2)))
+(assert (<= 0 m0 1))
+(assert (>= s1 0))
+(assert (>= makespan (+ s1 3)))
+(assert (<= 0 m1 1))
+(assert (>= s2 0))
+(assert (>= makespan (+ s2 3)))
+(assert (<= 0 m2 1))
+(assert (>= s3 0))
+(assert (>= makespan (+ s3 7)))
+(assert (<= 0 m3 1))
+(assert (>= s4 0))
+(assert (>= makespan (+ s4 4)))
+(assert (<= 0 m4 1))
+(assert (>= s5 0))
+(assert (>= makespan (+ s5 6)))
+(assert (<= 0 m5 1))
+(assert (>= s6 0))
+(assert (>= makespan (+ s6 6)))
+(assert (<= 0 m6 1))
+(assert (>= s7 0))
+(assert (>= makespan (+ s7 5)))
+(assert (<= 0 m7 1))
+(assert (>= s8 0))
+(assert (>= makespan (+ s8 2)))
+(assert (<= 0 m8 1))
+(assert (>= s9 0))
+(assert (>= makespan (+ s9 4)))
+(assert (<= 0 m9 1))
+(assert (or (distinct m0 m1) (or (>= s1 (+ s0 2)) (>= s0 (+ s1 3)))))
+(assert (or (distinct m0 m2) (or (>= s2 (+ s0 2)) (>= s0 (+ s2 3)))))
+(assert (or (distinct m0 m3) (or (>= s3 (+ s0 2)) (>= s0 (+ s3 7)))))
+(assert (or (distinct m0 m4) (or (>= s4 (+ s0 2)) (>= s0 (+ s4 4)))))
+(assert (or (distinct m0 m5) (or (>= s5 (+ s0 2)) (>= s0 (+ s5 6)))))
+(assert (or (distinct m0 m6) (or (>= s6 (+ s0 2)) (>= s0 (+ s6 6)))))
+(assert (or (distinct m0 m7) (or (>= s7 (+ s0 2)) (>= s0 (+ s7 5)))))
+(assert (or (distinct m0 m8) (or (>= s8 (+ s0 2)) (>= s0 (+ s8 2)))))
+(assert (or (distinct m0 m9) (or (>= s9 (+ s0 2)) (>= s0 (+ s9 4)))))
+(assert (or (distinct m1 m2) (or (>= s2 (+ s1 3)) (>= s1 (+ s2 3)))))
+(assert (or (distinct m1 m3) (or (>= s3 (+ s1 3)) (>= s1 (+ s3 7)))))
+(assert (or (distinct m1 m4) (or (>= s4 (+ s1 3)) (>= s1 (+ s4 4)))))
+(assert (or (distinct m1 m5) (or (>= s5 (+ s1 3)) (>= s1 (+ s5 6)))))
+(assert (or (distinct m1 m6) (or (>= s6 (+ s1 3)) (>= s1 (+ s6 6)))))
+(assert (or (distinct m1 m7) (or (>= s7 (+ s1 3)) (>= s1 (+ s7 5)))))
+(assert (or (distinct m1 m8) (or (>= s8 (+ s1 3)) (>= s1 (+ s8 2)))))
+(assert (or (distinct m1 m9) (or (>= s9 (+ s1 3)) (>= s1 (+ s9 4)))))
+(assert (or (distinct m2 m3) (or (>= s3 (+ s2 3)) (>= s2 (+ s3 7)))))
+(assert (or (distinct m2 m4) (or (>= s4 (+ s2 3)) (>= s2 (+ s4 4)))))
+(assert (or (distinct m2 m5) (or (>= s5 (+ s2 3)) (>= s2 (+ s5 6)))))
+(assert (or (distinct m2 m6) (or (>= s6 (+ s2 3)) (>= s2 (+ s6 6)))))
+(assert (or (distinct m2 m7) (or (>= s7 (+ s2 3)) (>= s2 (+ s7 5)))))
+(assert (or (distinct m2 m8) (or (>= s8 (+ s2 3)) (>= s2 (+ s8 2)))))
+(assert (or (distinct m2 m9) (or (>= s9 (+ s2 3)) (>= s2 (+ s9 4)))))
+(assert (or (distinct m3 m4) (or (>= s4 (+ s3 7)) (>= s3 (+ s4 4)))))
+(assert (or (distinct m3 m5) (or (>= s5 (+ s3 7)) (>= s3 (+ s5 6)))))
+(assert (or (distinct m3 m6) (or (>= s6 (+ s3 7)) (>= s3 (+ s6 6)))))
+(assert (or (distinct m3 m7) (or (>= s7 (+ s3 7)) (>= s3 (+ s7 5)))))
+(assert (or (distinct m3 m8) (or (>= s8 (+ s3 7)) (>= s3 (+ s8 2)))))
+(assert (or (distinct m3 m9) (or (>= s9 (+ s3 7)) (>= s3 (+ s9 4)))))
+(assert (or (distinct m4 m5) (or (>= s5 (+ s4 4)) (>= s4 (+ s5 6)))))
+(assert (or (distinct m4 m6) (or (>= s6 (+ s4 4)) (>= s4 (+ s6 6)))))
+(assert (or (distinct m4 m7) (or (>= s7 (+ s4 4)) (>= s4 (+ s7 5)))))
+(assert (or (distinct m4 m8) (or (>= s8 (+ s4 4)) (>= s4 (+ s8 2)))))
+(assert (or (distinct m4 m9) (or (>= s9 (+ s4 4)) (>= s4 (+ s9 4)))))
+(assert (or (distinct m5 m6) (or (>= s6 (+ s5 6)) (>= s5 (+ s6 6)))))
+(assert (or (distinct m5 m7) (or (>= s7 (+ s5 6)) (>= s5 (+ s7 5)))))
+(assert (or (distinct m5 m8) (or (>= s8 (+ s5 6)) (>= s5 (+ s8 2)))))
+(assert (or (distinct m5 m9) (or (>= s9 (+ s5 6)) (>= s5 (+ s9 4)))))
+(assert (or (distinct m6 m7) (or (>= s7 (+ s6 6)) (>= s6 (+ s7 5)))))
+(assert (or (distinct m6 m8) (or (>= s8 (+ s6 6)) (>= s6 (+ s8 2)))))
+(assert (or (distinct m6 m9) (or (>= s9 (+ s6 6)) (>= s6 (+ s9 4)))))
+(assert (or (distinct m7 m8) (or (>= s8 (+ s7 5)) (>= s7 (+ s8 2)))))
+(assert (or (distinct m7 m9) (or (>= s9 (+ s7 5)) (>= s7 (+ s9 4)))))
+(assert (or (distinct m8 m9) (or (>= s9 (+ s8 2)) (>= s8 (+ s9 4)))))
+(minimize makespan)
+(check-opt)
+(get-value (makespan))
@@ -0,0 +1,79 @@
+; A random linear program over non-negative reals.
+(set-logic QF_LRA)
+(declare-const x0 Real)
+(declare-const x1 Real)
+(declare-const x2 Real)
+(declare-const x3 Real)
+(declare-const x4 Real)
+(declare-const x5 Real)
+(declare-const x6 Real)
+(declare-const x7 Real)
+(declare-const x8 Real)
+(declare-const x9 Real)
+(declare-const x10 Real)
+(declare-const x11 Real)
+(declare-const x12 Real)
+(declare-const x13 Real)
+(declare-const x14 Real)
+(declare-const x15 Real)
+(declare-const x16 Real)
+(declare-const x17 Real)
+(declare-const x18 Real)
+(declare-const x19 Real)
+(assert (>= x0 0.0))
+(assert (>= x1 0.0))
+(assert (>= x2 0.0))
+(assert (>= x3 0.0))
+(assert (>= x4 0.0))
+(assert (>= x5 0.0))
+(assert (>= x6 0.0))
+(assert (>= x7 0.0))
+(assert (>= x8 0.0))
+(assert (>= x9 0.0))
+(assert (>= x10 0.0))
+(assert (>= x11 0.0))
+(assert (>= x12 0.0))
+(assert (>= x13 0.0))
+(assert (>= x14 0.0))
+(assert (>= x15 0.0))
+(assert (>= x16 0.0))
+(assert (>= x17 0.0))
+(assert (>= x18 0.0))
+(assert (>= x19 0.0))
+(assert (<= (+ (* 3.0 x0) (* 1.0 x1) (* 9.0 x2) (* 1.0 x3) (* 2.0 x5) (* 2.0 x6) (* 9.0 x7) (* 2.0 x8) (* 7.0 x12) (* 4.0 x13) (* 3.0 x14) (* 3.0 x15) 0.0) 33.0))
+(assert (<= (+ (* 9.0 x2) (* 9.0 x6) (* 6.0 x7) (* 8.0 x8) (* 4.0 x9) (* 5.0 x12) (* 2.0 x16) (* 7.0 x17) (* 6.0 x18) (* 8.0 x19) 0.0) 73.0))
+(assert (<= (+ (* 2.0 x0) (* 6.0 x4) (* 2.0 x7) (* 2.0 x9) (* 5.0 x10) (* 7.0 x14) (* 8.0 x16) (* 2.0 x17) (* 4.0 x18) 0.0) 36.0))
+(assert (<= (+ (* 8.0 x1) (* 8.0 x2) (* 5.0 x3) (* 7.0 x7) (* 4.0 x10) (* 3.0 x11) (* 4.0 x12) (* 3.0 x13) (* 1.0 x14) (* 9.0 x15) (* 6.0 x16) 0.0) 99.0))
+(assert (<= (+ (* 9.0 x2) (* 7.0 x3) (* 8.0 x4) (* 2.0 x6) (* 2.0 x8) (* 1.0 x9) (* 3.0 x10) (* 4.0 x14) (* 5.0 x16) (* 2.0 x19) 0.0) 82.0))
+(assert (<= (+ (* 8.0 x1) (* 3.0 x2) (* 6.0 x3) (* 3.0 x5) (* 9.0 x7) (* 9.0 x8) (* 2.0 x11) (* 6.0 x13) (* 4.0 x15) (* 4.0 x18) 0.0) 44.0))
+(assert (<= (+ (* 9.0 x3) (* 1.0 x4) (* 4.0 x7) (* 6.0 x10) (* 4.0 x12) (* 8.0 x13) (* 4.0 x14) (* 1.0 x15) (* 6.0 x16) (* 2.0 x18) 0.0) 45.0))
+(assert (<= (+ (* 3.0 x0) (* 6.0 x1) (* 7.0 x2) (* 2.0 x3) (* 3.0 x5) (* 8.0 x6) (* 8.0 x8) (* 9.0 x10) (* 2.0 x12) (* 4.0 x15) (* 5.0 x17) (* 9.0 x18) (* 6.0 x19) 0.0) 53.0))
+(assert (<= (+ (* 6.0 x2) (* 3.0 x9) (* 8.0 x11) (* 3.0 x15) (* 2.0 x16) (* 9.0 x18) 0.0) 81.0))
+(assert (<= (+ (* 9.0 x1) (* 4.0 x2) (* 2.0 x3) (* 9.0 x8) (* 5.0 x10) (* 9.0 x11) (* 9.0 x14) (* 9.0 x17) (* 8.0 x19) 0.0) 37.0))
+(assert (<= (+ (* 7.0 x0) (* 2.0 x1) (* 4.0 x3) (* 6.0 x7) (* 3.0 x8) (* 2.0 x10) (* 8.0 x11) (* 4.0 x12) (* 7.0 x13) (* 7.0 x15) (* 6.0 x16) (* 6.0 x17) (* 9.0 x18) (* 1.0 x19) 0.0) 69.0))
+(assert (<= (+ (* 5.0 x0) (* 4.0 x2) (* 5.0 x4) (* 3.0 x5) (* 3.0 x6) (* 9.0 x11) (* 1.0 x15) (* 2.0 x17) (* 1.0 x18) 0.0) 53.0))
+(assert (<= (+ (* 4.0 x0) (* 2.0 x1) (* 6.0 x2) (* 5.0 x4) (* 4.0 x6) (* 3.0 x9) (* 5.0 x10) (* 8.0 x13) (* 6.0 x15) (* 1.0 x18) 0.0) 90.0))
+(assert (<= (+ (* 8.0 x2) (* 7.0 x3) (* 4.0 x8) (* 3.0 x10) (* 6.0 x11) (* 5.0 x14) (* 1.0 x15) (* 7.0 x16) (* 4.0 x19) 0.0) 57.0))
+(assert (<= (+ (* 3.0 x0) (* 8.0 x1) (* 6.0 x2) (* 5.0 x6) (* 3.0 x7) (* 7.0 x8) (* 5.0 x9) (* 9.0 x11) (* 2.0 x13) (* 1.0 x14) (* 5.0 x15) (* 4.0 x16) (* 9.0 x17) (* 7.0 x19) 0.0) 61.0))
+(assert (<= x0 28.0))
+(assert (<= x1 20.0))
+(assert (<= x2 9.0))
+(assert (<= x3 14.0))
+(assert (<= x4 28.0))
+(assert (<= x5 24.0))
+(assert (<= x6 25.0))
+(assert (<= x7 9.0))
+(assert (<= x8 6.0))
+(assert (<= x9 27.0))
+(assert (<= x10 21.0))
+(assert (<= x11 25.0))
+(assert (<= x12 18.0))
+(assert (<= x13 28.0))
+(assert (<= x14 27.0))
+(assert (<= x15 30.0))
+(assert (<= x16 21.0))
+(assert (<= x17 9.0))
+(assert (<= x18 21.0))
+(assert (<= x19 29.0))
+(maximize (+ (* 9.0 x0) (* 1.0 x1) (* 4.0 x2) (* 2.0 x3) (* 1.0 x4) (* 1.0 x5) (* 3.0 x6) (* 6.0 x7) (* 2.0 x8) (* 7.0 x9) (* 8.0 x10) (* 9.0 x11) (* 1.0 x12) (* 1.0 x13) (* 9.0 x14) (* 4.0 x15) (* 8.0 x16) (* 5.0 x17) (* 1.0 x18) (* 8.0 x19)))
+(check-opt)
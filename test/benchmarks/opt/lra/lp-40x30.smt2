@@ -0,0 +1,154 @@
+; A random linear program over non-negative reals.
+(set-logic QF_LRA)
+(declare-const x0 Real)
+(declare-const x1 Real)
+(declare-const x2 Real)
+(declare-const x3 Real)
+(declare-const x4 Real)
+(declare-const x5 Real)
+(declare-const x6 Real)
+(declare-const x7 Real)
+(declare-const x8 Real)
+(declare-const x9 Real)
+(declare-const x10 Real)
+(declare-const x11 Real)
+(declare-const x12 Real)
+(declare-const x13 Real)
+(declare-const x14 Real)
+(declare-const x15 Real)
+(declare-const x16 Real)
+(declare-const x17 Real)
+(declare-const x18 Real)
+(declare-const x19 Real)
+(declare-const x20 Real)
+(declare-const x21 Real)
+(declare-const x22 Real)
+(declare-const x23 Real)
+(declare-const x24 Real)
+(declare-const x25 Real)
+(declare-const x26 Real)
+(declare-const x27 Real)
+(declare-const x28 Real)
+(declare-const x29 Real)
+(declare-const x30 Real)
+(declare-const x31 Real)
+(declare-const x32 Real)
+(declare-const x33 Real)
+(declare-const x34 Real)
+(declare-const x35 Real)
+(declare-const x36 Real)
+(declare-const x37 Real)
+(declare-const x38 Real)
+(declare-const x39 Real)
+(assert (>= x0 0.0))
+(assert (>= x1 0.0))
+(assert (>= x2 0.0))
+(assert (>= x3 0.0))
+(assert (>= x4 0.0))
+(assert (>= x5 0.0))
+(assert (>= x6 0.0))
+(assert (>= x7 0.0))
+(assert (>= x8 0.0))
+(assert (>= x9 0.0))
+(assert (>= x10 0.0))
+(assert (>= x11 0.0))
+(assert (>= x12 0.0))
+(assert (>= x13 0.0))
+(assert (>= x14 0.0))
+(assert (>= x15 0.0))
+(assert (>= x16 0.0))
+(assert (>= x17 0.0))
+(assert (>= x18 0.0))
+(assert (>= x19 0.0))
+(assert (>= x20 0.0))
+(assert (>= x21 0.0))
+(assert (>= x22 0.0))
+(assert (>= x23 0.0))
+(assert (>= x24 0.0))
+(assert (>= x25 0.0))
+(assert (>= x26 0.0))
+(assert (>= x27 0.0))
+(assert (>= x28 0.0))
+(assert (>= x29 0.0))
+(assert (>= x30 0.0))
+(assert (>= x31 0.0))
+(assert (>= x32 0.0))
+(assert (>= x33 0.0))
+(assert (>= x34 0.0))
+(assert (>= x35 0.0))
+(assert (>= x36 0.0))
+(assert (>= x37 0.0))
+(assert (>= x38 0.0))
+(assert (>= x39 0.0))
+(assert (<= (+ (* 7.0 x0) (* 1.0 x1) (* 4.0 x2) (* 1.0 x5) (* 8.0 x6) (* 4.0 x7) (* 8.0 x9) (* 1.0 x10) (* 7.0 x13) (* 2.0 x16) (* 7.0 x17) (* 1.0 x18) (* 2.0 x19) (* 9.0 x20) (* 2.0 x23) (* 4.0 x25) (* 8.0 x26) (* 6.0 x29) (* 3.0 x31) (* 6.0 x33) (* 3.0 x38) (* 5.0 x39) 0.0) 85.0))
+(assert (<= (+ (* 1.0 x5) (* 4.0 x6) (* 7.0 x7) (* 5.0 x8) (* 7.0 x11) (* 1.0 x12) (* 3.0 x13) (* 1.0 x14) (* 3.0 x16) (* 8.0 x19) (* 2.0 x20) (* 2.0 x22) (* 2.0 x23) (* 9.0 x26) (* 3.0 x27) (* 1.0 x29) (* 2.0 x31) (* 6.0 x33) (* 8.0 x34) (* 1.0 x35) 0.0) 42.0))
+(assert (<= (+ (* 7.0 x0) (* 2.0 x1) (* 4.0 x2) (* 8.0 x3) (* 2.0 x5) (* 3.0 x7) (* 8.0 x10) (* 1.0 x13) (* 8.0 x14) (* 4.0 x15) (* 6.0 x19) (* 7.0 x28) (* 5.0 x31) (* 5.0 x36) (* 7.0 x37) (* 6.0 x39) 0.0) 86.0))
+(assert (<= (+ (* 6.0 x0) (* 2.0 x2) (* 6.0 x3) (* 5.0 x4) (* 7.0 x5) (* 7.0 x13) (* 9.0 x14) (* 3.0 x16) (* 5.0 x17) (* 9.0 x23) (* 7.0 x24) (* 4.0 x25) (* 9.0 x29) (* 2.0 x31) (* 3.0 x33) (* 4.0 x38) 0.0) 31.0))
+(assert (<= (+ (* 8.0 x0) (* 6.0 x4) (* 1.0 x7) (* 3.0 x9) (* 2.0 x11) (* 5.0 x15) (* 2.0 x18) (* 3.0 x21) (* 7.0 x22) (* 2.0 x23) (* 4.0 x24) (* 3.0 x25) (* 4.0 x26) (* 1.0 x27) (* 3.0 x28) (* 4.0 x31) (* 2.0 x33) (* 6.0 x36) (* 3.0 x37) (* 8.0 x38) (* 8.0 x39) 0.0) 94.0))
+(assert (<= (+ (* 7.0 x1) (* 6.0 x7) (* 5.0 x10) (* 3.0 x12) (* 9.0 x14) (* 4.0 x17) (* 3.0 x19) (* 7.0 x22) (* 6.0 x23) (* 7.0 x25) (* 1.0 x28) (* 3.0 x29) (* 3.0 x30) (* 9.0 x36) (* 6.0 x37) (* 6.0 x39) 0.0) 33.0))
+(assert (<= (+ (* 3.0 x0) (* 6.0 x2) (* 1.0 x5) (* 4.0 x10) (* 8.0 x12) (* 5.0 x14) (* 5.0 x19) (* 8.0 x20) (* 2.0 x21) (* 8.0 x22) (* 2.0 x23) (* 8.0 x24) (* 7.0 x25) (* 9.0 x26) (* 3.0 x28) (* 9.0 x30) (* 7.0 x33) (* 4.0 x34) (* 8.0 x36) (* 6.0 x38) (* 1.0 x39) 0.0) 22.0))
+(assert (<= (+ (* 4.0 x3) (* 2.0 x4) (* 1.0 x5) (* 7.0 x9) (* 3.0 x11) (* 6.0 x12) (* 1.0 x14) (* 4.0 x15) (* 8.0 x17) (* 3.0 x18) (* 7.0 x19) (* 5.0 x21) (* 4.0 x24) (* 2.0 x27) (* 6.0 x32) (* 2.0 x33) (* 9.0 x34) (* 8.0 x37) 0.0) 99.0))
+(assert (<= (+ (* 3.0 x0) (* 4.0 x1) (* 3.0 x3) (* 4.0 x6) (* 3.0 x7) (* 8.0 x9) (* 3.0 x10) (* 1.0 x13) (* 5.0 x15) (* 7.0 x16) (* 1.0 x20) (* 9.0 x21) (* 1.0 x25) (* 8.0 x29) (* 3.0 x31) (* 8.0 x32) (* 9.0 x33) (* 4.0 x34) (* 6.0 x36) (* 6.0 x37) 0.0) 82.0))
+(assert (<= (+ (* 1.0 x1) (* 8.0 x2) (* 9.0 x4) (* 9.0 x7) (* 6.0 x17) (* 3.0 x22) (* 6.0 x23) (* 1.0 x24) (* 4.0 x27) (* 4.0 x31) (* 2.0 x32) (* 3.0 x35) (* 9.0 x36) (* 3.0 x37) (* 4.0 x39) 0.0) 44.0))
+(assert (<= (+ (* 7.0 x0) (* 6.0 x1) (* 9.0 x2) (* 6.0 x6) (* 2.0 x7) (* 8.0 x8) (* 8.0 x9) (* 3.0 x10) (* 3.0 x11) (* 6.0 x12) (* 2.0 x15) (* 7.0 x17) (* 4.0 x21) (* 9.0 x22) (* 9.0 x26) (* 6.0 x27) (* 3.0 x29) (* 4.0 x34) (* 1.0 x35) (* 3.0 x38) 0.0) 83.0))
+(assert (<= (+ (* 9.0 x0) (* 8.0 x1) (* 8.0 x4) (* 8.0 x5) (* 1.0 x7) (* 9.0 x10) (* 7.0 x12) (* 5.0 x13) (* 3.0 x16) (* 1.0 x20) (* 2.0 x21) (* 4.0 x22) (* 6.0 x24) (* 2.0 x27) (* 4.0 x28) (* 7.0 x30) (* 1.0 x31) (* 7.0 x32) (* 9.0 x33) (* 1.0 x34) (* 6.0 x39) 0.0) 100.0))
+(assert (<= (+ (* 5.0 x1) (* 1.0 x3) (* 3.0 x6) (* 9.0 x7) (* 1.0 x9) (* 5.0 x12) (* 5.0 x13) (* 5.0 x14) (* 8.0 x17) (* 5.0 x28) (* 9.0 x29) (* 1.0 x30) (* 8.0 x31) 0.0) 36.0))
+(assert (<= (+ (* 5.0 x9) (* 9.0 x10) (* 2.0 x13) (* 8.0 x16) (* 9.0 x19) (* 6.0 x25) (* 9.0 x26) (* 9.0 x27) (* 5.0 x28) (* 7.0 x29) (* 8.0 x32) (* 3.0 x36) (* 4.0 x38) (* 1.0 x39) 0.0) 68.0))
+(assert (<= (+ (* 2.0 x1) (* 5.0 x2) (* 3.0 x3) (* 2.0 x5) (* 2.0 x8) (* 1.0 x11) (* 6.0 x13) (* 1.0 x15) (* 7.0 x18) (* 8.0 x19) (* 6.0 x20) (* 1.0 x21) (* 8.0 x22) (* 9.0 x23) (* 5.0 x24) (* 4.0 x26) (* 9.0 x27) (* 8.0 x28) (* 5.0 x29) (* 1.0 x32) (* 1.0 x33) (* 2.0 x35) (* 3.0 x38) (* 8.0 x39) 0.0) 83.0))
+(assert (<= (+ (* 1.0 x2) (* 9.0 x4) (* 6.0 x6) (* 9.0 x8) (* 1.0 x9) (* 8.0 x10) (* 2.0 x11) (* 9.0 x12) (* 6.0 x17) (* 8.0 x22) (* 6.0 x25) (* 5.0 x26) (* 1.0 x27) (* 2.0 x29) (* 3.0 x32) (* 1.0 x33) (* 4.0 x34) (* 4.0 x36) (* 9.0 x37) (* 3.0 x39) 0.0) 99.0))
+(assert (<= (+ (* 5.0 x0) (* 3.0 x1) (* 2.0 x4) (* 4.0 x5) (* 5.0 x12) (* 3.0 x13) (* 7.0 x15) (* 7.0 x16) (* 1.0 x18) (* 3.0 x20) (* 8.0 x21) (* 5.0 x22) (* 2.0 x23) (* 3.0 x24) (* 1.0 x26) (* 1.0 x27) (* 8.0 x30) (* 8.0 x32) (* 8.0 x33) (* 6.0 x36) (* 4.0 x38) 0.0) 70.0))
+(assert (<= (+ (* 2.0 x0) (* 1.0 x1) (* 5.0 x2) (* 3.0 x5) (* 1.0 x9) (* 9.0 x14) (* 4.0 x18) (* 2.0 x20) (* 9.0 x21) (* 1.0 x23) (* 6.0 x26) (* 1.0 x28) (* 7.0 x29) (* 7.0 x31) (* 6.0 x32) (* 2.0 x33) (* 2.0 x34) (* 8.0 x35) (* 4.0 x38) (* 3.0 x39) 0.0) 36.0))
+(assert (<= (+ (* 5.0 x0) (* 1.0 x3) (* 1.0 x6) (* 1.0 x7) (* 3.0 x8) (* 1.0 x15) (* 8.0 x18) (* 9.0 x19) (* 3.0 x20) (* 9.0 x25) (* 6.0 x30) (* 9.0 x31) (* 2.0 x35) (* 3.0 x36) (* 3.0 x37) (* 6.0 x38) 0.0) 88.0))
+(assert (<= (+ (* 8.0 x0) (* 1.0 x2) (* 3.0 x4) (* 7.0 x7) (* 9.0 x10) (* 7.0 x12) (* 3.0 x13) (* 2.0 x14) (* 4.0 x17) (* 6.0 x18) (* 9.0 x21) (* 1.0 x22) (* 3.0 x24) (* 1.0 x26) (* 4.0 x29) (* 3.0 x33) (* 6.0 x34) (* 6.0 x35) (* 7.0 x36) (* 7.0 x37) (* 5.0 x39) 0.0) 37.0))
+(assert (<= (+ (* 3.0 x0) (* 2.0 x1) (* 5.0 x2) (* 4.0 x5) (* 6.0 x6) (* 5.0 x7) (* 8.0 x8) (* 2.0 x9) (* 7.0 x15) (* 3.0 x17) (* 5.0 x18) (* 2.0 x19) (* 5.0 x21) (* 7.0 x22) (* 6.0 x23) (* 7.0 x24) (* 8.0 x25) (* 5.0 x30) (* 5.0 x35) (* 4.0 x38) (* 7.0 x39) 0.0) 89.0))
+(assert (<= (+ (* 2.0 x1) (* 3.0 x2) (* 3.0 x4) (* 2.0 x5) (* 9.0 x8) (* 3.0 x9) (* 4.0 x10) (* 5.0 x12) (* 8.0 x14) (* 5.0 x15) (* 1.0 x17) (* 5.0 x19) (* 6.0 x20) (* 4.0 x23) (* 1.0 x27) (* 4.0 x31) (* 8.0 x32) (* 2.0 x33) (* 2.0 x35) (* 2.0 x38) 0.0) 23.0))
+(assert (<= (+ (* 6.0 x2) (* 8.0 x4) (* 5.0 x6) (* 9.0 x8) (* 3.0 x9) (* 9.0 x11) (* 7.0 x13) (* 2.0 x14) (* 3.0 x15) (* 1.0 x19) (* 1.0 x22) (* 9.0 x25) (* 9.0 x28) (* 6.0 x29) (* 2.0 x32) (* 4.0 x33) (* 1.0 x35) (* 9.0 x39) 0.0) 45.0))
+(assert (<= (+ (* 7.0 x0) (* 9.0 x1) (* 1.0 x4) (* 9.0 x7) (* 5.0 x10) (* 5.0 x17) (* 7.0 x19) (* 2.0 x20) (* 1.0 x22) (* 9.0 x25) (* 4.0 x31) (* 6.0 x32) (* 4.0 x35) (* 3.0 x36) (* 8.0 x37) (* 2.0 x38) (* 3.0 x39) 0.0) 53.0))
+(assert (<= (+ (* 4.0 x0) (* 1.0 x1) (* 3.0 x2) (* 6.0 x3) (* 8.0 x6) (* 3.0 x7) (* 5.0 x10) (* 7.0 x11) (* 7.0 x13) (* 2.0 x16) (* 4.0 x17) (* 4.0 x19) (* 1.0 x20) (* 7.0 x21) (* 3.0 x23) (* 4.0 x29) (* 6.0 x32) (* 3.0 x34) (* 3.0 x37) (* 9.0 x38) 0.0) 60.0))
+(assert (<= (+ (* 3.0 x0) (* 4.0 x1) (* 9.0 x3) (* 8.0 x4) (* 6.0 x5) (* 6.0 x6) (* 5.0 x8) (* 8.0 x17) (* 8.0 x18) (* 4.0 x20) (* 9.0 x21) (* 7.0 x23) (* 8.0 x25) (* 4.0 x33) (* 5.0 x36) (* 4.0 x37) (* 8.0 x39) 0.0) 93.0))
+(assert (<= (+ (* 4.0 x1) (* 5.0 x2) (* 4.0 x3) (* 6.0 x4) (* 5.0 x6) (* 4.0 x8) (* 4.0 x9) (* 9.0 x12) (* 7.0 x13) (* 9.0 x14) (* 9.0 x16) (* 9.0 x18) (* 9.0 x19) (* 3.0 x23) (* 9.0 x26) (* 2.0 x28) (* 8.0 x31) (* 1.0 x32) (* 2.0 x33) (* 5.0 x34) (* 8.0 x37) (* 9.0 x39) 0.0) 76.0))
+(assert (<= (+ (* 7.0 x2) (* 5.0 x5) (* 7.0 x7) (* 9.0 x8) (* 7.0 x11) (* 1.0 x12) (* 9.0 x14) (* 9.0 x16) (* 1.0 x18) (* 7.0 x24) (* 7.0 x29) (* 9.0 x34) (* 5.0 x36) (* 1.0 x37) (* 3.0 x39) 0.0) 77.0))
+(assert (<= (+ (* 8.0 x1) (* 9.0 x2) (* 7.0 x3) (* 1.0 x4) (* 2.0 x5) (* 3.0 x6) (* 9.0 x7) (* 9.0 x8) (* 5.0 x10) (* 5.0 x12) (* 1.0 x14) (* 3.0 x17) (* 9.0 x20) (* 8.0 x21) (* 6.0 x22) (* 7.0 x23) (* 1.0 x24) (* 5.0 x25) (* 2.0 x26) (* 5.0 x27) (* 8.0 x28) (* 7.0 x33) (* 1.0 x34) (* 4.0 x35) (* 1.0 x36) (* 2.0 x37) 0.0) 61.0))
+(assert (<= (+ (* 9.0 x0) (* 9.0 x1) (* 1.0 x2) (* 9.0 x6) (* 8.0 x10) (* 8.0 x16) (* 5.0 x18) (* 5.0 x19) (* 9.0 x23) (* 3.0 x25) (* 1.0 x26) (* 2.0 x27) (* 4.0 x32) (* 8.0 x33) (* 8.0 x36) (* 5.0 x37) 0.0) 97.0))
+(assert (<= x0 24.0))
+(assert (<= x1 14.0))
+(assert (<= x2 16.0))
+(assert (<= x3 20.0))
+(assert (<= x4 21.0))
+(assert (<= x5 20.0))
+(assert (<= x6 10.0))
+(assert (<= x7 6.0))
+(assert (<= x8 17.0))
+(assert (<= x9 12.0))
+(assert (<= x10 16.0))
+(assert (<= x11 16.0))
+(assert (<= x12 7.0))
+(assert (<= x13 10.0))
+(assert (<= x14 12.0))
+(assert (<= x15 7.0))
+(assert (<= x16 13.0))
+(assert (<= x17 10.0))
+(assert (<= x18 6.0))
+(assert (<= x19 15.0))
+(assert (<= x20 19.0))
+(assert (<= x21 7.0))
+(assert (<= x22 16.0))
+(assert (<= x23 13.0))
+(assert (<= x24 14.0))
+(assert (<= x25 11.0))
+(assert (<= x26 17.0))
+(assert (<= x27 6.0))
+(assert (<= x28 21.0))
+(assert (<= x29 9.0))
+(assert (<= x30 13.0))
+(assert (<= x31 5.0))
+(assert (<= x32 9.0))
+(assert (<= x33 25.0))
+(assert (<= x34 24.0))
+(assert (<= x35 9.0))
+(assert (<= x36 19.0))
+(assert (<= x37 19.0))
+(assert (<= x38 30.0))
+(assert (<= x39 23.0))
+(maximize (+ (* 1.0 x0) (* 8.0 x1) (* 8.0 x2) (* 2.0 x3) (* 8.0 x4) (* 1.0 x5) (* 7.0 x6) (* 8.0 x7) (* 8.0 x8) (* 7.0 x9) (* 3.0 x10) (* 4.0 x11) (* 1.0 x12) (* 6.0 x13) (* 2.0 x14) (* 1.0 x15) (* 6.0 x16) (* 3.0 x17) (* 9.0 x18) (* 7.0 x19) (* 5.0 x20) (* 2.0 x21) (* 7.0 x22) (* 7.0 x23) (* 7.0 x24) (* 6.0 x25) (* 8.0 x26) (* 6.0 x27) (* 2.0 x28) (* 2.0 x29) (* 7.0 x30) (* 4.0 x31) (* 5.0 x32) (* 9.0 x33) (* 9.0 x34) (* 7.0 x35) (* 2.0 x36) (* 3.0 x37) (* 7.0 x38) (* 4.0 x39)))
+(check-opt)
@@ -0,0 +1,134 @@
+; Random 3-SAT with weighted soft clauses.
+(set-option :produce-unsat-assumptions true)
+(set-logic QF_UF)
+(declare-const p0 Bool)
+(declare-const p1 Bool)
+(declare-const p2 Bool)
+(declare-const p3 Bool)
+(declare-const p4 Bool)
+(declare-const p5 Bool)
+(declare-const p6 Bool)
+(declare-const p7 Bool)
+(declare-const p8 Bool)
+(declare-const p9 Bool)
+(declare-const p10 Bool)
+(declare-const p11 Bool)
+(declare-const p12 Bool)
+(declare-const p13 Bool)
+(declare-const p14 Bool)
+(declare-const p15 Bool)
+(declare-const p16 Bool)
+(declare-const p17 Bool)
+(declare-const p18 Bool)
+(declare-const p19 Bool)
+(declare-const p20 Bool)
+(declare-const p21 Bool)
+(declare-const p22 Bool)
+(declare-const p23 Bool)
+(declare-const p24 Bool)
+(declare-const p25 Bool)
+(declare-const p26 Bool)
+(declare-const p27 Bool)
+(declare-const p28 Bool)
+(declare-const p29 Bool)
+(assert (or p19 (not p11) (not p26)))
+(assert (or (not p29) p26 (not p7)))
+(assert (or p28 p11 p7))
+(assert (or (not p3) (not p0) p13))
+(assert (or (not p29) p12 p25))
+(assert (or (not p19) p4 p27))
+(assert (or p24 (not p5) p9))
+(assert (or (not p6) (not p21) (not p5)))
+(assert (or p22 p28 p0))
+(assert (or (not p5) p8 (not p9)))
+(assert (or p18 (not p21) p2))
+(assert (or p26 p22 p15))
+(assert (or p5 (not p0) (not p11)))
+(assert (or (not p0) p13 (not p18)))
+(assert (or p14 (not p5) p6))
+(assert (or (not p7) p14 (not p11)))
+(assert (or (not p8) (not p3) (not p24)))
+(assert (or p27 (not p13) p2))
+(assert (or (not p16) p29 (not p8)))
+(assert (or p17 p21 (not p5)))
+(assert (or p20 p22 p15))
+(assert (or p1 (not p19) p12))
+(assert (or (not p23) p26 p20))
+(assert (or (not p1) p20 p15))
+(assert (or p6 (not p23) (not p4)))
+(assert (or p25 p5 p4))
+(assert (or p13 (not p14) (not p19)))
+(assert (or p16 (not p15) p10))
+(assert (or p9 p28 (not p12)))
+(assert (or (not p17) (not p20) p27))
+(assert (or p2 (not p16) (not p27)))
+(assert (or (not p2) p24 (not p18)))
+(assert (or p24 (not p17) (not p8)))
+(assert (or (not p8) (not p22) (not p10)))
+(assert (or (not p18) (not p15) p8))
+(assert (or p8 (not p26) (not p21)))
+(assert (or p11 (not p11) p26))
+(assert (or (not p29) (not p27) (not p14)))
+(assert (or (not p10) (not p16) (not p6)))
+(assert (or (not p29) (not p9) (not p23)))
+(assert (or p13 (not p24) (not p16)))
+(assert (or p13 (not p17) p20))
+(assert (or p0 p18 p20))
+(assert (or (not p24) (not p20) (not p15)))
+(assert (or p5 p4 p5))
+(assert (or p17 p14 (not p21)))
+(assert (or p18 (not p22) p0))
+(assert (or (not p8) p27 (not p26)))
+(assert (or (not p1) p9 (not p17)))
+(assert (or p18 (not p11) p13))
+(assert (or (not p18) p11 (not p5)))
+(assert (or p18 (not p6) p19))
+(assert (or (not p26) p0 (not p10)))
+(assert (or (not p19) (not p10) (not p28)))
+(assert (or p13 p7 (not p15)))
+(assert (or p12 (not p27) (not p19)))
+(assert (or (not p23) p15 p0))
+(assert (or p9 p9 p0))
+(assert (or (not p19) p7 p25))
+(assert (or p12 (not p17) (not p7)))
+(assert-soft (or p25 p15) :weight 5)
+(assert-soft (or (not p23) p9) :weight 16)
+(assert-soft (or (not p16) (not p19)) :weight 4)
+(assert-soft (or (not p0) p9) :weight 11)
+(assert-soft (or p19 p16) :weight 12)
+(assert-soft (or (not p11) (not p26)) :weight 2)
+(assert-soft (or p0 (not p14)) :weight 4)
+(assert-soft (or (not p28) p6) :weight 14)
+(assert-soft (or (not p19) (not p22)) :weight 16)
+(assert-soft (or (not p27) p12) :weight 7)
+(assert-soft (or p28 (not p26)) :weight 10)
+(assert-soft (or p26 p24) :weight 10)
+(assert-soft (or (not p20) p29) :weight 6)
+(assert-soft (or (not p15) p28) :weight 11)
+(assert-soft (or p17 (not p18)) :weight 2)
+(assert-soft (or (not p2) (not p8)) :weight 3)
+(assert-soft (or (not p21) (not p10)) :weight 3)
+(assert-soft (or (not p12) p1) :weight 4)
+(assert-soft (or (not p7) (not p26)) :weight 5)
+(assert-soft (or (not p9) p14) :weight 20)
+(assert-soft (or p5 p5) :weight 7)
+(assert-soft (or (not p1) p21) :weight 3)
+(assert-soft (or p8 p18) :weight 13)
+(assert-soft (or (not p28) p0) :weight 11)
+(assert-soft (or (not p21) p15) :weight 12)
+(assert-soft (or p29 p22) :weight 19)
+(assert-soft (or (not p20) (not p9)) :weight 18)
+(assert-soft (or (not p17) p8) :weight 8)
+(assert-soft (or (not p8) (not p9)) :weight 5)
+(assert-soft (or p25 p11) :weight 13)
+(assert-soft (or p5 (not p0)) :weight 3)
+(assert-soft (or (not p18) (not p2)) :weight 17)
+(assert-soft (or p19 (not p12)) :weight 16)
+(assert-soft (or p10 p16) :weight 13)
+(assert-soft (or (not p1) (not p13)) :weight 8)
+(assert-soft (or p23 (not p29)) :weight 7)
+(assert-soft (or (not p4) p12) :weight 8)
+(assert-soft (or p9 (not p19)) :weight 13)
+(assert-soft (or p12 p26) :weight 10)
+(assert-soft (or (not p25) p27) :weight 2)
+(check-opt)
@@ -0,0 +1,244 @@
+; Random 3-SAT with weighted soft clauses.
+(set-option :produce-unsat-assumptions true)
+(set-logic QF_UF)
+(declare-const p0 Bool)
+(declare-const p1 Bool)
+(declare-const p2 Bool)
+(declare-const p3 Bool)
+(declare-const p4 Bool)
+(declare-const p5 Bool)
+(declare-const p6 Bool)
+(declare-const p7 Bool)
+(declare-const p8 Bool)
+(declare-const p9 Bool)
+(declare-const p10 Bool)
+(declare-const p11 Bool)
+(declare-const p12 Bool)
+(declare-const p13 Bool)
+(declare-const p14 Bool)
+(declare-const p15 Bool)
+(declare-const p16 Bool)
+(declare-const p17 Bool)
+(declare-const p18 Bool)
+(declare-const p19 Bool)
+(declare-const p20 Bool)
+(declare-const p21 Bool)
+(declare-const p22 Bool)
+(declare-const p23 Bool)
+(declare-const p24 Bool)
+(declare-const p25 Bool)
+(declare-const p26 Bool)
+(declare-const p27 Bool)
+(declare-const p28 Bool)
+(declare-const p29 Bool)
+(declare-const p30 Bool)
+(declare-const p31 Bool)
+(declare-const p32 Bool)
+(declare-const p33 Bool)
+(declare-const p34 Bool)
+(declare-const p35 Bool)
+(declare-const p36 Bool)
+(declare-const p37 Bool)
+(declare-const p38 Bool)
+(declare-const p39 Bool)
+(declare-const p40 Bool)
+(declare-const p41 Bool)
+(declare-const p42 Bool)
+(declare-const p43 Bool)
+(declare-const p44 Bool)
+(declare-const p45 Bool)
+(declare-const p46 Bool)
+(declare-const p47 Bool)
+(declare-const p48 Bool)
+(declare-const p49 Bool)
+(assert (or (not p36) (not p31) p2))
+(assert (or (not p42) (not p48) (not p20)))
+(assert (or p17 (not p12) (not p26)))
+(assert (or (not p34) (not p12) (not p44)))
+(assert (or (not p16) (not p39) p27))
+(assert (or p5 (not p26) (not p28)))
+(assert (or p48 (not p40) (not p6)))
+(assert (or (not p37) (not p41) (not p31)))
+(assert (or (not p12) (not p41) (not p32)))
+(assert (or (not p1) (not p15) p19))
+(assert (or p7 (not p43) (not p7)))
+(assert (or p17 p12 p14))
+(assert (or (not p13) (not p44) (not p12)))
+(assert (or (not p1) (not p35) (not p39)))
+(assert (or p23 p24 (not p43)))
+(assert (or p3 (not p38) p25))
+(assert (or p28 (not p5) (not p42)))
+(assert (or p28 (not p24) p33))
+(assert (or (not p19) (not p26) (not p12)))
+(assert (or p17 (not p46) p11))
+(assert (or p34 (not p37) p12))
+(assert (or p28 p33 (not p26)))
+(assert (or (not p26) (not p17) p42))
+(assert (or (not p9) p31 p29))
+(assert (or p42 p39 p38))
+(assert (or p41 (not p31) (not p10)))
+(assert (or (not p18) p39 p3))
+(assert (or (not p39) (not p7) p23))
+(assert (or (not p31) (not p3) (not p9)))
+(assert (or p39 p33 p30))
+(assert (or p23 (not p9) (not p15)))
+(assert (or p9 p42 p6))
+(assert (or p30 (not p4) (not p44)))
+(assert (or (not p39) p5 (not p40)))
+(assert (or p41 p44 p40))
+(assert (or (not p12) p28 p28))
+(assert (or p17 p37 (not p18)))
+(assert (or p18 p2 p17))
+(assert (or p30 p23 p5))
+(assert (or (not p38) (not p34) p47))
+(assert (or p23 (not p47) (not p13)))
+(assert (or (not p21) (not p10) p7))
+(assert (or p8 (not p31) p8))
+(assert (or (not p33) (not p11) p9))
+(assert (or p47 (not p36) (not p14)))
+(assert (or (not p44) p8 (not p10)))
+(assert (or (not p15) (not p0) p36))
+(assert (or p48 (not p24) p0))
+(assert (or (not p33) p42 (not p14)))
+(assert (or p47 p42 p9))
+(assert (or p40 p4 p2))
+(assert (or p3 (not p45) p43))
+(assert (or p2 (not p14) (not p14)))
+(assert (or (not p44) p18 (not p4)))
+(assert (or p3 p42 (not p7)))
+(assert (or p11 (not p1) (not p43)))
+(assert (or (not p27) p18 p14))
+(assert (or (not p41) p41 p37))
+(assert (or (not p33) (not p47) (not p45)))
+(assert (or (not p21) (not p5) p41))
+(assert (or (not p23) (not p14) p1))
+(assert (or (not p44) (not p27) p3))
+(assert (or p1 p4 (not p29)))
+(assert (or (not p5) p39 p8))
+(assert (or p34 p42 p38))
+(assert (or (not p33) (not p30) p16))
+(assert (or p2 p28 (not p11)))
+(assert (or (not p0) p7 p25))
+(assert (or (not p33) (not p34) p30))
+(assert (or (not p41) (not p9) (not p29)))
+(assert (or p0 p16 p18))
+(assert (or p43 (not p0) p11))
+(assert (or (not p39) (not p14) p5))
+(assert (or p26 (not p9) (not p3)))
+(assert (or (not p49) (not p23) (not p21)))
+(assert (or p37 (not p17) p4))
+(assert (or p2 (not p38) (not p9)))
+(assert (or p32 (not p44) p5))
+(assert (or (not p42) p13 (not p10)))
+(assert (or p15 p11 (not p8)))
+(assert (or (not p47) p39 p39))
+(assert (or (not p12) p46 (not p21)))
+(assert (or p4 p0 p41))
+(assert (or p40 p3 p46))
+(assert (or p39 (not p47) p23))
+(assert (or p48 (not p42) p47))
+(assert (or (not p1) p9 p28))
+(assert (or (not p8) p30 p30))
+(assert (or p45 (not p34) p10))
+(assert (or (not p16) p49 (not p34)))
+(assert (or p17 (not p45) (not p32)))
+(assert (or (not p42) (not p0) (not p31)))
+(assert (or p16 p2 (not p13)))
+(assert (or p12 p3 (not p19)))
+(assert (or p23 p46 p0))
+(assert (or (not p22) p22 p40))
+(assert (or (not p24) p39 (not p41)))
+(assert (or p27 p39 p28))
+(assert (or (not p40) p3 (not p41)))
+(assert (or p33 (not p17) p23))
+(assert (or (not p27) (not p6) p34))
+(assert (or p41 p17 p32))
+(assert (or (not p42) p3 p7))
+(assert (or (not p27) (not p11) p22))
+(assert (or (not p17) p22 (not p37)))
+(assert (or p45 p7 p31))
+(assert (or (not p16) (not p15) (not p3)))
+(assert (or (not p34) p9 (not p18)))
+(assert (or (not p47) p6 (not p8)))
+(assert (or p1 p31 p46))
+(assert-soft (or (not p11) p9) :weight 1)
+(assert-soft (or (not p13) (not p26)) :weight 16)
+(assert-soft (or (not p39) p28) :weight 20)
+(assert-soft (or p29 (not p11)) :weight 8)
+(assert-soft (or (not p42) p25) :weight 12)
+(assert-soft (or (not p29) p41) :weight 20)
+(assert-soft (or (not p12) (not p14)) :weight 14)
+(assert-soft (or p15 (not p36)) :weight 2)
+(assert-soft (or p20 (not p31)) :weight 14)
+(assert-soft (or p24 (not p33)) :weight 12)
+(assert-soft (or (not p37) (not p26)) :weight 6)
+(assert-soft (or p19 p42) :weight 4)
+(assert-soft (or (not p29) p10) :weight 14)
+(assert-soft (or (not p43) p20) :weight 14)
+(assert-soft (or p31 (not p6)) :weight 16)
+(assert-soft (or (not p27) p40) :weight 17)
+(assert-soft (or p33 p23) :weight 6)
+(assert-soft (or (not p30) (not p25)) :weight 4)
+(assert-soft (or p1 p41) :weight 18)
+(assert-soft (or (not p16) (not p38)) :weight 9)
+(assert-soft (or p24 (not p0)) :weight 14)
+(assert-soft (or p19 p22) :weight 18)
+(assert-soft (or p13 (not p2)) :weight 16)
+(assert-soft (or p41 p26) :weight 16)
+(assert-soft (or p12 p9) :weight 2)
+(assert-soft (or (not p14) p17) :weight 12)
+(assert-soft (or p30 (not p23)) :weight 9)
+(assert-soft (or (not p12) p35) :weight 7)
+(assert-soft (or p12 (not p33)) :weight 2)
+(assert-soft (or p43 (not p1)) :weight 3)
+(assert-soft (or p46 (not p43)) :weight 7)
+(assert-soft (or (not p32) (not p6)) :weight 19)
+(assert-soft (or (not p30) p42) :weight 7)
+(assert-soft (or (not p49) p0) :weight 7)
+(assert-soft (or (not p34) (not p9)) :weight 1)
+(assert-soft (or p18 (not p32)) :weight 7)
+(assert-soft (or p46 (not p38)) :weight 20)
+(assert-soft (or p31 (not p38)) :weight 6)
+(assert-soft (or (not p8) (not p12)) :weight 10)
+(assert-soft (or p26 (not p25)) :weight 15)
+(assert-soft (or p13 (not p14)) :weight 12)
+(assert-soft (or p48 p20) :weight 12)
+(assert-soft (or p25 p33) :weight 10)
+(assert-soft (or (not p9) (not p41)) :weight 7)
+(assert-soft (or p39 (not p11)) :weight 1)
+(assert-soft (or p9 p34) :weight 20)
+(assert-soft (or (not p0) p34) :weight 18)
+(assert-soft (or p2 p7) :weight 5)
+(assert-soft (or (not p18) (not p0)) :weight 9)
+(assert-soft (or (not p49) (not p17)) :weight 3)
+(assert-soft (or (not p47) p38) :weight 4)
+(assert-soft (or (not p37) p0) :weight 20)
+(assert-soft (or p13 (not p27)) :weight 1)
+(assert-soft (or p39 (not p20)) :weight 19)
+(assert-soft (or p48 (not p36)) :weight 2)
+(assert-soft (or p3 (not p35)) :weight 20)
+(assert-soft (or (not p15) p15) :weight 9)
+(assert-soft (or (not p11) p22) :weight 8)
+(assert-soft (or p10 (not p36)) :weight 15)
+(assert-soft (or p3 p35) :weight 12)
+(assert-soft (or p28 (not p33)) :weight 14)
+(assert-soft (or (not p37) (not p20)) :weight 15)
+(assert-soft (or (not p24) (not p34)) :weight 8)
+(assert-soft (or (not p3) (not p5)) :weight 14)
+(assert-soft (or (not p42) (not p6)) :weight 15)
+(assert-soft (or (not p21) p43) :weight 3)
+(assert-soft (or (not p6) p13) :weight 8)
+(assert-soft (or p34 p40) :weight 2)
+(assert-soft (or p2 (not p18)) :weight 20)
+(assert-soft (or p7 p10) :weight 16)
+(assert-soft (or (not p42) p22) :weight 5)
+(assert-soft (or p28 p35) :weight 7)
+(assert-soft (or (not p49) p40) :weight 2)
+(assert-soft (or p13 (not p36)) :weight 18)
+(assert-soft (or p46 p16) :weight 11)
+(assert-soft (or (not p49) (not p23)) :weight 9)
+(assert-soft (or p25 p20) :weight 12)
+(assert-soft (or p12 (not p26)) :weight 9)
+(assert-soft (or p5 (not p32)) :weight 2)
+(assert-soft (or (not p4) p7) :weight 1)
+(check-opt)
@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+###############################################################################
+# This file is part of the cvc5 project.
+#
+# Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+# in the top-level source directory and their institutional affiliations.
+# All rights reserved.  See the file COPYING in the top-level source
+# directory for licensing information.
+# #############################################################################
+##
+"""
+Runs the optimization benchmarks and records, for each instance, the time to
+the first model, the time to the optimum, the number of satisfiability checks
+and the peak resident set size of the solver. The times are those of all
+optimization queries of an instance together, since the solver only reports
+its statistics at exit. They are named totalFirstModelTime and totalOptTime,
+and the number of queries they add up is recorded as queries.
+
+The results can be written as JSON and compared against the results of a
+previous run, in which case the script fails if an instance got slower by more
+than the given factor, or if its result changed.
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import threading
+import time
+
+# The statistics of the optimization solver that are recorded. The cores are
+# those of the OLL algorithm for MaxSMT, which needs unsat assumptions and
+# hence only runs on benchmarks that enable them. The timers accumulate over
+# all queries of a run.
+STAT_PREFIX = "smt::OptimizationSolver::"
+STATS = {
+    "queries": "queries",
+    "time": "totalOptTime",
+    "firstModelTime": "totalFirstModelTime",
+    "checks": "satCalls",
+    "improvements": "improvements",
+    "cores": "cores",
+}
+
+STAT_RE = re.compile(r"^(\S+) = (\d+)(ms)?\s*$")
+
+RESULTS = ["sat", "unsat", "unknown"]
+
+BENCHMARK_DIR = os.path.dirname(os.path.abspath(__file__))
+
+
+def collect_benchmarks(paths):
+    """Returns the sorted list of .smt2 files in paths."""
+    benchmarks = []
+    for path in paths:
+        if os.path.isdir(path):
+            for root, _, files in os.walk(path):
+                benchmarks.extend(
+                    os.path.join(root, f) for f in files if f.endswith(".smt2"))
+        else:
+            benchmarks.append(path)
+    return sorted(benchmarks)
+
+
+def run_benchmark(cvc5, benchmark, args, timeout):
+    """
+    Runs cvc5 on benchmark and returns the record of the run. The peak
+    resident set size is taken from the resource usage of the child process,
+    which is only available on POSIX systems.
+    """
+    cmd = [cvc5, "-i", "--produce-models", "--stats", "--stats-internal"]
+    cmd += args + [benchmark]
+    start = time.monotonic()
+    proc = subprocess.Popen(cmd,
+                            stdout=subprocess.PIPE,
+                            stderr=subprocess.STDOUT,
+                            universal_newlines=True)
+    timer = threading.Timer(timeout, proc.kill)
+    timer.start()
+    output = proc.stdout.read()
+    _, status, rusage = os.wait4(proc.pid, 0)
+    wall = time.monotonic() - start
+    timed_out = not timer.is_alive()
+    timer.cancel()
+    proc.returncode = os.waitstatus_to_exitcode(status)
+
+    # benchmarks of this directory are named relative to it, such that the
+    # results of different checkouts can be compared
+    name = os.path.abspath(benchmark)
+    if os.path.commonpath([name, BENCHMARK_DIR]) == BENCHMARK_DIR:
+        name = os.path.relpath(name, BENCHMARK_DIR)
+    record = {
+        "benchmark": name,
+        "result": "timeout" if timed_out else "error",
+        "wallTime": round(wall * 1000),
+        # ru_maxrss is in kilobytes on Linux and in bytes on macOS
+        "peakRss": rusage.ru_maxrss // (1024 if sys.platform == "darwin"
+                                         else 1),
+    }
+    for key in STATS.values():
+        record[key] = None
+    for line in output.splitlines():
+        line = line.strip()
+        if line in RESULTS and not timed_out and proc.returncode == 0:
+            record["result"] = line
+            continue
+        m = STAT_RE.match(line)
+        if m and m.group(1).startswith(STAT_PREFIX):
+            stat = m.group(1)[len(STAT_PREFIX):]
+            if stat in STATS:
+                record[STATS[stat]] = int(m.group(2))
+    return record
+
+
+def print_table(records):
+    columns = [
+        ("benchmark", "benchmark"),
+        ("result", "result"),
+        ("queries", "queries"),
+        ("totalFirstModelTime", "first models (ms)"),
+        ("totalOptTime", "optima (ms)"),
+        ("satCalls", "sat calls"),
+        ("peakRss", "peak rss (kb)"),
+    ]
+    rows = [[h for _, h in columns]]
+    for r in records:
+        rows.append(
+            ["-" if r[k] is None else str(r[k]) for k, _ in columns])
+    widths = [max(len(row[i]) for row in rows) for i in range(len(columns))]
+    for row in rows:
+        print("  ".join(c.ljust(w) for c, w in zip(row, widths)).rstrip())
+
+
+def compare(records, baseline, max_slowdown, min_time):
+    """
+    Compares records against the records of a baseline run. Returns the list
+    of regressions found. Instances faster than min_time milliseconds in both
+    runs are not compared for time, since their timings are mostly noise.
+    """
+    previous = {r["benchmark"]: r for r in baseline}
+    regressions = []
+    for r in records:
+        name = r["benchmark"]
+        if name not in previous:
+            continue
+        p = previous[name]
+        if p["result"] != r["result"]:
+            regressions.append("{}: result {} (was {})".format(
+                name, r["result"], p["result"]))
+            continue
+        for key in ["totalFirstModelTime", "totalOptTime"]:
+            # baselines of older runs may not have the key
+            if r[key] is None or p.get(key) is None:
+                continue
+            if max(r[key], p[key]) < min_time:
+                continue
+            if r[key] > max_slowdown * max(p[key], 1):
+                regressions.append("{}: {} {}ms (was {}ms)".format(
+                    name, key, r[key], p[key]))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Runs the optimization benchmarks of cvc5.")
+    parser.add_argument("--timeout", type=float, default=300,
+                        help="timeout per instance in seconds")
+    parser.add_argument("--output", help="write the results as JSON")
+    parser.add_argument("--baseline",
+                        help="compare against the JSON results of a "
+                        "previous run")
+    parser.add_argument("--max-slowdown", type=float, default=1.5,
+                        help="maximal slowdown w.r.t. the baseline")
+    parser.add_argument("--min-time", type=int, default=100,
+                        help="minimal time in milliseconds for an instance "
+                        "to be compared against the baseline")
+    parser.add_argument("--cvc5-args", default="",
+                        help="additional options passed to cvc5")
+    parser.add_argument("cvc5", help="the cvc5 binary")
+    parser.add_argument("benchmarks", nargs="*",
+                        help="benchmarks or directories of benchmarks "
+                        "(defaults to all benchmarks of this directory)")
+    args = parser.parse_args()
+
+    paths = args.benchmarks or [BENCHMARK_DIR]
+    benchmarks = collect_benchmarks(paths)
+    if not benchmarks:
+        print("no benchmarks found", file=sys.stderr)
+        return 1
+
+    records = []
+    for benchmark in benchmarks:
+        records.append(
+            run_benchmark(args.cvc5, benchmark, args.cvc5_args.split(),
+                          args.timeout))
+    print_table(records)
+
+    if args.output:
+        with open(args.output, "w") as out:
+            json.dump(records, out, indent=2)
+
+    exit_code = 0
+    if any(r["result"] == "error" for r in records):
+        exit_code = 1
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        regressions = compare(records, baseline, args.max_slowdown,
+                              args.min_time)
+        for r in regressions:
+            print("regression: " + r, file=sys.stderr)
+        if regressions:
+            exit_code = 1
+    return exit_code
+
+
+if __name__ == "__main__":
+    sys.exit(main())
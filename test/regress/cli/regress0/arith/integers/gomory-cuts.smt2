@@ -0,0 +1,18 @@
+; COMMAND-LINE: --gomory-cuts --no-dio-solver
+; DISABLE-TESTER: proof
+; DISABLE-TESTER: dsl-proof
+; DISABLE-TESTER: lfsc
+; DISABLE-TESTER: alethe
+; DISABLE-TESTER: cpc
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LIA)
+(declare-const x Int)
+(declare-const y Int)
+(declare-const z Int)
+(assert (>= x 0))
+(assert (>= y 0))
+(assert (>= z 0))
+(assert (= (+ (* 3 x) (* 5 y) z) 7))
+(check-sat-assuming ((<= z 1)))
+(check-sat-assuming ((= z 0)))
@@ -0,0 +1,13 @@
+; REQUIRES: poly
+; COMMAND-LINE: --nl-cov --nl-ext=none --nl-cov-threads=3
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_NRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (< (+ (* x x) (* y y) (* z z)) 1))
+(assert (> (* x y) 0.25))
+(assert (> (* y z) 0.25))
+(check-sat-assuming ((> (* x z) 0.5)))
+(check-sat-assuming ((> (* x z) 0.2)))
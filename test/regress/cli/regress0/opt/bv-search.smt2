@@ -0,0 +1,19 @@
+; COMMAND-LINE: -i --produce-models
+; COMMAND-LINE: -i --produce-models --opt-search=linear
+; EXPECT: sat
+; EXPECT: ((a #b1001) (b #b1100))
+; EXPECT: sat
+; EXPECT: ((a #b0101) (b #b1000))
+(set-logic QF_BV)
+(declare-const a (_ BitVec 4))
+(declare-const b (_ BitVec 4))
+(assert (bvult a #xa))
+(assert (= b (bvadd a #x3)))
+(push)
+(maximize b)
+(check-opt)
+(get-value (a b))
+(pop)
+(minimize b :signed)
+(check-opt)
+(get-value (a b))
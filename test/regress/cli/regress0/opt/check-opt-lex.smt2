@@ -0,0 +1,22 @@
+; COMMAND-LINE: -i --produce-models
+; COMMAND-LINE: -i --produce-models --no-opt-phase
+; EXPECT: sat
+; EXPECT: ((x 4) (y 3))
+; EXPECT: sat
+; EXPECT: ((y 3))
+(set-logic QF_LIA)
+(declare-const x Int)
+(declare-const y Int)
+(assert (<= 2 x 10))
+(assert (<= 3 y))
+(assert (>= (+ x y) 7))
+(push)
+(minimize (+ x y))
+(maximize x)
+(check-opt)
+(get-value (x y))
+(pop)
+(maximize x)
+(minimize y)
+(check-opt :box)
+(get-value (y))
@@ -0,0 +1,26 @@
+; COMMAND-LINE: -i --produce-models --produce-unsat-assumptions
+; COMMAND-LINE: -i --produce-models --produce-unsat-assumptions --no-opt-stratify
+; COMMAND-LINE: -i --produce-models
+; COMMAND-LINE: -i --produce-models --produce-unsat-assumptions --opt-search=linear
+; EXPECT: sat
+; EXPECT: ((x false) (y true) (z true))
+; EXPECT: sat
+; EXPECT: ((x true) (y false) (z false))
+(set-logic QF_UF)
+(declare-const x Bool)
+(declare-const y Bool)
+(declare-const z Bool)
+(assert (or (not x) (not y)))
+(assert (or (not x) (not z)))
+(push)
+(assert-soft x :weight 3)
+(assert-soft y :weight 2)
+(assert-soft z :weight 2)
+(check-opt)
+(get-value (x y z))
+(pop)
+(assert-soft x :weight 5 :id a)
+(assert-soft y :weight 2 :id a)
+(assert-soft z :weight 2 :id a)
+(check-opt)
+(get-value (x y z))
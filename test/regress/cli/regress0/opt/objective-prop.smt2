@@ -0,0 +1,16 @@
+; COMMAND-LINE: -i --produce-models
+; COMMAND-LINE: -i --produce-models --no-arith-objective-prop
+; EXPECT: sat
+; EXPECT: ((x 1) (y 2) (z 2) (+ (* 3 x) (* 2 y) z) 9))
+(set-logic QF_LIA)
+(declare-const x Int)
+(declare-const y Int)
+(declare-const z Int)
+(assert (<= 0 x 10))
+(assert (<= 0 y 2))
+(assert (<= 0 z 2))
+(assert (>= (+ x y z) 5))
+(assert (or (>= x 4) (>= y 2)))
+(minimize (+ (* 3 x) (* 2 y) z))
+(check-opt)
+(get-value (x y z (+ (* 3 x) (* 2 y) z)))
@@ -0,0 +1,27 @@
+; COMMAND-LINE: -i --produce-models
+; EXPECT: unknown
+; EXPECT: unknown
+; EXPECT: unknown
+; EXPECT: sat
+(set-logic QF_LIRA)
+(declare-const x Real)
+(declare-const y Int)
+(assert (>= x 1))
+(assert (<= y 5))
+(assert (or (>= (+ x y) 10) (<= (- x y) 0)))
+(push)
+(maximize x)
+(check-opt)
+(pop)
+(push)
+(minimize y)
+(check-opt)
+(pop)
+(push)
+(minimize (- y x))
+(check-opt :box)
+(pop)
+(push)
+(maximize y)
+(check-opt)
+(pop)
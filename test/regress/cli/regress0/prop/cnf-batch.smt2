@@ -0,0 +1,31 @@
+; COMMAND-LINE: -i --cnf-batch
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LIA)
+(declare-const a Bool)
+(declare-const b Bool)
+(declare-const c Bool)
+(declare-const d Bool)
+(declare-const x Int)
+(declare-const y Int)
+(define-fun p () Bool (xor a (and b c)))
+(define-fun q () Bool (= (ite a b c) (=> d (< x y))))
+(assert (or p (not q)))
+(assert (=> (and b c) (> x 0)))
+(assert (ite d (= x (+ y 1)) (and (>= y 0) (not (= a b)))))
+(check-sat)
+(push 1)
+; p and q are shared with the assertions above, whose literals were
+; converted in a previous batch
+(assert (and (not p) q (xor a b)))
+(assert (= a (> x y)))
+(assert (or (not d) (not (= b c))))
+(assert (not (= c (and a (< y 0)))))
+(check-sat)
+(pop 1)
+(assert (and (not (xor a b)) (= c d)))
+(check-sat)
+(assert (not (= (ite a b c) (ite (not a) c b))))
+(check-sat)
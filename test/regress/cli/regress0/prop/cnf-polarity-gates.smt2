@@ -0,0 +1,50 @@
+; COMMAND-LINE: -i --cnf-polarity --cnf-gates
+; COMMAND-LINE: -i --cnf-polarity
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: sat
+; EXPECT: sat
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_UF)
+(declare-const a Bool)
+(declare-const b Bool)
+(declare-const c Bool)
+(declare-const d Bool)
+(declare-const e Bool)
+(define-fun i () Bool (ite a b c))
+(define-fun x () Bool (xor b d))
+(define-fun f () Bool (= c (and d e)))
+; an if-then-else and a xor gate encoded by conjunctions of disjunctions
+(define-fun g () Bool (and (or (not a) b) (or a c)))
+(define-fun h () Bool (and (or b d) (or (not b) (not d))))
+; i and x are first converted in the positive polarity only
+(assert (or i x))
+(check-sat)
+(push 1)
+; the negative polarity of i is added by an assertion, the one of x by an
+; assumption
+(assert (not i))
+(check-sat-assuming ((not x)))
+(check-sat-assuming (f (not a)))
+(assert (=> g e))
+(check-sat-assuming ((not e) a b))
+(check-sat)
+(pop 1)
+(check-sat-assuming ((not g) (not f) h))
+(push 1)
+; both polarities of i, f, g and h
+(assert (= i (not f)))
+(assert (not (xor g h)))
+(check-sat)
+(check-sat-assuming ((not e) a (not d)))
+(check-sat-assuming (g (not b) a))
+(pop 1)
+; the negative polarities of i and x were first used in a popped context
+(check-sat-assuming ((not i) (not x)))
+(check-sat-assuming ((not f) (not h)))
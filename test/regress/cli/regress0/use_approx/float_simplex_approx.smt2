@@ -0,0 +1,17 @@
+; COMMAND-LINE: --use-approx
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LRA)
+(declare-const x Real)
+(declare-const y Real)
+(declare-const z Real)
+(declare-const w Real)
+(assert (>= (+ x y z) 10))
+(assert (<= (- x y) 2))
+(assert (<= (+ (* 2 y) (- z)) 3))
+(assert (>= (+ (* 3 x) (* 2 z) w) 7))
+(assert (< (+ x (* 4 w)) 1))
+(assert (and (<= 0 x 5) (<= 0 y 5) (<= 0 z 5) (<= (- 5) w 5)))
+(check-sat)
+(assert (> (+ x y) 9))
+(check-sat)
@@ -320,6 +320,74 @@ TEST_F(TestCApiBlackSolver, check_sat_assuming)
   cvc5_term_manager_delete(tm);
 }
 
+TEST_F(TestCApiBlackSolver, optimize)
+{
+  cvc5_set_option(d_solver, "produce-models", "true");
+  Cvc5Term x = cvc5_mk_const(d_tm, d_int, "x");
+  Cvc5Term b = cvc5_mk_const(d_tm, d_bool, "b");
+  ASSERT_DEATH(
+      cvc5_add_objective(nullptr, x, CVC5_OBJECTIVE_TYPE_MINIMIZE, false),
+      "unexpected NULL argument");
+  ASSERT_DEATH(
+      cvc5_add_objective(d_solver, nullptr, CVC5_OBJECTIVE_TYPE_MINIMIZE, false),
+      "invalid term");
+  ASSERT_DEATH(cvc5_add_objective(
+                   d_solver, x, static_cast<Cvc5ObjectiveType>(-5), false),
+               "invalid objective type");
+  ASSERT_DEATH(
+      cvc5_add_objective(d_solver, b, CVC5_OBJECTIVE_TYPE_MINIMIZE, false),
+      "expected a term of sort Int, Real or of a bit-vector sort");
+  ASSERT_DEATH(cvc5_assert_soft(nullptr, b, 1, ""),
+               "unexpected NULL argument");
+  ASSERT_DEATH(cvc5_assert_soft(d_solver, nullptr, 1, ""), "invalid term");
+  ASSERT_DEATH(cvc5_assert_soft(d_solver, b, 1, nullptr),
+               "unexpected NULL argument");
+  ASSERT_DEATH(cvc5_assert_soft(d_solver, x, 1, ""), "Expected term with sort");
+  ASSERT_DEATH(cvc5_assert_soft(d_solver, b, 0, ""), "expected a weight > 0");
+  ASSERT_DEATH(cvc5_optimize(nullptr, CVC5_OPTIMIZATION_MODE_LEX),
+               "unexpected NULL argument");
+  ASSERT_DEATH(
+      cvc5_optimize(d_solver, static_cast<Cvc5OptimizationMode>(-5)),
+      "invalid optimization mode");
+  size_t size;
+  ASSERT_DEATH(cvc5_get_objective_values(nullptr, &size),
+               "unexpected NULL argument");
+  ASSERT_DEATH(cvc5_get_objective_values(d_solver, nullptr),
+               "unexpected NULL argument");
+
+  std::vector<Cvc5Term> args = {x, cvc5_mk_integer_int64(d_tm, 3)};
+  cvc5_assert_formula(
+      d_solver, cvc5_mk_term(d_tm, CVC5_KIND_LEQ, args.size(), args.data()));
+  cvc5_add_objective(d_solver, x, CVC5_OBJECTIVE_TYPE_MAXIMIZE, false);
+  ASSERT_TRUE(
+      cvc5_result_is_sat(cvc5_optimize(d_solver, CVC5_OPTIMIZATION_MODE_LEX)));
+  ASSERT_TRUE(cvc5_term_is_equal(cvc5_get_value(d_solver, x),
+                                 cvc5_mk_integer_int64(d_tm, 3)));
+  const Cvc5Term* values = cvc5_get_objective_values(d_solver, &size);
+  ASSERT_EQ(size, 1);
+  ASSERT_TRUE(
+      cvc5_term_is_equal(values[0], cvc5_mk_integer_int64(d_tm, 3)));
+  ASSERT_TRUE(
+      cvc5_result_is_sat(cvc5_optimize(d_solver, CVC5_OPTIMIZATION_MODE_BOX)));
+
+  ASSERT_DEATH(cvc5_optimize_with_callback(
+                   d_solver, CVC5_OPTIMIZATION_MODE_LEX, nullptr, nullptr),
+               "unexpected NULL argument");
+  // stop at the first model
+  size_t calls = 0;
+  ASSERT_TRUE(cvc5_result_is_unknown(cvc5_optimize_with_callback(
+      d_solver,
+      CVC5_OPTIMIZATION_MODE_LEX,
+      &calls,
+      [](size_t size, const Cvc5Term* values, void* state) {
+        (*static_cast<size_t*>(state))++;
+        return false;
+      })));
+  ASSERT_EQ(calls, 1);
+  values = cvc5_get_objective_values(d_solver, &size);
+  ASSERT_EQ(size, 1);
+}
+
 TEST_F(TestCApiBlackSolver, check_sat_assuming1)
 {
   Cvc5Term x = cvc5_mk_const(d_tm, d_bool, "x");
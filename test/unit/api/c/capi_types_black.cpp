@@ -51,6 +51,12 @@ TEST_F(TestCApiBlackTypes, printEnum)
   ASSERT_DEATH(cvc5_modes_learned_lit_type_to_string(
                    static_cast<Cvc5LearnedLitType>(-5)),
                "invalid learned literal type");
+  ASSERT_DEATH(cvc5_modes_objective_type_to_string(
+                   static_cast<Cvc5ObjectiveType>(-5)),
+               "invalid objective type");
+  ASSERT_DEATH(cvc5_modes_optimization_mode_to_string(
+                   static_cast<Cvc5OptimizationMode>(-5)),
+               "invalid optimization mode");
   ASSERT_DEATH(
       cvc5_modes_proof_component_to_string(static_cast<Cvc5ProofComponent>(-5)),
       "invalid proof component kind");
@@ -59,7 +65,7 @@ TEST_F(TestCApiBlackTypes, printEnum)
       "invalid proof format");
   std::string expected =
       "CVC5_KIND_LT CVC5_SORT_KIND_ARRAY_SORT RTZ UNKNOWN_REASON literals "
-      "preprocess full enum smt_lib_2_6 lfsc";
+      "preprocess full enum minimize pareto smt_lib_2_6 lfsc";
   std::stringstream ss;
   ss << cvc5_kind_to_string(CVC5_KIND_LT) << " ";
   ss << cvc5_sort_kind_to_string(CVC5_SORT_KIND_ARRAY_SORT) << " ";
@@ -74,6 +80,10 @@ TEST_F(TestCApiBlackTypes, printEnum)
   ss << cvc5_modes_proof_component_to_string(CVC5_PROOF_COMPONENT_FULL) << " ";
   ss << cvc5_modes_find_synth_target_to_string(CVC5_FIND_SYNTH_TARGET_ENUM)
      << " ";
+  ss << cvc5_modes_objective_type_to_string(CVC5_OBJECTIVE_TYPE_MINIMIZE)
+     << " ";
+  ss << cvc5_modes_optimization_mode_to_string(CVC5_OPTIMIZATION_MODE_PARETO)
+     << " ";
   ss << cvc5_modes_input_language_to_string(CVC5_INPUT_LANGUAGE_SMT_LIB_2_6)
      << " ";
   ss << cvc5_modes_proof_format_to_string(CVC5_PROOF_FORMAT_LFSC);
@@ -173,6 +173,10 @@ TEST_F(TestCApiBlackUncovered, stream_operators)
      << std::to_string(cvc5::modes::ProofComponent::FULL);
   ss << cvc5::modes::FindSynthTarget::ENUM
      << std::to_string(cvc5::modes::FindSynthTarget::ENUM);
+  ss << cvc5::modes::ObjectiveType::MINIMIZE
+     << std::to_string(cvc5::modes::ObjectiveType::MINIMIZE);
+  ss << cvc5::modes::OptimizationMode::PARETO
+     << std::to_string(cvc5::modes::OptimizationMode::PARETO);
   ss << cvc5::modes::InputLanguage::SMT_LIB_2_6
      << std::to_string(cvc5::modes::InputLanguage::SMT_LIB_2_6);
   ss << cvc5::modes::ProofFormat::LFSC
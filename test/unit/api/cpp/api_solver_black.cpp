@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <set>
 
 #include "base/output.h"
 #include "test_api.h"
@@ -263,6 +264,448 @@ TEST_F(TestApiBlackSolver, checkSatAssuming2)
       CVC5ApiException);
 }
 
+TEST_F(TestApiBlackSolver, addObjective)
+{
+  Term x = d_tm.mkConst(d_int, "x");
+  Term r = d_tm.mkConst(d_real, "r");
+  Term b = d_tm.mkConst(d_bool, "b");
+  Term bv = d_tm.mkConst(d_tm.mkBitVectorSort(8), "bv");
+  ASSERT_NO_THROW(d_solver->addObjective(x, modes::ObjectiveType::MINIMIZE));
+  ASSERT_NO_THROW(
+      d_solver->addObjective(bv, modes::ObjectiveType::MAXIMIZE, true));
+  ASSERT_NO_THROW(d_solver->addObjective(r, modes::ObjectiveType::MINIMIZE));
+  ASSERT_THROW(d_solver->addObjective(b, modes::ObjectiveType::MINIMIZE),
+               CVC5ApiException);
+  ASSERT_THROW(d_solver->addObjective(Term(), modes::ObjectiveType::MINIMIZE),
+               CVC5ApiException);
+
+  TermManager tm;
+  Solver slv(tm);
+  ASSERT_THROW(slv.addObjective(x, modes::ObjectiveType::MINIMIZE),
+               CVC5ApiException);
+}
+
+TEST_F(TestApiBlackSolver, optimize)
+{
+  d_solver->setOption("produce-models", "true");
+  Term x = d_tm.mkConst(d_int, "x");
+  Term y = d_tm.mkConst(d_int, "y");
+  Term sum = d_tm.mkTerm(Kind::ADD, {x, y});
+  // 2 <= x <= 10, 3 <= y, x + y >= 7
+  d_solver->assertFormula(d_tm.mkTerm(Kind::LEQ, {d_tm.mkInteger(2), x}));
+  d_solver->assertFormula(d_tm.mkTerm(Kind::LEQ, {x, d_tm.mkInteger(10)}));
+  d_solver->assertFormula(d_tm.mkTerm(Kind::LEQ, {d_tm.mkInteger(3), y}));
+  d_solver->assertFormula(d_tm.mkTerm(Kind::GEQ, {sum, d_tm.mkInteger(7)}));
+  // no objectives, behaves like check-sat
+  ASSERT_TRUE(d_solver->optimize().isSat());
+
+  d_solver->push();
+  d_solver->addObjective(sum, modes::ObjectiveType::MINIMIZE);
+  d_solver->addObjective(x, modes::ObjectiveType::MAXIMIZE);
+  cvc5::Result res = d_solver->optimize();
+  ASSERT_TRUE(res.isSat());
+  ASSERT_EQ(d_solver->getValue(sum), d_tm.mkInteger(7));
+  ASSERT_EQ(d_solver->getValue(x), d_tm.mkInteger(4));
+  std::vector<Term> values = {d_tm.mkInteger(7), d_tm.mkInteger(4)};
+  ASSERT_EQ(d_solver->getObjectiveValues(), values);
+  // the bounds used during optimization are not visible as assertions
+  ASSERT_EQ(d_solver->getAssertions().size(), 4);
+  d_solver->pop();
+
+  // objectives are removed on pop
+  d_solver->addObjective(x, modes::ObjectiveType::MAXIMIZE);
+  ASSERT_TRUE(d_solver->optimize().isSat());
+  ASSERT_EQ(d_solver->getValue(x), d_tm.mkInteger(10));
+
+  d_solver->assertFormula(d_tm.mkTerm(Kind::LT, {x, d_tm.mkInteger(2)}));
+  ASSERT_TRUE(d_solver->optimize().isUnsat());
+}
+
+TEST_F(TestApiBlackSolver, optimizeBv)
+{
+  d_solver->setOption("produce-models", "true");
+  Sort bv8 = d_tm.mkBitVectorSort(8);
+  Term x = d_tm.mkConst(bv8, "x");
+  // x is not in [-2, 2], as a signed value
+  d_solver->assertFormula(d_tm.mkTerm(
+      Kind::OR,
+      {d_tm.mkTerm(Kind::BITVECTOR_SLT, {x, d_tm.mkBitVector(8, -2)}),
+       d_tm.mkTerm(Kind::BITVECTOR_SGT, {x, d_tm.mkBitVector(8, 2)})}));
+  d_solver->push();
+  d_solver->addObjective(x, modes::ObjectiveType::MINIMIZE, false);
+  ASSERT_TRUE(d_solver->optimize().isSat());
+  ASSERT_EQ(d_solver->getValue(x), d_tm.mkBitVector(8, 3));
+  d_solver->pop();
+  d_solver->push();
+  d_solver->addObjective(x, modes::ObjectiveType::MAXIMIZE, true);
+  ASSERT_TRUE(d_solver->optimize().isSat());
+  ASSERT_EQ(d_solver->getValue(x), d_tm.mkBitVector(8, 127));
+  d_solver->pop();
+
+  // the low byte of y is 42 and y > 2^40
+  Sort bv64 = d_tm.mkBitVectorSort(64);
+  Term y = d_tm.mkConst(bv64, "y");
+  d_solver->assertFormula(d_tm.mkTerm(
+      Kind::EQUAL,
+      {d_tm.mkTerm(Kind::BITVECTOR_AND, {y, d_tm.mkBitVector(64, 255)}),
+       d_tm.mkBitVector(64, 42)}));
+  d_solver->assertFormula(d_tm.mkTerm(
+      Kind::BITVECTOR_UGT, {y, d_tm.mkBitVector(64, 1099511627776)}));
+  d_solver->addObjective(y, modes::ObjectiveType::MINIMIZE);
+  ASSERT_TRUE(d_solver->optimize().isSat());
+  ASSERT_EQ(d_solver->getValue(y), d_tm.mkBitVector(64, 1099511627818));
+}
+
+TEST_F(TestApiBlackSolver, optimizeReal)
+{
+  d_solver->setOption("produce-models", "true");
+  Term x = d_tm.mkConst(d_real, "x");
+  Term y = d_tm.mkConst(d_real, "y");
+  Term zero = d_tm.mkReal(0);
+  Term sum = d_tm.mkTerm(Kind::ADD, {x, y});
+  // x, y >= 0, x + 2y <= 4, 3x + y <= 6
+  d_solver->assertFormula(d_tm.mkTerm(Kind::GEQ, {x, zero}));
+  d_solver->assertFormula(d_tm.mkTerm(Kind::GEQ, {y, zero}));
+  d_solver->assertFormula(d_tm.mkTerm(
+      Kind::LEQ,
+      {d_tm.mkTerm(Kind::ADD,
+                   {x, d_tm.mkTerm(Kind::MULT, {d_tm.mkReal(2), y})}),
+       d_tm.mkReal(4)}));
+  d_solver->assertFormula(d_tm.mkTerm(
+      Kind::LEQ,
+      {d_tm.mkTerm(Kind::ADD,
+                   {d_tm.mkTerm(Kind::MULT, {d_tm.mkReal(3), x}), y}),
+       d_tm.mkReal(6)}));
+  d_solver->push();
+  d_solver->addObjective(sum, modes::ObjectiveType::MAXIMIZE);
+  ASSERT_TRUE(d_solver->optimize().isSat());
+  ASSERT_EQ(d_solver->getValue(sum), d_tm.mkReal(14, 5));
+  ASSERT_EQ(d_solver->getValue(x), d_tm.mkReal(8, 5));
+  d_solver->pop();
+
+  // the infimum 0 of x is not attained
+  d_solver->assertFormula(d_tm.mkTerm(Kind::GT, {x, zero}));
+  d_solver->addObjective(x, modes::ObjectiveType::MINIMIZE);
+  ASSERT_TRUE(d_solver->optimize().isUnknown());
+}
+
+TEST_F(TestApiBlackSolver, optimizeModes)
+{
+  d_solver->setOption("produce-models", "true");
+  Term x = d_tm.mkConst(d_int, "x");
+  Term y = d_tm.mkConst(d_int, "y");
+  Term zero = d_tm.mkInteger(0);
+  Term two = d_tm.mkInteger(2);
+  // x, y >= 0, x + y <= 2
+  d_solver->assertFormula(d_tm.mkTerm(Kind::GEQ, {x, zero}));
+  d_solver->assertFormula(d_tm.mkTerm(Kind::GEQ, {y, zero}));
+  d_solver->assertFormula(
+      d_tm.mkTerm(Kind::LEQ, {d_tm.mkTerm(Kind::ADD, {x, y}), two}));
+  d_solver->addObjective(x, modes::ObjectiveType::MAXIMIZE);
+  d_solver->addObjective(y, modes::ObjectiveType::MAXIMIZE);
+
+  ASSERT_TRUE(d_solver->optimize(modes::OptimizationMode::LEX).isSat());
+  std::vector<Term> values = {two, zero};
+  ASSERT_EQ(d_solver->getObjectiveValues(), values);
+
+  // each objective is optimal, but not in the same model
+  ASSERT_TRUE(d_solver->optimize(modes::OptimizationMode::BOX).isSat());
+  values = {two, two};
+  ASSERT_EQ(d_solver->getObjectiveValues(), values);
+  ASSERT_EQ(d_solver->getValue(y), two);
+
+  // enumerate the Pareto front
+  std::set<std::pair<Term, Term>> front;
+  for (size_t i = 0; i < 3; i++)
+  {
+    ASSERT_TRUE(d_solver->optimize(modes::OptimizationMode::PARETO).isSat());
+    values = d_solver->getObjectiveValues();
+    ASSERT_EQ(values.size(), 2);
+    ASSERT_EQ(d_solver->getValue(x), values[0]);
+    ASSERT_EQ(d_solver->getValue(y), values[1]);
+    front.emplace(values[0], values[1]);
+  }
+  std::set<std::pair<Term, Term>> expected = {
+      {two, zero}, {d_tm.mkInteger(1), d_tm.mkInteger(1)}, {zero, two}};
+  ASSERT_EQ(front, expected);
+  ASSERT_TRUE(d_solver->optimize(modes::OptimizationMode::PARETO).isUnsat());
+  ASSERT_TRUE(d_solver->getObjectiveValues().empty());
+
+  // the front is enumerated again if the assertions change
+  d_solver->assertFormula(d_tm.mkTerm(Kind::LEQ, {x, d_tm.mkInteger(1)}));
+  ASSERT_TRUE(d_solver->optimize(modes::OptimizationMode::PARETO).isSat());
+}
+
+TEST_F(TestApiBlackSolver, optimizeCallback)
+{
+  d_solver->setOption("produce-models", "true");
+  Sort bv8 = d_tm.mkBitVectorSort(8);
+  Term x = d_tm.mkConst(bv8, "x");
+  Term bound = d_tm.mkBitVector(8, 0xf0);
+  d_solver->assertFormula(d_tm.mkTerm(Kind::BITVECTOR_ULT, {x, bound}));
+  d_solver->addObjective(x, modes::ObjectiveType::MAXIMIZE);
+  ASSERT_THROW(d_solver->optimize(modes::OptimizationMode::LEX, nullptr),
+               CVC5ApiException);
+
+  // each reported value improves on the previous one
+  std::vector<Term> reported;
+  ASSERT_TRUE(d_solver
+                  ->optimize(modes::OptimizationMode::LEX,
+                             [&](const std::vector<Term>& values) {
+                               EXPECT_EQ(values.size(), 1);
+                               EXPECT_EQ(d_solver->getValue(x), values[0]);
+                               reported.push_back(values[0]);
+                               return true;
+                             })
+                  .isSat());
+  ASSERT_FALSE(reported.empty());
+  for (size_t i = 1, size = reported.size(); i < size; i++)
+  {
+    ASSERT_LT(std::stoul(reported[i - 1].getBitVectorValue(10)),
+              std::stoul(reported[i].getBitVectorValue(10)));
+  }
+  Term optimum = d_tm.mkBitVector(8, 0xef);
+  ASSERT_EQ(reported.back(), optimum);
+  ASSERT_EQ(d_solver->getObjectiveValues(), std::vector<Term>{optimum});
+
+  // stopping the search returns the best value found so far
+  reported.clear();
+  ASSERT_TRUE(d_solver
+                  ->optimize(modes::OptimizationMode::LEX,
+                             [&](const std::vector<Term>& values) {
+                               reported.push_back(values[0]);
+                               return false;
+                             })
+                  .isUnknown());
+  ASSERT_EQ(reported.size(), 1);
+  ASSERT_EQ(d_solver->getObjectiveValues(), reported);
+}
+
+TEST_F(TestApiBlackSolver, optimizeBounds)
+{
+  d_solver->setOption("produce-models", "true");
+  Term x = d_tm.mkConst(d_int, "x");
+  Term y = d_tm.mkConst(d_int, "y");
+  // x + y <= 10, x <= 2 * y, minimize y - x
+  d_solver->assertFormula(d_tm.mkTerm(
+      Kind::LEQ, {d_tm.mkTerm(Kind::ADD, {x, y}), d_tm.mkInteger(10)}));
+  d_solver->assertFormula(d_tm.mkTerm(
+      Kind::LEQ, {x, d_tm.mkTerm(Kind::MULT, {d_tm.mkInteger(2), y})}));
+  d_solver->addObjective(d_tm.mkTerm(Kind::SUB, {y, x}),
+                         modes::ObjectiveType::MINIMIZE);
+  auto callback = [](const std::vector<Term>&) { return true; };
+  std::vector<Term> optimum = {d_tm.mkInteger(-3)};
+
+  // values that are not attained are ignored
+  ASSERT_TRUE(d_solver
+                  ->optimize(modes::OptimizationMode::LEX,
+                             callback,
+                             [&]() {
+                               return std::vector<Term>{d_tm.mkInteger(-5)};
+                             })
+                  .isSat());
+  ASSERT_EQ(d_solver->getObjectiveValues(), optimum);
+
+  // the optimum found elsewhere is reached directly
+  ASSERT_TRUE(
+      d_solver
+          ->optimize(
+              modes::OptimizationMode::LEX, callback, [&]() { return optimum; })
+          .isSat());
+  ASSERT_EQ(d_solver->getObjectiveValues(), optimum);
+
+  // values of the wrong size or sort are ignored
+  ASSERT_TRUE(d_solver
+                  ->optimize(modes::OptimizationMode::LEX,
+                             callback,
+                             [&]() {
+                               return std::vector<Term>{d_tm.mkTrue(),
+                                                        d_tm.mkInteger(0)};
+                             })
+                  .isSat());
+  ASSERT_EQ(d_solver->getObjectiveValues(), optimum);
+}
+
+TEST_F(TestApiBlackSolver, optimizeBoundCallback)
+{
+  d_solver->setOption("produce-models", "true");
+  d_solver->setOption("produce-unsat-assumptions", "true");
+  auto callback = [](const std::vector<Term>&) { return true; };
+
+  // the bounds of a bit-vector objective tighten down to the optimum
+  Sort bv8 = d_tm.mkBitVectorSort(8);
+  Term x = d_tm.mkConst(bv8, "x");
+  d_solver->push();
+  d_solver->assertFormula(
+      d_tm.mkTerm(Kind::BITVECTOR_ULT, {x, d_tm.mkBitVector(8, 0xf0)}));
+  d_solver->addObjective(x, modes::ObjectiveType::MAXIMIZE);
+  std::vector<Term> bounds;
+  ASSERT_TRUE(d_solver
+                  ->optimize(modes::OptimizationMode::LEX,
+                             callback,
+                             nullptr,
+                             [&](const std::vector<Term>& values) {
+                               EXPECT_EQ(values.size(), 1);
+                               bounds.push_back(values[0]);
+                               return true;
+                             })
+                  .isSat());
+  ASSERT_FALSE(bounds.empty());
+  for (size_t i = 1, size = bounds.size(); i < size; i++)
+  {
+    ASSERT_GT(std::stoul(bounds[i - 1].getBitVectorValue(10)),
+              std::stoul(bounds[i].getBitVectorValue(10)));
+  }
+  ASSERT_EQ(bounds.back(), d_tm.mkBitVector(8, 0xef));
+  d_solver->pop();
+
+  // the cores of MaxSMT raise the lower bound on the penalty, which is
+  // unknown for the objective that is not optimized yet
+  Term a = d_tm.mkConst(d_bool, "a");
+  Term b = d_tm.mkConst(d_bool, "b");
+  Term c = d_tm.mkConst(d_bool, "c");
+  d_solver->assertFormula(d_tm.mkTerm(Kind::OR, {a.notTerm(), b.notTerm()}));
+  d_solver->assertFormula(d_tm.mkTerm(Kind::OR, {b.notTerm(), c.notTerm()}));
+  d_solver->assertSoft(a, 2, "p");
+  d_solver->assertSoft(b, 3, "p");
+  d_solver->assertSoft(c, 2, "p");
+  d_solver->assertSoft(a.notTerm(), 1, "q");
+  bounds.clear();
+  std::vector<std::vector<Term>> reported;
+  ASSERT_TRUE(d_solver
+                  ->optimize(modes::OptimizationMode::LEX,
+                             callback,
+                             nullptr,
+                             [&](const std::vector<Term>& values) {
+                               EXPECT_EQ(values.size(), 2);
+                               reported.push_back(values);
+                               return true;
+                             })
+                  .isSat());
+  ASSERT_FALSE(reported.empty());
+  ASSERT_TRUE(reported[0][1].isNull());
+  ASSERT_EQ(reported.back(),
+            (std::vector<Term>{d_tm.mkInteger(3), d_tm.mkInteger(1)}));
+  ASSERT_EQ(d_solver->getObjectiveValues(), reported.back());
+
+  // stopping at the first bound returns the best values found so far
+  reported.clear();
+  ASSERT_TRUE(d_solver
+                  ->optimize(modes::OptimizationMode::LEX,
+                             callback,
+                             nullptr,
+                             [&](const std::vector<Term>& values) {
+                               reported.push_back(values);
+                               return false;
+                             })
+                  .isUnknown());
+  ASSERT_EQ(reported.size(), 1);
+  ASSERT_FALSE(d_solver->getObjectiveValues().empty());
+}
+
+TEST_F(TestApiBlackSolver, optimizePhase)
+{
+  // A vertex cover of a cycle containing v0, whose unique optimum is the set
+  // of even vertices. Preferring the phases of the incumbents does not change
+  // the optimum nor the model, also not for a query after the optimization.
+  std::vector<std::vector<Term>> models;
+  for (bool optPhase : {true, false})
+  {
+    Solver solver(d_tm);
+    solver.setOption("produce-models", "true");
+    solver.setOption("opt-phase", optPhase ? "true" : "false");
+    std::vector<Term> vs;
+    std::vector<Term> costs;
+    for (size_t i = 0; i < 12; i++)
+    {
+      vs.push_back(d_tm.mkConst(d_bool, "v" + std::to_string(i)));
+      costs.push_back(d_tm.mkTerm(
+          Kind::ITE, {vs.back(), d_tm.mkInteger(1), d_tm.mkInteger(0)}));
+    }
+    for (size_t i = 0; i < 12; i++)
+    {
+      solver.assertFormula(d_tm.mkTerm(Kind::OR, {vs[i], vs[(i + 1) % 12]}));
+    }
+    solver.assertFormula(vs[0]);
+    Term cost = d_tm.mkTerm(Kind::ADD, costs);
+    solver.addObjective(cost, modes::ObjectiveType::MINIMIZE);
+    ASSERT_TRUE(solver.optimize().isSat());
+    ASSERT_EQ(solver.getObjectiveValues(),
+              std::vector<Term>{d_tm.mkInteger(6)});
+    models.push_back(solver.getValue(vs));
+    ASSERT_TRUE(solver.checkSat().isSat());
+    ASSERT_TRUE(solver.optimize().isSat());
+    ASSERT_EQ(solver.getObjectiveValues(),
+              std::vector<Term>{d_tm.mkInteger(6)});
+    ASSERT_EQ(solver.getValue(vs), models.back());
+  }
+  ASSERT_EQ(models[0], models[1]);
+}
+
+TEST_F(TestApiBlackSolver, assertSoft)
+{
+  d_solver->setOption("produce-models", "true");
+  d_solver->setOption("produce-unsat-assumptions", "true");
+  Term x = d_tm.mkConst(d_bool, "x");
+  Term y = d_tm.mkConst(d_bool, "y");
+  Term z = d_tm.mkConst(d_bool, "z");
+  Term i = d_tm.mkConst(d_int, "i");
+  ASSERT_THROW(d_solver->assertSoft(i), CVC5ApiException);
+  ASSERT_THROW(d_solver->assertSoft(x, 0), CVC5ApiException);
+  ASSERT_THROW(d_solver->assertSoft(Term()), CVC5ApiException);
+
+  // x excludes y and z
+  d_solver->assertFormula(d_tm.mkTerm(Kind::OR, {x.notTerm(), y.notTerm()}));
+  d_solver->assertFormula(d_tm.mkTerm(Kind::OR, {x.notTerm(), z.notTerm()}));
+  d_solver->push();
+  d_solver->assertSoft(x, 3);
+  d_solver->assertSoft(y, 2);
+  d_solver->assertSoft(z, 2);
+  ASSERT_TRUE(d_solver->optimize().isSat());
+  ASSERT_EQ(d_solver->getValue(x), d_tm.mkFalse());
+  std::vector<Term> values = {d_tm.mkInteger(3)};
+  ASSERT_EQ(d_solver->getObjectiveValues(), values);
+  d_solver->pop();
+
+  // the soft constraints with id "a" are optimized before those with id "b"
+  d_solver->assertSoft(x, 5, "a");
+  d_solver->assertSoft(y, 2, "a");
+  d_solver->assertSoft(z, 2, "b");
+  d_solver->assertSoft(y.notTerm(), 1, "b");
+  d_solver->assertSoft(z.notTerm(), 4, "b");
+  ASSERT_TRUE(d_solver->optimize().isSat());
+  ASSERT_EQ(d_solver->getValue(x), d_tm.mkTrue());
+  values = {d_tm.mkInteger(2), d_tm.mkInteger(2)};
+  ASSERT_EQ(d_solver->getObjectiveValues(), values);
+
+  // many soft constraints of distinct weights, at most one of them holds
+  std::vector<Term> bits;
+  for (int64_t j = 1; j <= 10; j++)
+  {
+    bits.push_back(d_tm.mkConst(d_bool));
+    d_solver->assertSoft(bits.back(), j, "c");
+  }
+  for (size_t j = 0; j < bits.size(); j++)
+  {
+    for (size_t k = j + 1; k < bits.size(); k++)
+    {
+      d_solver->assertFormula(
+          d_tm.mkTerm(Kind::OR, {bits[j].notTerm(), bits[k].notTerm()}));
+    }
+  }
+  ASSERT_TRUE(d_solver->optimize().isSat());
+  ASSERT_EQ(d_solver->getValue(bits.back()), d_tm.mkTrue());
+  values = {d_tm.mkInteger(2), d_tm.mkInteger(2), d_tm.mkInteger(45)};
+  ASSERT_EQ(d_solver->getObjectiveValues(), values);
+}
+
+TEST_F(TestApiBlackSolver, optimizeNoIncremental)
+{
+  d_solver->setOption("incremental", "false");
+  d_solver->setOption("produce-models", "true");
+  ASSERT_THROW(d_solver->optimize(), CVC5ApiException);
+}
+
 TEST_F(TestApiBlackSolver, declareFunFresh)
 {
   Term t1 = d_solver->declareFun(std::string("b"), {}, d_bool, true);
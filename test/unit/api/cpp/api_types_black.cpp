@@ -33,7 +33,7 @@ TEST_F(TestApiTypes, printEnum)
   std::string expected =
       "LT ARRAY_SORT RTZ UNKNOWN_REASON literals preprocess full "
       "enum "
-      "smt_lib_2_6 lfsc";
+      "minimize pareto smt_lib_2_6 lfsc";
   {
     std::stringstream ss;
     ss << cvc5::Kind::LT << " ";
@@ -44,6 +44,8 @@ TEST_F(TestApiTypes, printEnum)
     ss << cvc5::modes::LearnedLitType::PREPROCESS << " ";
     ss << cvc5::modes::ProofComponent::FULL << " ";
     ss << cvc5::modes::FindSynthTarget::ENUM << " ";
+    ss << cvc5::modes::ObjectiveType::MINIMIZE << " ";
+    ss << cvc5::modes::OptimizationMode::PARETO << " ";
     ss << cvc5::modes::InputLanguage::SMT_LIB_2_6 << " ";
     ss << cvc5::modes::ProofFormat::LFSC;
     ASSERT_EQ(ss.str(), expected);
@@ -58,6 +60,8 @@ TEST_F(TestApiTypes, printEnum)
     ss << std::to_string(cvc5::modes::LearnedLitType::PREPROCESS) << " ";
     ss << std::to_string(cvc5::modes::ProofComponent::FULL) << " ";
     ss << std::to_string(cvc5::modes::FindSynthTarget::ENUM) << " ";
+    ss << std::to_string(cvc5::modes::ObjectiveType::MINIMIZE) << " ";
+    ss << std::to_string(cvc5::modes::OptimizationMode::PARETO) << " ";
     ss << std::to_string(cvc5::modes::InputLanguage::SMT_LIB_2_6) << " ";
     ss << std::to_string(cvc5::modes::ProofFormat::LFSC);
     ASSERT_EQ(ss.str(), expected);
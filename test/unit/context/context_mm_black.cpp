@@ -102,5 +102,44 @@ TEST_F(TestContextBlackMM, push_pop)
 #endif
 }
 
+TEST_F(TestContextBlackMM, retention)
+{
+#ifndef CVC5_DEBUG_CONTEXT_MEMORY_MANAGER
+  // Repeated push/pop cycles that use more chunks than the minimal number of
+  // retained free chunks reuse the chunks of the first cycle
+  uint32_t len = 4096;
+  uint32_t n = 200 * 4;
+  for (uint32_t p = 0; p < 5; ++p)
+  {
+    d_cmm->push();
+    for (uint32_t i = 0; i < n; ++i)
+    {
+      ASSERT_NE(d_cmm->newData(len), nullptr);
+    }
+    d_cmm->pop();
+  }
+  const ContextMemoryStatistics& stats = d_cmm->getStatistics();
+  ASSERT_GE(stats.d_maxChunksInUse, 200u);
+  ASSERT_EQ(stats.d_chunksAllocated, stats.d_maxChunksInUse);
+  ASSERT_EQ(stats.d_chunksFreed, 0u);
+  ASSERT_EQ(stats.d_chunksReused, 4 * (stats.d_maxChunksInUse - 1));
+
+  // chunks of a larger size, carved from slabs
+  ContextMemoryConfig config;
+  config.d_chunkSize = 65536;
+  config.d_hugePages = true;
+  ContextMemoryManager cmm(config);
+  cmm.push();
+  for (uint32_t i = 0; i < 100; ++i)
+  {
+    char* data = static_cast<char*>(cmm.newData(65536));
+    data[0] = data[65535] = 'a';
+  }
+  cmm.pop();
+  ASSERT_EQ(cmm.getStatistics().d_maxChunksInUse, 100u);
+  ASSERT_GE(cmm.getStatistics().d_chunksAllocated, 100u);
+#endif
+}
+
 }  // namespace test
 }  // namespace cvc5::internal
@@ -19,6 +19,8 @@
 #include <utility>
 #include <array>
 #include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 namespace cvc5::internal {
 namespace test {
@@ -248,5 +250,90 @@ TEST_F(AttrHashFixture, repeated_inserts)
             std::make_pair(std::make_pair(uint64_t{42}, nC.d_nv), 12));
 }
 
+TEST_F(AttrHashFixture, dense_pages)
+{
+  // enough nodes to turn their pages of the table into dense arrays
+  std::vector<Node> nodes;
+  for (size_t i = 0; i < 3000; ++i)
+  {
+    nodes.push_back(d_nodeManager->mkVar("x", d_booleanType));
+  }
+  Hash<int> hash;
+  for (size_t i = 0; i < nodes.size(); ++i)
+  {
+    hash[std::make_pair(uint64_t{1}, nodes[i].d_nv)] = static_cast<int>(i);
+  }
+  EXPECT_EQ(hash.size(), nodes.size());
+  EXPECT_EQ(static_cast<size_t>(std::distance(hash.begin(), hash.end())),
+            nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i)
+  {
+    auto it = hash.find(std::make_pair(uint64_t{1}, nodes[i].d_nv));
+    ASSERT_NE(it, hash.end());
+    EXPECT_EQ((*it).second, static_cast<int>(i));
+  }
+
+  // erase every other entry while iterating
+  size_t erased = 0;
+  for (auto it = hash.begin(); it != hash.end();)
+  {
+    if ((*it).second % 2 == 0)
+    {
+      it = hash.erase(it);
+      ++erased;
+    }
+    else
+    {
+      ++it;
+    }
+  }
+  EXPECT_EQ(erased, (nodes.size() + 1) / 2);
+  EXPECT_EQ(hash.size(), nodes.size() - erased);
+  for (size_t i = 0; i < nodes.size(); ++i)
+  {
+    auto it = hash.find(std::make_pair(uint64_t{1}, nodes[i].d_nv));
+    EXPECT_EQ(it == hash.end(), i % 2 == 0);
+  }
+
+  // erase the rest by node value
+  for (const Node& n : nodes)
+  {
+    hash.eraseBy(n.d_nv);
+  }
+  EXPECT_EQ(hash.size(), 0u);
+  EXPECT_EQ(hash.begin(), hash.end());
+}
+
+TEST_F(AttrHashFixture, lookup_many)
+{
+  // Lookups in a large table agree with a table that hashes node values,
+  // which is how attribute tables were indexed before.
+  std::vector<Node> nodes;
+  for (size_t i = 0; i < 20000; ++i)
+  {
+    nodes.push_back(d_nodeManager->mkVar("x", d_booleanType));
+  }
+  Hash<int> hash;
+  std::unordered_map<expr::NodeValue*, int> baseline;
+  for (size_t i = 0; i < nodes.size(); i += 3)
+  {
+    hash[std::make_pair(uint64_t{7}, nodes[i].d_nv)] = static_cast<int>(i);
+    baseline[nodes[i].d_nv] = static_cast<int>(i);
+  }
+  size_t found = 0;
+  for (const Node& n : nodes)
+  {
+    auto it = hash.find(std::make_pair(uint64_t{7}, n.d_nv));
+    auto bit = baseline.find(n.d_nv);
+    ASSERT_EQ(it != hash.end(), bit != baseline.end());
+    if (it != hash.end())
+    {
+      EXPECT_EQ((*it).second, bit->second);
+      ++found;
+    }
+  }
+  EXPECT_EQ(found, baseline.size());
+}
+
 } // namespace test
 } // namespace cvc5::internal
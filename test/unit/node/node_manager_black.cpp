@@ -15,6 +15,9 @@
 
 #include <string>
 #include <vector>
+#ifdef CVC5_THREAD_SAFE_NODES
+#include <thread>
+#endif
 
 #include "base/output.h"
 #include "expr/node_manager.h"
@@ -312,5 +315,54 @@ TEST_F(TestNodeBlackNodeManager, mkNode_too_many_children)
                "toSize > d_nvMaxChildren");
 #endif
 }
+
+#ifdef CVC5_THREAD_SAFE_NODES
+TEST_F(TestNodeBlackNodeManager, concurrent_construction)
+{
+  // Several threads build (and drop) the same terms over shared variables.
+  // Equal terms must be hash-consed to the same node, and garbage collection
+  // must not reclaim nodes that are concurrently taken from the pool.
+  constexpr size_t nthreads = 4;
+  constexpr size_t nvars = 64;
+  TypeNode intType = d_nodeManager->integerType();
+  std::vector<Node> vars;
+  for (size_t i = 0; i < nvars; ++i)
+  {
+    vars.push_back(d_skolemManager->mkDummySkolem("x", intType));
+  }
+  std::vector<std::vector<Node>> results(nthreads);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < nthreads; ++t)
+  {
+    threads.emplace_back([&, t]() {
+      for (size_t round = 0; round < 20; ++round)
+      {
+        std::vector<Node> terms;
+        for (size_t i = 0; i < nvars; ++i)
+        {
+          Node c = d_nodeManager->mkConstInt(Rational(i % 7));
+          Node sum = d_nodeManager->mkNode(
+              Kind::ADD, vars[i], vars[(i + 1) % nvars], c);
+          terms.push_back(d_nodeManager->mkNode(Kind::GEQ, sum, c));
+          // the type is computed and cached concurrently
+          ASSERT_TRUE(terms.back().getType().isBoolean());
+        }
+        if (round + 1 == 20)
+        {
+          results[t] = terms;
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+  for (size_t t = 1; t < nthreads; ++t)
+  {
+    ASSERT_EQ(results[t], results[0]);
+  }
+}
+#endif
 }  // namespace test
 }  // namespace cvc5::internal
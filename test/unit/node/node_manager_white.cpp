@@ -79,5 +79,61 @@ TEST_F(TestNodeWhiteNodeManager, topological_sort)
     ASSERT_EQ(NodeManager::TopologicalSort(roots), result);
   }
 }
+
+TEST_F(TestNodeWhiteNodeManager, node_value_allocator)
+{
+  TypeNode boolType = d_nodeManager->booleanType();
+  std::vector<Node> vars;
+  for (size_t i = 0; i < 40; ++i)
+  {
+    vars.push_back(d_nodeManager->mkVar("x" + std::to_string(i), boolType));
+  }
+  // small nodes are allocated in slabs, large nodes are allocated separately
+  Node small = d_nodeManager->mkNode(Kind::AND, vars[0], vars[1]);
+  std::vector<Node> children(vars.begin(), vars.begin() + 12);
+  Node medium = d_nodeManager->mkNode(Kind::AND, children);
+  Node large = d_nodeManager->mkNode(Kind::AND, vars);
+  ASSERT_EQ(medium.getNumChildren(), 12);
+  ASSERT_EQ(large.getNumChildren(), 40);
+  ASSERT_EQ(medium, d_nodeManager->mkNode(Kind::AND, children));
+  ASSERT_EQ(large, d_nodeManager->mkNode(Kind::AND, vars));
+  ASSERT_GE(d_nodeManager->getBytesPerNodeValue(), sizeof(NodeValue));
+
+  // the slot of a reclaimed node value is reused
+  const NodeValueAllocator& alloc = d_nodeManager->d_nvAllocator;
+  size_t numNodeValues = alloc.getNumNodeValues();
+  small = Node::null();
+  d_nodeManager->reclaimZombies();
+  ASSERT_LT(alloc.getNumNodeValues(), numNodeValues);
+  size_t numBytes = alloc.getNumBytes();
+  Node other = d_nodeManager->mkNode(Kind::OR, vars[2], vars[3]);
+  ASSERT_EQ(alloc.getNumBytes(), numBytes);
+}
+
+TEST_F(TestNodeWhiteNodeManager, node_value_pool)
+{
+  // enough nodes to grow the pool several times
+  TypeNode intType = d_nodeManager->integerType();
+  Node x = d_nodeManager->mkVar("x", intType);
+  size_t size = d_nodeManager->d_nodeValuePool.size();
+  std::vector<Node> nodes;
+  for (int64_t i = 0; i < 5000; ++i)
+  {
+    Node c = d_nodeManager->mkConstInt(Rational(i));
+    nodes.push_back(d_nodeManager->mkNode(Kind::ADD, x, c));
+  }
+  ASSERT_GE(d_nodeManager->d_nodeValuePool.size(), size + 10000);
+  for (int64_t i = 0; i < 5000; ++i)
+  {
+    Node c = d_nodeManager->mkConstInt(Rational(i));
+    ASSERT_EQ(d_nodeManager->mkNode(Kind::ADD, x, c), nodes[i]);
+  }
+  nodes.clear();
+  d_nodeManager->reclaimZombies();
+  ASSERT_LT(d_nodeManager->d_nodeValuePool.size(), size + 10000);
+  Node c = d_nodeManager->mkConstInt(Rational(42));
+  ASSERT_EQ(d_nodeManager->mkNode(Kind::ADD, x, c),
+            d_nodeManager->mkNode(Kind::ADD, x, c));
+}
 }  // namespace test
 }  // namespace cvc5::internal
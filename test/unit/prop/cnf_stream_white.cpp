@@ -40,7 +40,9 @@ namespace test {
 class FakeSatSolver : public SatSolver
 {
  public:
-  FakeSatSolver() : d_nextVar(0), d_addClauseCalled(false) {}
+  FakeSatSolver() : d_nextVar(0), d_addClauseCalled(false), d_numClauses(0)
+  {
+  }
 
   SatVariable newVar(bool theoryAtom, bool canErase) override
   {
@@ -54,6 +56,7 @@ class FakeSatSolver : public SatSolver
   ClauseId addClause(SatClause& c, bool lemma) override
   {
     d_addClauseCalled = true;
+    d_numClauses++;
     return ClauseIdUndef;
   }
 
@@ -69,6 +72,8 @@ class FakeSatSolver : public SatSolver
 
   unsigned int addClauseCalled() { return d_addClauseCalled; }
 
+  size_t numClauses() const { return d_numClauses; }
+
   unsigned getAssertionLevel() const override { return 0; }
 
   bool isDecision(Node) const { return false; }
@@ -99,6 +104,7 @@ class FakeSatSolver : public SatSolver
  private:
   SatVariable d_nextVar;
   bool d_addClauseCalled;
+  size_t d_numClauses;
 };
 
 class TestPropWhiteCnfStream : public TestSmt
@@ -253,5 +259,134 @@ TEST_F(TestPropWhiteCnfStream, ensure_literal)
   ASSERT_TRUE(d_satSolver->addClauseCalled());
   ASSERT_TRUE(d_cnfStream->hasLiteral(a_and_b));
 }
+
+TEST_F(TestPropWhiteCnfStream, batch)
+{
+  Node a = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  Node b = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  Node c = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  Node d = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  Node ab = d_nodeManager->mkNode(Kind::AND, a, b);
+  Node cd = d_nodeManager->mkNode(Kind::OR, c, d);
+  Node shared = d_nodeManager->mkNode(Kind::XOR, ab, cd);
+  std::vector<Node> assertions = {
+      d_nodeManager->mkNode(Kind::OR, shared, a),
+      d_nodeManager->mkNode(Kind::IMPLIES, cd, shared.notNode()),
+      d_nodeManager->mkNode(Kind::ITE, a, ab, cd.notNode()),
+      d_nodeManager->mkNode(Kind::AND, d, ab.eqNode(cd)),
+      d_nodeManager->mkNode(Kind::AND, shared, b).notNode()};
+
+  // the batched conversion asserts the same clauses as the conversion of
+  // each assertion
+  for (const Node& assertion : assertions)
+  {
+    d_cnfStream->convertAndAssert(assertion, false, false);
+  }
+  FakeSatSolver satSolver;
+  Context context;
+  NullRegistrar registrar;
+  CnfStream cnfStream(
+      d_slvEngine->getEnv(), &satSolver, &registrar, &context);
+  cnfStream.convertAndAssertBatch(assertions);
+  ASSERT_EQ(satSolver.numClauses(), d_satSolver->numClauses());
+  for (const Node& n : {a, b, c, d, ab, cd, shared})
+  {
+    ASSERT_TRUE(cnfStream.hasLiteral(n));
+    ASSERT_EQ(cnfStream.getLiteral(n.notNode()), ~cnfStream.getLiteral(n));
+  }
+
+  // literals of subterms that were converted before are reused
+  satSolver.reset();
+  Node e = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  SatLiteral sharedLit = cnfStream.getLiteral(shared);
+  cnfStream.convertAndAssertBatch(
+      {d_nodeManager->mkNode(Kind::OR, shared, e)});
+  ASSERT_TRUE(satSolver.addClauseCalled());
+  ASSERT_EQ(cnfStream.getLiteral(shared), sharedLit);
+  ASSERT_TRUE(cnfStream.hasLiteral(e));
+}
+
+TEST_F(TestPropWhiteCnfStream, polarity)
+{
+  Node a = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  Node b = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  Node c = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  Node ab = d_nodeManager->mkNode(Kind::AND, a, b);
+  FakeSatSolver satSolver;
+  Context context;
+  NullRegistrar registrar;
+  CnfStream cnfStream(d_slvEngine->getEnv(),
+                      &satSolver,
+                      &registrar,
+                      &context,
+                      FormulaLitPolicy::INTERNAL,
+                      "",
+                      true);
+  // (and a b) only occurs positively, hence only (~ab | a) and (~ab | b)
+  // define it in addition to the asserted clause
+  cnfStream.convertAndAssert(
+      d_nodeManager->mkNode(Kind::OR, ab, c), false, false);
+  ASSERT_EQ(satSolver.numClauses(), 3u);
+  ASSERT_TRUE(cnfStream.isValueDefined(ab, true));
+  ASSERT_FALSE(cnfStream.isValueDefined(ab, false));
+  ASSERT_TRUE(cnfStream.isValueDefined(ab.notNode(), false));
+  ASSERT_TRUE(cnfStream.isValueDefined(c, false));
+  // using it negatively adds the missing clause
+  cnfStream.convertAndAssert(
+      d_nodeManager->mkNode(Kind::OR, ab.notNode(), c), false, false);
+  ASSERT_EQ(satSolver.numClauses(), 5u);
+  ASSERT_TRUE(cnfStream.isValueDefined(ab, false));
+  // the definition of a literal is completed when it is requested
+  Node bc = d_nodeManager->mkNode(Kind::OR, b, c);
+  cnfStream.convertAndAssert(
+      d_nodeManager->mkNode(Kind::OR, bc, a), false, false);
+  ASSERT_EQ(satSolver.numClauses(), 7u);
+  cnfStream.ensureLiteral(bc);
+  ASSERT_EQ(satSolver.numClauses(), 9u);
+  ASSERT_TRUE(cnfStream.isValueDefined(bc, false));
+}
+
+TEST_F(TestPropWhiteCnfStream, gates)
+{
+  d_slvEngine->setOption("cnf-gates", "true");
+  Node a = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  Node b = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  Node c = d_nodeManager->mkVar(d_nodeManager->booleanType());
+  FakeSatSolver satSolver;
+  Context context;
+  NullRegistrar registrar;
+  CnfStream cnfStream(
+      d_slvEngine->getEnv(), &satSolver, &registrar, &context);
+  // (or (and a b) (and (not a) c)) is (ite a b c), which is defined by 6
+  // clauses over the literals of a, b and c
+  Node ite = d_nodeManager->mkNode(
+      Kind::OR,
+      d_nodeManager->mkNode(Kind::AND, a, b),
+      d_nodeManager->mkNode(Kind::AND, a.notNode(), c));
+  cnfStream.ensureLiteral(ite);
+  ASSERT_EQ(satSolver.numClauses(), 6u);
+  ASSERT_FALSE(cnfStream.hasLiteral(ite[0]));
+  // (or (and a (not b)) (and (not a) b)) is (xor a b)
+  Node xorNode = d_nodeManager->mkNode(
+      Kind::OR,
+      d_nodeManager->mkNode(Kind::AND, a, b.notNode()),
+      d_nodeManager->mkNode(Kind::AND, a.notNode(), b));
+  cnfStream.ensureLiteral(xorNode);
+  ASSERT_EQ(satSolver.numClauses(), 10u);
+  // the pairwise encoding of at most one of a, b, c is recognized, whose
+  // positive polarity is defined by a clause per pair, without literals for
+  // the pairs
+  std::vector<Node> pairs;
+  for (const auto& [x, y] : {std::pair{a, b}, {a, c}, {b, c}})
+  {
+    pairs.push_back(
+        d_nodeManager->mkNode(Kind::OR, x.notNode(), y.notNode()));
+  }
+  Node amo = d_nodeManager->mkNode(Kind::AND, pairs);
+  cnfStream.ensureLiteral(amo);
+  ASSERT_EQ(satSolver.numClauses(), 10u + 3 + 3 * 2 + 1);
+  ASSERT_EQ(cnfStream.d_stats.d_numGates.get(), 3);
+}
+
 }  // namespace test
 }  // namespace cvc5::internal
@@ -0,0 +1,163 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of adding clauses to the SAT solvers.
+ */
+
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "prop/sat_solver.h"
+#include "prop/sat_solver_factory.h"
+#include "test_smt.h"
+
+namespace cvc5::internal {
+
+using namespace prop;
+
+namespace test {
+
+class TestPropBlackSatSolver : public TestSmt
+{
+ protected:
+  /**
+   * Make a standalone CaDiCaL solver with nvars fresh variables, which are
+   * returned. Within CDCL(T), CaDiCaL adds the clauses of addClauses one by
+   * one, which is not what is tested here.
+   */
+  std::unique_ptr<SatSolver> mkSolver(size_t nvars,
+                                      std::vector<SatVariable>& vars)
+  {
+    Env& env = d_slvEngine->getEnv();
+    std::unique_ptr<SatSolver> solver(SatSolverFactory::createCadical(
+        env, env.getStatisticsRegistry(), env.getResourceManager()));
+    vars.clear();
+    for (size_t i = 0; i < nvars; ++i)
+    {
+      vars.push_back(solver->newVar(false, true));
+    }
+    return solver;
+  }
+
+  /**
+   * Get nclauses random clauses of 3 literals over vars, each terminated by
+   * undefSatLiteral.
+   */
+  static std::vector<SatLiteral> mkClauses(const std::vector<SatVariable>& vars,
+                                           size_t nclauses)
+  {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<size_t> var(0, vars.size() - 1);
+    std::vector<SatLiteral> lits;
+    for (size_t i = 0; i < nclauses; ++i)
+    {
+      for (size_t j = 0; j < 3; ++j)
+      {
+        lits.push_back(SatLiteral(vars[var(rng)], rng() & 1));
+      }
+      lits.push_back(undefSatLiteral);
+    }
+    return lits;
+  }
+
+  /** Add the clauses of lits one by one via addClause */
+  static void addOneByOne(SatSolver& solver,
+                          const std::vector<SatLiteral>& lits)
+  {
+    SatClause clause;
+    for (const SatLiteral& lit : lits)
+    {
+      if (!lit.isNull())
+      {
+        clause.push_back(lit);
+        continue;
+      }
+      // a fresh clause per clause, as encoders do
+      SatClause c(clause);
+      solver.addClause(c, false);
+      clause.clear();
+    }
+  }
+
+  /**
+   * Check the clauses of lits, which are over vars, with a solver engine
+   * using MiniSat. MiniSat is only used within CDCL(T), where addClauses is
+   * called by the batched CNF conversion of the input formulas.
+   */
+  Result checkMinisat(const std::vector<SatVariable>& vars,
+                      const std::vector<SatLiteral>& lits,
+                      bool cnfBatch)
+  {
+    std::unique_ptr<SolverEngine> slv(new SolverEngine(d_nodeManager.get()));
+    slv->setOption("sat-solver", "minisat");
+    slv->setOption("cnf-batch", cnfBatch ? "true" : "false");
+    slv->finishInit();
+    std::map<SatVariable, Node> atoms;
+    for (SatVariable v : vars)
+    {
+      atoms[v] = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    }
+    std::vector<Node> clause;
+    for (const SatLiteral& lit : lits)
+    {
+      if (!lit.isNull())
+      {
+        Node atom = atoms[lit.getSatVariable()];
+        clause.push_back(lit.isNegated() ? atom.notNode() : atom);
+        continue;
+      }
+      slv->assertFormula(d_nodeManager->mkNode(Kind::OR, clause));
+      clause.clear();
+    }
+    return slv->checkSat();
+  }
+};
+
+TEST_F(TestPropBlackSatSolver, add_clauses)
+{
+  // random 3-SAT instances around the phase transition, some of which are
+  // unsatisfiable
+  for (size_t nclauses : {150, 200, 250, 300})
+  {
+    std::vector<SatVariable> vars;
+    std::unique_ptr<SatSolver> single = mkSolver(50, vars);
+    std::vector<SatLiteral> lits = mkClauses(vars, nclauses);
+    addOneByOne(*single, lits);
+    std::unique_ptr<SatSolver> bulk = mkSolver(50, vars);
+    bulk->addClauses(lits, false);
+    ASSERT_EQ(single->solve(), bulk->solve());
+  }
+
+  std::vector<SatVariable> vars;
+  std::unique_ptr<SatSolver> solver = mkSolver(1, vars);
+  SatLiteral x(vars[0]);
+  solver->addClauses({x, undefSatLiteral, ~x, undefSatLiteral}, false);
+  ASSERT_EQ(solver->solve(), SAT_VALUE_FALSE);
+}
+
+TEST_F(TestPropBlackSatSolver, add_clauses_minisat)
+{
+  // the instances of add_clauses, whose results are taken from CaDiCaL
+  for (size_t nclauses : {150, 200, 250, 300})
+  {
+    std::vector<SatVariable> vars;
+    std::unique_ptr<SatSolver> cadical = mkSolver(50, vars);
+    std::vector<SatLiteral> lits = mkClauses(vars, nclauses);
+    cadical->addClauses(lits, false);
+    Result::Status expected =
+        cadical->solve() == SAT_VALUE_TRUE ? Result::SAT : Result::UNSAT;
+    ASSERT_EQ(checkMinisat(vars, lits, false).getStatus(), expected);
+    ASSERT_EQ(checkMinisat(vars, lits, true).getStatus(), expected);
+  }
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
@@ -0,0 +1,135 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of the double precision simplex.
+ */
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "test.h"
+#include "theory/arith/linear/float_simplex.h"
+
+namespace cvc5::internal {
+
+using namespace theory::arith::linear;
+
+namespace test {
+
+class TestTheoryBlackArithFloatSimplex : public TestInternal
+{
+ protected:
+  static constexpr double INF = std::numeric_limits<double>::infinity();
+
+  /** Checks that the values of s are within the bounds and satisfy rows */
+  static void checkSolution(
+      const FloatSimplex& s,
+      const std::vector<std::vector<std::pair<size_t, double>>>& rows,
+      const std::vector<std::pair<double, double>>& bounds)
+  {
+    size_t n = s.getNumVars() - rows.size();
+    for (size_t var = 0; var < s.getNumVars(); ++var)
+    {
+      double tol = 1e-6 * std::max(1.0, std::fabs(s.getValue(var)));
+      ASSERT_GE(s.getValue(var), bounds[var].first - tol);
+      ASSERT_LE(s.getValue(var), bounds[var].second + tol);
+    }
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+      double sum = 0;
+      for (const std::pair<size_t, double>& e : rows[i])
+      {
+        sum += e.second * s.getValue(e.first);
+      }
+      double tol = 1e-6 * std::max(1.0, std::fabs(sum));
+      ASSERT_NEAR(sum, s.getValue(n + i), tol);
+    }
+  }
+};
+
+TEST_F(TestTheoryBlackArithFloatSimplex, small)
+{
+  // x + y >= 3, x - y <= 0, 0 <= x <= 2, 0 <= y <= 2
+  FloatSimplex s(2);
+  size_t r0 = s.addRow({{0, 1.0}, {1, 1.0}});
+  size_t r1 = s.addRow({{0, 1.0}, {1, -1.0}});
+  s.setBounds(0, 0, 2);
+  s.setBounds(1, 0, 2);
+  s.setBounds(r0, 3, INF);
+  s.setBounds(r1, -INF, 0);
+  ASSERT_EQ(s.solve(100), FloatSimplex::Result::FEASIBLE);
+  checkSolution(s,
+                {{{0, 1.0}, {1, 1.0}}, {{0, 1.0}, {1, -1.0}}},
+                {{0, 2}, {0, 2}, {3, INF}, {-INF, 0}});
+
+  // x + y >= 3, 0 <= x <= 1, 0 <= y <= 1
+  FloatSimplex t(2);
+  size_t r = t.addRow({{0, 1.0}, {1, 1.0}});
+  t.setBounds(0, 0, 1);
+  t.setBounds(1, 0, 1);
+  t.setBounds(r, 3, INF);
+  ASSERT_EQ(t.solve(100), FloatSimplex::Result::INFEASIBLE);
+  ASSERT_EQ(t.solve(0), FloatSimplex::Result::LIMIT);
+}
+
+TEST_F(TestTheoryBlackArithFloatSimplex, random)
+{
+  // random sparse problems that are feasible by construction: the bounds
+  // are chosen around a point
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<double> coeff(-10, 10);
+  std::uniform_real_distribution<double> unit(0, 1);
+  for (size_t round = 0; round < 20; ++round)
+  {
+    size_t n = 40 + round * 5;
+    size_t m = 30 + round * 10;
+    std::vector<double> point(n);
+    for (double& p : point)
+    {
+      p = coeff(rng);
+    }
+    FloatSimplex s(n);
+    std::vector<std::vector<std::pair<size_t, double>>> rows(m);
+    std::vector<std::pair<double, double>> bounds;
+    for (size_t j = 0; j < n; ++j)
+    {
+      double lb = unit(rng) < 0.8 ? point[j] - 5 * unit(rng) : -INF;
+      double ub = unit(rng) < 0.8 ? point[j] + 5 * unit(rng) : INF;
+      s.setBounds(j, lb, ub);
+      bounds.emplace_back(lb, ub);
+    }
+    for (size_t i = 0; i < m; ++i)
+    {
+      double value = 0;
+      for (size_t j = 0; j < n; ++j)
+      {
+        if (unit(rng) < 0.1)
+        {
+          rows[i].emplace_back(j, std::round(coeff(rng)));
+          value += rows[i].back().second * point[j];
+        }
+      }
+      size_t r = s.addRow(rows[i]);
+      // tight rows, some of which are equalities
+      double slack = unit(rng) < 0.2 ? 0 : unit(rng);
+      double lb = unit(rng) < 0.7 ? value - slack : -INF;
+      double ub = unit(rng) < 0.7 ? value + slack : INF;
+      s.setBounds(r, lb, ub);
+      bounds.emplace_back(lb, ub);
+    }
+    ASSERT_EQ(s.solve(100000), FloatSimplex::Result::FEASIBLE);
+    checkSolution(s, rows, bounds);
+  }
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
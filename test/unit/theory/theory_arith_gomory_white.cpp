@@ -0,0 +1,103 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * White box testing of the Gomory mixed-integer cuts.
+ */
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "smt/smt_solver.h"
+#include "test_smt.h"
+#include "theory/arith/linear/gomory_cuts.h"
+#include "theory/arith/theory_arith.h"
+#include "theory/theory_engine.h"
+#include "util/rational.h"
+#include "util/statistics_registry.h"
+
+namespace cvc5::internal {
+
+using namespace theory;
+using namespace theory::arith::linear;
+
+namespace test {
+
+class TestTheoryWhiteArithGomory : public TestSmtNoFinishInit
+{
+ protected:
+  void SetUp() override
+  {
+    TestSmtNoFinishInit::SetUp();
+    d_slvEngine->setOption("gomory-cuts", "true");
+    d_slvEngine->setOption("dio-solver", "false");
+    d_slvEngine->finishInit();
+  }
+
+  GomoryCuts& getGomoryCuts()
+  {
+    TheoryEngine* te = d_slvEngine->d_smtSolver->getTheoryEngine();
+    arith::TheoryArith* arith =
+        static_cast<arith::TheoryArith*>(te->d_theoryTable[THEORY_ARITH]);
+    return arith->d_internal.d_internal.d_gomoryCuts;
+  }
+};
+
+TEST_F(TestTheoryWhiteArithGomory, mir)
+{
+  // x_b = 7/2 + 1/2 y_1 - 5/4 y_2 + 3/10 y_3 - 1/5 y_4, where y_1 and y_2 are
+  // integral. The GMI of the row x_b - 1/2 y_1 + 5/4 y_2 - 3/10 y_3 + 1/5 y_4
+  // = 7/2 with f_0 = 1/2 has the coefficients f_1 / f_0 = 1,
+  // (1 - f_2) / (1 - f_0) = 1/2, 3/10 / (1 - f_0) = 3/5 and 1/5 / f_0 = 2/5.
+  GomoryCuts& gc = getGomoryCuts();
+  std::vector<std::pair<ArithVar, Rational>> row = {{1, Rational(1, 2)},
+                                                    {2, Rational(-5, 4)},
+                                                    {3, Rational(3, 10)},
+                                                    {4, Rational(-1, 5)}};
+  std::vector<bool> integral = {true, true, false, false};
+  std::vector<Rational> g;
+  double e = gc.mir(row, Rational(7, 2), integral, Rational(1), g);
+  std::vector<Rational> expected = {
+      Rational(1), Rational(1, 2), Rational(3, 5), Rational(2, 5)};
+  ASSERT_EQ(g, expected);
+  ASSERT_DOUBLE_EQ(e, 1 / std::sqrt(1 + 0.25 + 0.36 + 0.16));
+
+  // the row multiplied by 2 has an integral right-hand side
+  ASSERT_EQ(gc.mir(row, Rational(7, 2), integral, Rational(2), g), 0);
+}
+
+TEST_F(TestTheoryWhiteArithGomory, emitted)
+{
+  // 3x + 5y = 7 has no solution over the non-negative integers, the
+  // relaxation has a fractional vertex from which cuts are derived
+  Node x = d_nodeManager->mkVar("x", d_nodeManager->integerType());
+  Node y = d_nodeManager->mkVar("y", d_nodeManager->integerType());
+  Node zero = d_nodeManager->mkConstInt(Rational(0));
+  Node sum = d_nodeManager->mkNode(
+      Kind::ADD,
+      d_nodeManager->mkNode(
+          Kind::MULT, d_nodeManager->mkConstInt(Rational(3)), x),
+      d_nodeManager->mkNode(
+          Kind::MULT, d_nodeManager->mkConstInt(Rational(5)), y));
+  d_slvEngine->assertFormula(d_nodeManager->mkNode(Kind::GEQ, x, zero));
+  d_slvEngine->assertFormula(d_nodeManager->mkNode(Kind::GEQ, y, zero));
+  d_slvEngine->assertFormula(
+      sum.eqNode(d_nodeManager->mkConstInt(Rational(7))));
+  ASSERT_EQ(d_slvEngine->checkSat().getStatus(), Result::UNSAT);
+#ifdef CVC5_STATISTICS_ON
+  StatisticBaseValue* emitted =
+      d_slvEngine->getEnv().getStatisticsRegistry().get(
+          "theory::arith::gomory::emitted");
+  ASSERT_NE(emitted, nullptr);
+  ASSERT_GT(std::get<int64_t>(emitted->getViewer()), 0);
+#endif
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
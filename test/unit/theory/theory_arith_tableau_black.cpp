@@ -0,0 +1,164 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of pivoting in the simplex tableau.
+ */
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "test.h"
+#include "theory/arith/linear/tableau.h"
+#include "util/rational.h"
+
+namespace cvc5::internal {
+
+using namespace theory::arith::linear;
+
+namespace test {
+
+class TestTheoryBlackArithTableau : public TestInternal
+{
+ protected:
+  /**
+   * Fill t with nrows rows over ncols non-basic variables, with about
+   * density * ncols entries per row. The basic variables are the variables
+   * ncols to ncols + nrows - 1.
+   */
+  static void mkTableau(Tableau& t,
+                        size_t nrows,
+                        size_t ncols,
+                        double density)
+  {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> keep(0, 1);
+    std::uniform_int_distribution<int> coeff(-9, 9);
+    t.increaseSizeTo(nrows + ncols);
+    for (size_t r = 0; r < nrows; ++r)
+    {
+      std::vector<Rational> coeffs;
+      std::vector<ArithVar> vars;
+      for (ArithVar v = 0; v < ncols; ++v)
+      {
+        int c = coeff(rng);
+        if (c != 0 && keep(rng) < density)
+        {
+          coeffs.push_back(Rational(c));
+          vars.push_back(v);
+        }
+      }
+      t.addRow(ncols + r, coeffs, vars);
+    }
+  }
+
+  /** The entries of the row of basic in iteration order */
+  static std::vector<std::pair<ArithVar, Rational>> getRow(const Tableau& t,
+                                                           ArithVar basic)
+  {
+    std::vector<std::pair<ArithVar, Rational>> row;
+    for (Tableau::RowIterator i = t.basicRowIterator(basic); !i.atEnd(); ++i)
+    {
+      row.emplace_back((*i).getColVar(), (*i).getCoefficient());
+    }
+    return row;
+  }
+
+  /**
+   * Pivot n times on t, choosing the pivots with rng. If undo is true, each
+   * pivot is immediately reverted, which keeps the tableau from filling in.
+   * Returns false if no pivot is possible.
+   */
+  static bool pivot(Tableau& t, std::mt19937& rng, size_t n, bool undo)
+  {
+    NoEffectCCCB cb;
+    std::vector<ArithVar> basics;
+    for (Tableau::BasicIterator i = t.beginBasic(), end = t.endBasic();
+         i != end;
+         ++i)
+    {
+      basics.push_back(*i);
+    }
+    for (size_t k = 0; k < n; ++k)
+    {
+      ArithVar basic = basics[rng() % basics.size()];
+      std::vector<ArithVar> candidates;
+      for (Tableau::RowIterator i = t.basicRowIterator(basic); !i.atEnd(); ++i)
+      {
+        if (!t.isBasic((*i).getColVar()))
+        {
+          candidates.push_back((*i).getColVar());
+        }
+      }
+      if (candidates.empty())
+      {
+        return false;
+      }
+      ArithVar entering = candidates[rng() % candidates.size()];
+      t.pivot(basic, entering, cb);
+      if (undo)
+      {
+        t.pivot(entering, basic, cb);
+        continue;
+      }
+      std::replace(basics.begin(), basics.end(), basic, entering);
+    }
+    return true;
+  }
+};
+
+TEST_F(TestTheoryBlackArithTableau, compact)
+{
+  Tableau plain;
+  Tableau compacted;
+  compacted.setCompactPeriod(1);
+  mkTableau(plain, 30, 60, 0.15);
+  mkTableau(compacted, 30, 60, 0.15);
+  std::mt19937 rngPlain(7);
+  std::mt19937 rngCompacted(7);
+  for (size_t k = 0; k < 50; ++k)
+  {
+    ASSERT_TRUE(pivot(plain, rngPlain, 1, false));
+    ASSERT_TRUE(pivot(compacted, rngCompacted, 1, false));
+    ASSERT_EQ(plain.size(), compacted.size());
+    // compaction drops the freed entries
+    ASSERT_EQ(compacted.getNumEntriesInTableau(), compacted.size());
+    for (Tableau::BasicIterator i = plain.beginBasic(), end = plain.endBasic();
+         i != end;
+         ++i)
+    {
+      ASSERT_TRUE(compacted.isBasic(*i));
+      ASSERT_EQ(getRow(plain, *i), getRow(compacted, *i));
+    }
+    for (ArithVar v = 0; v < plain.getNumColumns(); ++v)
+    {
+      ASSERT_EQ(plain.getColLength(v), compacted.getColLength(v));
+    }
+  }
+}
+
+TEST_F(TestTheoryBlackArithTableau, pivot_compaction)
+{
+  // pivoting with periodic compaction gives the same rows as without
+  std::vector<std::pair<ArithVar, Rational>> rows[2];
+  for (size_t period : {0, 100})
+  {
+    Tableau t;
+    t.setCompactPeriod(period);
+    mkTableau(t, 200, 400, 0.02);
+    std::mt19937 rng(11);
+    ASSERT_TRUE(pivot(t, rng, 5000, true));
+    rows[period == 0 ? 0 : 1] = getRow(t, *t.beginBasic());
+  }
+  ASSERT_EQ(rows[0], rows[1]);
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
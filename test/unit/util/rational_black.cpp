@@ -13,7 +13,10 @@
  * Black box testing of cvc5::Rational.
  */
 
+#include <climits>
+#include <random>
 #include <sstream>
+#include <vector>
 
 #include "test.h"
 #include "util/rational.h"
@@ -42,5 +45,116 @@ TEST_F(TestUtilBlackRational, fromDecimal)
   ASSERT_THROW(Rational::fromDecimal("1.2/3");, std::invalid_argument);
   ASSERT_THROW(Rational::fromDecimal("Hello, world!");, std::invalid_argument);
 }
+
+TEST_F(TestUtilBlackRational, arithmetic)
+{
+  // Compares the arithmetic on rationals with the arithmetic on their
+  // numerators and denominators, for values around the boundary of machine
+  // integers
+  std::mt19937_64 rng(7);
+  std::vector<Integer> ints = {Integer(0),
+                               Integer(1),
+                               Integer(2),
+                               Integer(3),
+                               Integer("4294967296"),
+                               Integer("3037000499"),
+                               Integer("3037000500"),
+                               Integer("9223372036854775806"),
+                               Integer("9223372036854775807"),
+                               Integer("9223372036854775808"),
+                               Integer("18446744073709551616")};
+  auto randomInt = [&]() {
+    switch (rng() % 4)
+    {
+      case 0: return ints[rng() % ints.size()];
+      case 1: return Integer(static_cast<long>(rng() % 1000));
+      case 2: return Integer(static_cast<long>(rng() >> 1));
+      default: return Integer(static_cast<long>(rng() >> 33));
+    }
+  };
+  for (size_t i = 0; i < 10000; ++i)
+  {
+    Integer a = randomInt(), b = randomInt() + 1;
+    Integer c = randomInt(), d = randomInt() + 1;
+    if (rng() & 1) a = -a;
+    if (rng() & 1) c = -c;
+    Rational x(a, b), y(c, d);
+    ASSERT_EQ(x + y, Rational(a * d + c * b, b * d));
+    ASSERT_EQ(x - y, Rational(a * d - c * b, b * d));
+    ASSERT_EQ(x * y, Rational(a * c, b * d));
+    if (!c.isZero())
+    {
+      ASSERT_EQ(x / y, Rational(a * d, b * c));
+    }
+    Integer l = a * d, r = c * b;
+    int cmp = x.cmp(y);
+    ASSERT_EQ(cmp < 0, l < r);
+    ASSERT_EQ(cmp > 0, l > r);
+    ASSERT_EQ(x == y, l == r);
+    ASSERT_EQ(x.sgn(), a.sgn());
+    ASSERT_EQ(x.floor(), a.floorDivideQuotient(b));
+    ASSERT_EQ(x.isIntegral(), x.getDenominator().isOne());
+    Rational z(a * d + c * b, b * d);
+    z -= y;
+    ASSERT_EQ(z, x);
+    ASSERT_EQ(z.hash(), x.hash());
+    ASSERT_EQ(z.toString(), x.toString());
+    ASSERT_EQ(Rational(x.toString()), x);
+    ASSERT_EQ(Rational(x.getValue()), x);
+  }
+}
+
+TEST_F(TestUtilBlackRational, machineIntegers)
+{
+  ASSERT_EQ(Rational(INT_MIN), Rational(Integer(INT_MIN)));
+  ASSERT_EQ(Rational(INT_MAX), Rational(Integer(INT_MAX)));
+  ASSERT_EQ(Rational(UINT_MAX), Rational(Integer(UINT_MAX)));
+  ASSERT_EQ(Rational(LONG_MIN), Rational(Integer(LONG_MIN)));
+  ASSERT_EQ(Rational(-LONG_MAX), -Rational(LONG_MAX));
+  ASSERT_EQ(Rational(ULONG_MAX), Rational(Integer(ULONG_MAX)));
+  ASSERT_EQ(Rational(INT_MIN).getValue(), mpq_class(INT_MIN));
+  ASSERT_EQ(Rational(ULONG_MAX, 2UL).getValue(), mpq_class(ULONG_MAX, 2UL));
+}
+
+TEST_F(TestUtilBlackRational, pivot)
+{
+  // Pivots a dense tableau with small coefficients, as done by the simplex
+  // solver
+  constexpr size_t n = 60;
+  std::mt19937 rng(3);
+  std::vector<std::vector<Rational>> rows(n, std::vector<Rational>(n));
+  for (size_t i = 0; i < n; ++i)
+  {
+    for (size_t j = 0; j < n; ++j)
+    {
+      rows[i][j] = Rational(static_cast<long>(rng() % 7) - 3, 1L);
+    }
+    rows[i][i] += Rational(20, 1);
+  }
+  for (size_t round = 0; round < 4; ++round)
+  {
+    for (size_t p = 0; p < n; p += 7)
+    {
+      Rational inv = rows[p][p].inverse();
+      for (Rational& q : rows[p])
+      {
+        q *= inv;
+      }
+      for (size_t i = 0; i < n; ++i)
+      {
+        if (i == p || rows[i][p].isZero()) continue;
+        Rational f = rows[i][p];
+        for (size_t j = 0; j < n; ++j)
+        {
+          rows[i][j] -= f * rows[p][j];
+        }
+      }
+    }
+  }
+  for (size_t p = 0; p < n; p += 7)
+  {
+    ASSERT_TRUE(rows[p][p].isOne());
+  }
+}
 }  // namespace test
 }  // namespace cvc5::internal
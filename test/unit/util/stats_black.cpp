@@ -14,8 +14,10 @@
  */
 
 #include <fcntl.h>
+#include <unistd.h>
 
 #include <ctime>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -23,6 +25,7 @@
 #include "lib/clock_gettime.h"
 #include "cvc5/cvc5_proof_rule.h"
 #include "test_env.h"
+#include "util/statistics_exporter.h"
 #include "util/statistics_registry.h"
 #include "util/statistics_stats.h"
 
@@ -97,5 +100,101 @@ TEST_F(TestUtilBlackStats, stats)
   ASSERT_EQ(reg.get("backedDoubleNoDec"), std::string("17"));
 #endif
 }
+
+TEST_F(TestUtilBlackStats, sampling)
+{
+#ifdef CVC5_STATISTICS_ON
+  StatisticsRegistry reg(false, false, false, 4, true);
+
+  // only the first and the fifth activation are measured
+  TimerStat timer = reg.registerTimer("timer");
+  for (size_t i = 0; i < 8; ++i)
+  {
+    CodeTimer ct(timer);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  auto* value = dynamic_cast<StatisticTimerValue*>(reg.get("timer"));
+  ASSERT_NE(value, nullptr);
+  ASSERT_EQ(value->d_activations, 8u);
+  ASSERT_EQ(value->d_samples, 2u);
+  ASSERT_GE(value->get(), 40u);
+
+  auto* overhead = dynamic_cast<StatisticOverheadValue*>(
+      reg.get("statistics::timerOverhead"));
+  ASSERT_NE(overhead, nullptr);
+  ASSERT_EQ(overhead->d_timers.size(), 1u);
+  ASSERT_GE(overhead->get(), 0.0);
+
+  // integer statistics do not share cache lines
+  IntStat i1 = reg.registerInt("int1");
+  IntStat i2 = reg.registerInt("int2");
+  ++i1;
+  i2 += 3;
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(reg.get("int1")) % 64, 0u);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(reg.get("int2")) % 64, 0u);
+  ASSERT_EQ(reg.get("int1"), std::string("1"));
+  ASSERT_EQ(reg.get("int2"), std::string("3"));
+#endif
+}
+
+TEST_F(TestUtilBlackStats, json_delta)
+{
+#ifdef CVC5_STATISTICS_ON
+  StatisticsRegistry reg(false, false, false);
+  StatisticsRegistry::Snapshot snapshot;
+  IntStat intstat = reg.registerInt("int");
+  HistogramStat<int64_t> hist = reg.registerHistogram<int64_t>("hist");
+  ValueStat<std::string> str =
+      reg.registerValue<std::string>("str", std::string("a\"b"));
+  IntStat unused = reg.registerInt("unused");
+
+  intstat += 5;
+  hist << 1 << 2;
+  std::stringstream ss;
+  reg.printJsonDelta(ss, snapshot);
+  ASSERT_EQ(ss.str(),
+            "\"hist\":{\"1\":1,\"2\":1},\"int\":5,\"str\":\"a\\\"b\"");
+
+  intstat += 2;
+  hist << 2;
+  ss.str("");
+  reg.printJsonDelta(ss, snapshot);
+  ASSERT_EQ(ss.str(), "\"hist\":{\"2\":1},\"int\":2");
+
+  ss.str("");
+  reg.printJsonDelta(ss, snapshot);
+  ASSERT_EQ(ss.str(), "");
+
+  // JSON has no infinity
+  ValueStat<double> dbl = reg.registerValue<double>("double", 0.5);
+  ss.str("");
+  reg.printJsonDelta(ss, snapshot);
+  ASSERT_EQ(ss.str(), "\"double\":0.5");
+  dbl = std::numeric_limits<double>::infinity();
+  ss.str("");
+  reg.printJsonDelta(ss, snapshot);
+  ASSERT_EQ(ss.str(), "\"double\":null");
+
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  StatisticsExporter exporter(reg, fds[1], 1000);
+  exporter.begin();
+  ++intstat;
+  exporter.end();
+  close(fds[1]);
+  char buf[256];
+  ssize_t n = read(fds[0], buf, sizeof(buf));
+  close(fds[0]);
+  ASSERT_GT(n, 0);
+  std::string line(buf, n);
+  ASSERT_EQ(line.find("{\"query\":1,"), 0u);
+  // the first line of an exporter holds all values that are set
+  ASSERT_NE(
+      line.find("\"final\":true,\"stats\":{\"double\":null,\"hist\":"),
+      std::string::npos);
+  ASSERT_NE(line.find("\"int\":8,"), std::string::npos);
+  ASSERT_EQ(line.back(), '\n');
+#endif
+}
 }  // namespace test
 }  // namespace cvc5::internal
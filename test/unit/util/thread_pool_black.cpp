@@ -0,0 +1,100 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of cvc5::ThreadPool.
+ */
+
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test.h"
+#include "util/thread_pool.h"
+
+namespace cvc5::internal {
+namespace test {
+
+class TestUtilBlackThreadPool : public TestInternal
+{
+};
+
+TEST_F(TestUtilBlackThreadPool, run)
+{
+  for (size_t threads : {1, 2, 4})
+  {
+    ThreadPool pool(threads);
+    ASSERT_EQ(pool.getNumThreads(), threads);
+    for (size_t batch = 0; batch < 20; ++batch)
+    {
+      std::vector<uint64_t> results(100 + batch, 0);
+      std::vector<std::function<void()>> tasks;
+      for (size_t i = 0; i < results.size(); ++i)
+      {
+        tasks.emplace_back([&results, i]() {
+          uint64_t x = i;
+          for (size_t k = 0; k < 1000; ++k)
+          {
+            x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+          }
+          results[i] = x;
+        });
+      }
+      pool.run(tasks);
+      for (size_t i = 0; i < results.size(); ++i)
+      {
+        uint64_t x = i;
+        for (size_t k = 0; k < 1000; ++k)
+        {
+          x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        }
+        ASSERT_EQ(results[i], x);
+      }
+    }
+    pool.run({});
+  }
+}
+
+TEST_F(TestUtilBlackThreadPool, exceptions)
+{
+  ThreadPool pool(3);
+  std::vector<char> done(10, false);
+  std::vector<std::function<void()>> tasks;
+  for (size_t i = 0; i < done.size(); ++i)
+  {
+    tasks.emplace_back([&done, i]() {
+      if (i == 3 || i == 7)
+      {
+        throw std::runtime_error(std::to_string(i));
+      }
+      done[i] = true;
+    });
+  }
+  try
+  {
+    pool.run(tasks);
+    FAIL();
+  }
+  catch (const std::runtime_error& e)
+  {
+    // the exception of the first failing task
+    ASSERT_EQ(std::string(e.what()), "3");
+  }
+  for (size_t i = 0; i < done.size(); ++i)
+  {
+    ASSERT_EQ(done[i] != 0, i != 3 && i != 7);
+  }
+  // the pool is still usable
+  bool ran = false;
+  pool.run({[&ran]() { ran = true; }});
+  ASSERT_TRUE(ran);
+}
+
+}  // namespace test
+}  // namespace cvc5::internal